@@ -0,0 +1,294 @@
+// Headless benchmark for MentalGL
+// Measures the time per query and print call in a surfaceless EGL context and writes the results as JSON to stdout
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <glad/glad.h>
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+// Count all allocations of MentalGL through its allocation hooks
+static size_t g_numAllocs;
+static size_t g_numAllocBytes;
+
+static void* benchCalloc(size_t count, size_t size)
+{
+    ++g_numAllocs;
+    g_numAllocBytes += count * size;
+    return calloc(count, size);
+}
+
+#define MGL_CALLOC(TYPE, COUNT) ((TYPE*)benchCalloc(COUNT, sizeof(TYPE)))
+#define MGL_FREE(OBJ)           free(OBJ)
+
+#ifndef MENTAL_GL_IMPLEMENTATION
+#define MENTAL_GL_IMPLEMENTATION
+#endif
+
+#include "mental_gl.h"
+
+typedef void (*BenchProc)(void* user);
+
+// Bump allocator that is reset after each print; the most recent block is reallocated in place
+typedef struct BenchArena
+{
+    char*   buf;
+    size_t  cap;
+    size_t  off;
+    void*   last;
+}
+BenchArena;
+
+typedef struct BenchContext
+{
+    MGLRenderState          rs;
+    MGLBindingPoints        bp;
+    MGLImplementationLimits limits;
+    MGLFormattingOptions    fmt;
+    MGLString               reuse;
+    BenchArena              arena;
+    MGLAllocator            allocator;
+    MGLWatchList            watch;
+    char                    watchData[256];
+}
+BenchContext;
+
+static double benchNow(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (double)t.tv_sec * 1.0e9 + (double)t.tv_nsec;
+}
+
+static void* benchArenaAllocate(void* user, size_t size)
+{
+    BenchArena* arena = (BenchArena*)user;
+    size = (size + 15) & ~(size_t)15;
+    if (arena->off + size > arena->cap)
+        return NULL;
+    arena->last = arena->buf + arena->off;
+    arena->off += size;
+    return arena->last;
+}
+
+static void* benchArenaReallocate(void* user, void* ptr, size_t oldSize, size_t newSize)
+{
+    BenchArena* arena = (BenchArena*)user;
+    if (ptr != NULL && ptr == arena->last)
+    {
+        // Grow or shrink the most recent block in place
+        newSize = (newSize + 15) & ~(size_t)15;
+        const size_t off = (size_t)((char*)ptr - arena->buf);
+        if (off + newSize > arena->cap)
+            return NULL;
+        arena->off = off + newSize;
+        return ptr;
+    }
+    void* newPtr = benchArenaAllocate(user, newSize);
+    if (newPtr != NULL && ptr != NULL)
+        memcpy(newPtr, ptr, (oldSize < newSize ? oldSize : newSize));
+    return newPtr;
+}
+
+static int createHeadlessContext(void)
+{
+    // Prefer the surfaceless platform, so no window system is required
+    PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+    EGLDisplay display = EGL_NO_DISPLAY;
+
+    #ifdef EGL_PLATFORM_SURFACELESS_MESA
+    if (getPlatformDisplay != NULL)
+        display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+    #endif
+    if (display == EGL_NO_DISPLAY)
+        display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+
+    EGLint major = 0, minor = 0;
+    if (!eglInitialize(display, &major, &minor) || !eglBindAPI(EGL_OPENGL_API))
+        return 0;
+
+    EGLint configAttribs[] = { EGL_SURFACE_TYPE, EGL_PBUFFER_BIT, EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT, EGL_NONE };
+    EGLConfig config = NULL;
+    EGLint numConfigs = 0;
+    eglChooseConfig(display, configAttribs, &config, 1, &numConfigs);
+
+    EGLint contextAttribs[] = { EGL_CONTEXT_MAJOR_VERSION, 4, EGL_CONTEXT_MINOR_VERSION, 5, EGL_NONE };
+    EGLContext context = eglCreateContext(display, (numConfigs > 0 ? config : (EGLConfig)0), EGL_NO_CONTEXT, contextAttribs);
+    if (context == EGL_NO_CONTEXT)
+    {
+        // Fall back to the default context version
+        context = eglCreateContext(display, (numConfigs > 0 ? config : (EGLConfig)0), EGL_NO_CONTEXT, NULL);
+        if (context == EGL_NO_CONTEXT)
+            return 0;
+    }
+
+    return (eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context) && gladLoadGLLoader((GLADloadproc)eglGetProcAddress));
+}
+
+static void benchQueryRenderState(void* user)
+{
+    BenchContext* ctx = (BenchContext*)user;
+    mglQueryRenderState(&(ctx->rs));
+}
+
+static void benchQueryRenderStateWithLimits(void* user)
+{
+    BenchContext* ctx = (BenchContext*)user;
+    mglQueryRenderStateWithLimits(&(ctx->rs), &(ctx->limits));
+}
+
+static void benchQueryBindingPoints(void* user)
+{
+    BenchContext* ctx = (BenchContext*)user;
+    mglQueryBindingPoints(&(ctx->bp));
+}
+
+static void benchPrintRenderState(void* user)
+{
+    BenchContext* ctx = (BenchContext*)user;
+    mglFreeString(mglPrintRenderState(&(ctx->rs), &(ctx->fmt)));
+}
+
+static void benchPrintRenderStateInto(void* user)
+{
+    BenchContext* ctx = (BenchContext*)user;
+    ctx->reuse = mglPrintRenderStateInto(ctx->reuse, &(ctx->rs), &(ctx->fmt));
+}
+
+static void benchPrintRenderStateArena(void* user)
+{
+    BenchContext* ctx = (BenchContext*)user;
+    mglFreeString(mglPrintRenderState(&(ctx->rs), &(ctx->fmt)));
+    ctx->arena.off  = 0;
+    ctx->arena.last = NULL;
+}
+
+static void benchPrintBindingPoints(void* user)
+{
+    BenchContext* ctx = (BenchContext*)user;
+    mglFreeString(mglPrintBindingPoints(&(ctx->bp), &(ctx->fmt)));
+}
+
+static void benchQueryWatchList(void* user)
+{
+    BenchContext* ctx = (BenchContext*)user;
+    mglQueryWatchList(ctx->watch, ctx->watchData);
+}
+
+// Runs the specified benchmark and writes its result as JSON object
+static void runBench(const char* name, BenchProc proc, BenchContext* ctx, int iterations, int* first)
+{
+    // Warm up, e.g. to allocate reusable output strings
+    proc(ctx);
+
+    const size_t numAllocs = g_numAllocs, numAllocBytes = g_numAllocBytes;
+    const double start = benchNow();
+
+    for (int i = 0; i < iterations; ++i)
+        proc(ctx);
+
+    const double elapsed = benchNow() - start;
+
+    printf(
+        "%s    { \"name\": \"%s\", \"iterations\": %d, \"ns_per_op\": %.1f, \"allocs_per_op\": %.2f, \"alloc_bytes_per_op\": %.1f }",
+        (*first ? "" : ",\n"), name, iterations, elapsed / iterations,
+        (double)(g_numAllocs - numAllocs) / iterations, (double)(g_numAllocBytes - numAllocBytes) / iterations
+    );
+    *first = 0;
+}
+
+int main(int argc, char** argv)
+{
+    const int iterations = (argc > 1 ? atoi(argv[1]) : 1000);
+
+    if (iterations <= 0 || !createHeadlessContext())
+    {
+        fprintf(stderr, "failed to create headless OpenGL context\n");
+        return 1;
+    }
+
+    BenchContext* ctx = (BenchContext*)calloc(1, sizeof(BenchContext));
+    if (ctx == NULL)
+        return 1;
+
+    MGLFormattingOptions defaultFmt = { ' ', 1, 200, MGLFormattingOrderDefault, 1, NULL, 0, NULL, NULL, MGLFormattingOutputText };
+    ctx->fmt = defaultFmt;
+
+    MGLAllocator arenaAllocator = { benchArenaAllocate, benchArenaReallocate, NULL, &(ctx->arena) };
+    ctx->allocator  = arenaAllocator;
+    ctx->arena.cap  = 4u << 20;
+    ctx->arena.buf  = (char*)malloc(ctx->arena.cap);
+    if (ctx->arena.buf == NULL)
+    {
+        free(ctx);
+        return 1;
+    }
+
+    mglQueryImplementationLimits(&(ctx->limits));
+    mglQueryRenderState(&(ctx->rs));
+    mglQueryBindingPoints(&(ctx->bp));
+
+    // Typical invariants that are checked around draw calls
+    const MGLWatchEntry watchEntries[] =
+    {
+        { GL_BLEND, -1 }, { GL_DEPTH_TEST, -1 }, { GL_CULL_FACE, -1 }, { GL_SCISSOR_TEST, -1 }, { GL_VIEWPORT, -1 },
+        { GL_CURRENT_PROGRAM, -1 }, { GL_VERTEX_ARRAY_BINDING, -1 }, { GL_DRAW_FRAMEBUFFER_BINDING, -1 }, { GL_ACTIVE_TEXTURE, -1 }, { GL_UNIFORM_BUFFER_BINDING, 0 },
+    };
+    ctx->watch = mglCompileWatchList(watchEntries, sizeof(watchEntries)/sizeof(watchEntries[0]));
+
+    // Determine output sizes once
+    MGLString rsStr = mglPrintRenderState(&(ctx->rs), NULL);
+    MGLString bpStr = mglPrintBindingPoints(&(ctx->bp), NULL);
+
+    printf("{\n");
+    printf("  \"gl_vendor\": \"%s\",\n", (const char*)glGetString(GL_VENDOR));
+    printf("  \"gl_renderer\": \"%s\",\n", (const char*)glGetString(GL_RENDERER));
+    printf("  \"gl_version\": \"%s\",\n", (const char*)glGetString(GL_VERSION));
+    printf("  \"render_state_print_bytes\": %zu,\n", strlen(mglGetUTF8String(rsStr)));
+    printf("  \"binding_points_print_bytes\": %zu,\n", strlen(mglGetUTF8String(bpStr)));
+    printf("  \"results\": [\n");
+
+    mglFreeString(rsStr);
+    mglFreeString(bpStr);
+
+    int first = 1;
+
+    runBench("query_render_state", benchQueryRenderState, ctx, iterations, &first);
+    runBench("query_render_state_with_limits", benchQueryRenderStateWithLimits, ctx, iterations, &first);
+    runBench("query_binding_points", benchQueryBindingPoints, ctx, iterations, &first);
+    runBench("query_watch_list", benchQueryWatchList, ctx, iterations, &first);
+    runBench("print_render_state", benchPrintRenderState, ctx, iterations, &first);
+    runBench("print_render_state_into", benchPrintRenderStateInto, ctx, iterations, &first);
+    runBench("print_binding_points", benchPrintBindingPoints, ctx, iterations, &first);
+
+    ctx->fmt.order = MGLFormattingOrderSorted;
+    runBench("print_render_state_sorted", benchPrintRenderState, ctx, iterations, &first);
+
+    ctx->fmt.order  = MGLFormattingOrderDefault;
+    ctx->fmt.filter = "BLEND";
+    runBench("print_render_state_filtered", benchPrintRenderState, ctx, iterations, &first);
+
+    ctx->fmt.filter = NULL;
+    ctx->fmt.output = MGLFormattingOutputJSON;
+    runBench("print_render_state_json", benchPrintRenderStateInto, ctx, iterations, &first);
+
+    ctx->fmt.output = MGLFormattingOutputKeyValue;
+    runBench("print_render_state_key_value", benchPrintRenderStateInto, ctx, iterations, &first);
+
+    ctx->fmt.output     = MGLFormattingOutputText;
+    ctx->fmt.allocator  = &(ctx->allocator);
+    runBench("print_render_state_arena", benchPrintRenderStateArena, ctx, iterations, &first);
+
+    printf("\n  ]\n}\n");
+
+    mglFreeString(ctx->reuse);
+    mglFreeWatchList(ctx->watch);
+    free(ctx->arena.buf);
+    free(ctx);
+
+    return 0;
+}
@@ -12,9 +12,21 @@
  *  - v1.03 (14/01/2024): Added missing GL states: GL_POLYGON_MODE, GL_FRONT_FACE, GL_PATCH_*, GL_CLIP_*
  *
  * USAGE EXAMPLE:
- *  // Optionally enable glGetIntegeri_v and glGetInteger64i_v
- *  #define MENTAL_GL_GETINTEGERI_V
- *  #define MENTAL_GL_GETINTEGER64I_V
+ *  // Optionally specialize for a range of GL versions, encoded as MAJOR*10+MINOR (e.g. 45 for GL 4.5). States above the maximum version are stripped
+ *  // at compile time, and the version checks of all states up to the minimum version are removed. Indexed states are queried with glGetIntegeri_v
+ *  // and glGetInteger64i_v whenever the GL version is at least 3.0 and 3.2 respectively.
+ *  #define MENTAL_GL_MIN_VERSION 45
+ *  #define MENTAL_GL_MAX_VERSION 45
+ *
+ *  // Optionally query per-unit texture bindings with glGetIntegeri_v on GL 4.5 instead of switching the active texture unit.
+ *  // Not all drivers support indexed GL_TEXTURE_BINDING_* queries, so only enable this if the target drivers do
+ *  #define MENTAL_GL_INDEXED_TEXTURE_BINDINGS
+ *
+ *  // Optionally enable the background print queue (requires pthreads on non-Windows platforms)
+ *  #define MENTAL_GL_PRINT_QUEUE
+ *
+ *  // Optionally enable wall time measurement for MGLQueryStats (requires clock_gettime on non-Windows platforms)
+ *  #define MENTAL_GL_QUERY_STATS
  *
  *  // Include and implement MentalGL in a single source file
  *  #define MENTAL_GL_IMPLEMENTATION
@@ -26,14 +38,30 @@
  *  MGLRenderState rs;
  *  mglQueryRenderState(&rs);
  *
+ *  // Alternatively, query implementation limits only once per context and reuse them for subsequent queries
+ *  MGLImplementationLimits limits;
+ *  mglQueryImplementationLimits(&limits);
+ *  mglQueryRenderStateWithLimits(&rs, &limits);
+ *
  *  // Print queried OpenGL state (ignore optional formatting descriptor, otherwise see 'MGLFormattingOptions' structure)
  *  MGLString s = mglPrintRenderState(&rs, NULL);
  *
  *  // Print result
  *  puts(mglGetUTF8String(s));
  *
+ *  // Alternatively, print into the same string object again to avoid further memory allocations
+ *  s = mglPrintRenderStateInto(s, &rs, NULL);
+ *
  *  // Free opaque string object
  *  mglFreeString(s);
+ *
+ * THREADING:
+ *  The query functions must be called on the thread that has the GL context bound. All other functions never call into GL and only read
+ *  the specified state structures, so a queried MGLRenderState can be copied and printed on any thread, as long as each thread uses its own
+ *  output string and capture object. Filter objects can be shared between threads. The print queue (MENTAL_GL_PRINT_QUEUE) takes a copy of
+ *  the state on the GL thread and does all formatting on a background thread.
+ *  MentalGL has no mutable global state, so all functions are reentrant. With several GL contexts on several threads, create one context
+ *  object (mglCreateContext) per GL context on its thread, which keeps the limits cache, shadow state, and statistics of that GL context.
  */
 
 #ifndef MENTAL_GL_H
@@ -56,6 +84,19 @@
 #define MGL_MAX_VERTEX_BUFFER_BINDINGS              ( 32 )
 #define MGL_MAX_TEXTURE_LAYERS                      ( 32 )
 
+#define MGL_PACKED_RENDER_STATE_FLAG_WORDS          ( 1 )
+#define MGL_PACKED_RENDER_STATE_HOT_WORDS           ( 107 )
+#define MGL_PACKED_RENDER_STATE_COLD_WORDS          ( 515 )
+
+// Number of GL version blocks in MGLQueryStats, i.e. GL_VERSION_1_0 to GL_VERSION_4_6.
+#define MGL_QUERY_STATS_VERSIONS                    ( 19 )
+
+// Number of cost tiers in MGLTransitionCost and MGLTransitionWeights (see MGLTransitionTier).
+#define MGL_TRANSITION_TIERS                        ( 7 )
+
+// Offset value of MGLFieldDescriptor for fields that have no such offset.
+#define MGL_FIELD_NO_OFFSET                         ( (size_t)~0 )
+
 
 // *****************************************************************
 //      PUBLIC ENUMERATIONS
@@ -68,14 +109,155 @@ enum MGLFormattingOrder
     MGLFormattingOrderSorted,
 };
 
+// Query formatting output.
+enum MGLFormattingOutput
+{
+    MGLFormattingOutputText,        // Human readable lines with aligned values and GL version headlines.
+    MGLFormattingOutputJSON,        // JSON object with one member per parameter. Enumerations and bitfields are objects with a numeric "value" and a "name" member.
+    MGLFormattingOutputKeyValue,    // One "pname=value" record per line with comma separated arrays. Enumerations and bitfields have an additional "pname.name=name" record.
+};
+
+// Render state categories. Can be combined as bitmask to select which states are queried and printed.
+enum MGLStateCategory
+{
+    MGLStateCategoryBlend           = (1 << 0),     // Blending, logic operation, color write mask, and dithering.
+    MGLStateCategoryDepthStencil    = (1 << 1),     // Depth and stencil test states.
+    MGLStateCategoryRasterizer      = (1 << 2),     // Viewport, scissor, culling, polygon, line, point, multi-sampling, and clip control states.
+    MGLStateCategoryPixelStore      = (1 << 3),     // Pixel pack and unpack states.
+    MGLStateCategoryBufferBindings  = (1 << 4),     // Buffer bindings except the vertex array object bindings.
+    MGLStateCategoryProgram         = (1 << 5),     // Shader program and program pipeline bindings.
+    MGLStateCategoryVertexBindings  = (1 << 6),     // Vertex array object, vertex buffer bindings, primitive restart, and patch states.
+    MGLStateCategoryLimits          = (1 << 7),     // Implementation dependent limits and context information (see MGLImplementationLimits).
+    MGLStateCategoryFramebuffer     = (1 << 8),     // Framebuffer bindings, draw and read buffers, and clear color.
+    MGLStateCategoryTextures        = (1 << 9),     // Texture and sampler bindings.
+    MGLStateCategoryHints           = (1 << 10),    // Implementation hints.
+    MGLStateCategoryMisc            = (1 << 11),    // All remaining states.
+    MGLStateCategoryAll             = 0x0FFF,       // All render state categories.
+};
+
+// Render state field types. Each type determines how a field is queried and printed.
+enum MGLFieldType
+{
+    MGLFieldTypeInteger,            // GLint, queried with glGetIntegerv.
+    MGLFieldTypeUInteger,           // GLint, queried with glGetIntegerv and printed as unsigned integer.
+    MGLFieldTypeIntegerHex,         // GLint, queried with glGetIntegerv and printed in hexadecimal.
+    MGLFieldTypeBoolean,            // GLboolean, queried with glGetBooleanv.
+    MGLFieldTypeEnum,               // GLint, queried with glGetIntegerv and printed as enum name.
+    MGLFieldTypeBitfield,           // GLint, queried with glGetIntegerv and printed as combination of bit names.
+    MGLFieldTypeInteger64,          // GLint64, queried with glGetInteger64v.
+    MGLFieldTypeFloat,              // GLfloat, queried with glGetFloatv.
+    MGLFieldTypeDouble,             // GLdouble, queried with glGetDoublev.
+    MGLFieldTypeIntegerArray,       // GLint array, queried with glGetIntegerv.
+    MGLFieldTypeIntegerArrayHex,    // GLint array, queried with glGetIntegerv and printed in hexadecimal if 'MGLFormattingOptions::enable_hex' is set.
+    MGLFieldTypeEnumArray,          // GLint array, queried with glGetIntegerv and printed as enum names.
+    MGLFieldTypeInteger64Array,     // GLint64 array, queried with glGetInteger64v.
+    MGLFieldTypeFloatArray,         // GLfloat array, queried with glGetFloatv.
+    MGLFieldTypeDoubleArray,        // GLdouble array, queried with glGetDoublev.
+    MGLFieldTypeBooleanArray,       // GLboolean array, queried with glGetBooleanv.
+};
+
+// Render state field flags.
+enum MGLFieldFlags
+{
+    MGLFieldFlagIndexed = (1 << 0), // Field is queried per element with glGetIntegeri_v or glGetInteger64i_v. Only available for GL 3.0 or GL 3.2 and later respectively.
+                                    // Only the elements within the implementation limit (e.g. GL_MAX_UNIFORM_BUFFER_BINDINGS) are queried, all others remain zero.
+};
+
+// Context object flags.
+enum MGLContextFlags
+{
+    MGLContextFlagShadowState   = (1 << 0), // Context owns a shadow state, which replaces all glGet calls of the context queries (see MGLShadowState).
+    MGLContextFlagQueryStats    = (1 << 1), // Context accumulates the query statistics of all context queries (see MGLQueryStats).
+};
+
+// State transition cost tiers, used as indices into MGLTransitionCost and MGLTransitionWeights. Each field is assigned to a tier by its state category unless noted otherwise.
+enum MGLTransitionTier
+{
+    MGLTransitionTierFramebuffer,       // Framebuffer bindings, draw and read buffers (MGLStateCategoryFramebuffer, except the clear color).
+    MGLTransitionTierProgram,           // Shader program and program pipeline bindings (MGLStateCategoryProgram).
+    MGLTransitionTierVertexBindings,    // Vertex array object, element buffer, and vertex buffer bindings (MGLStateCategoryVertexBindings).
+    MGLTransitionTierTextures,          // Texture and sampler bindings (MGLStateCategoryTextures and all binding points).
+    MGLTransitionTierUniformBuffers,    // Uniform and shader storage buffer bindings and ranges.
+    MGLTransitionTierFixedFunction,     // Blend, depth-stencil, and rasterizer states (MGLStateCategoryBlend, MGLStateCategoryDepthStencil, and MGLStateCategoryRasterizer).
+    MGLTransitionTierOther,             // All remaining states except implementation dependent limits and GL_TIMESTAMP.
+};
+
+// GPU object types as reported by mglQueryObjects.
+enum MGLObjectType
+{
+    MGLObjectTypeBuffer,
+    MGLObjectTypeTexture,
+    MGLObjectTypeRenderbuffer,
+};
+
+// Texture targets of the binding points, in the same order as the fields of mglGetBindingPointsFields.
+enum MGLTextureTarget
+{
+    MGLTextureTarget1D                  = (1 << 0),     // GL_TEXTURE_BINDING_1D
+    MGLTextureTarget1DArray             = (1 << 1),     // GL_TEXTURE_BINDING_1D_ARRAY
+    MGLTextureTarget2D                  = (1 << 2),     // GL_TEXTURE_BINDING_2D
+    MGLTextureTarget2DArray             = (1 << 3),     // GL_TEXTURE_BINDING_2D_ARRAY
+    MGLTextureTarget2DMultisample       = (1 << 4),     // GL_TEXTURE_BINDING_2D_MULTISAMPLE
+    MGLTextureTarget2DMultisampleArray  = (1 << 5),     // GL_TEXTURE_BINDING_2D_MULTISAMPLE_ARRAY
+    MGLTextureTarget3D                  = (1 << 6),     // GL_TEXTURE_BINDING_3D
+    MGLTextureTargetBuffer              = (1 << 7),     // GL_TEXTURE_BINDING_BUFFER
+    MGLTextureTargetCubeMap             = (1 << 8),     // GL_TEXTURE_BINDING_CUBE_MAP
+    MGLTextureTargetRectangle           = (1 << 9),     // GL_TEXTURE_BINDING_RECTANGLE
+    MGLTextureTargetAll                 = 0x03FF,       // All texture targets.
+};
+
 
 // *****************************************************************
 //      PUBLIC STRUCTURES
 // *****************************************************************
 
-// Opaque string object used as result mglPrintRenderState.
+// Opaque string object used as result mglPrintRenderState. Can be reused as output for mglPrintRenderStateInto.
 typedef void* MGLString;
 
+// Opaque filter object used as result of mglCompileFilter.
+typedef void* MGLFilter;
+
+// Opaque capture object used as result of mglCreateCapture.
+typedef void* MGLCapture;
+
+// Opaque print queue object used as result of mglCreatePrintQueue.
+typedef void* MGLPrintQueue;
+
+// Opaque state store object used as result of mglCreateStateStore.
+typedef void* MGLStateStore;
+
+// Opaque redundancy counter object used as result of mglCreateRedundancyCounter.
+typedef void* MGLRedundancyCounter;
+
+// Opaque context object used as result of mglCreateContext.
+typedef void* MGLContext;
+
+// Opaque watch list object used as result of mglCompileWatchList.
+typedef void* MGLWatchList;
+
+// Filter descriptor structure (see mglCompileFilter).
+typedef struct MGLFilterDescriptor
+{
+    const char* const*      patterns;       // Optional array of substrings. Parameters which contain any of these strings are selected. By default NULL.
+    size_t                  num_patterns;   // Number of entries in 'patterns'. By default 0.
+    const GLenum*           pnames;         // Optional array of parameter names (e.g. GL_BLEND). Parameters with any of these names are selected. By default NULL.
+    size_t                  num_pnames;     // Number of entries in 'pnames'. By default 0.
+    unsigned                categories;     // Bitwise OR of MGLStateCategory flags to only select parameters of these categories, or 0 for all categories. By default 0.
+}
+MGLFilterDescriptor;
+
+// Runtime allocator structure. All callbacks receive 'user_data' as first argument, e.g. to allocate from a per-thread arena.
+// If an allocation fails, the print functions stop writing and return the output up to that point, or NULL if the output string object itself cannot be allocated.
+// Objects of the mglCreate* and mglCompile* functions always use MGL_CALLOC and MGL_FREE, except for context objects (see MGLContextDescriptor::allocator).
+typedef struct MGLAllocator
+{
+    void*   (*allocate)(void* user_data, size_t size);                                  // Allocates 'size' bytes of memory, or returns NULL on failure. Must not be null.
+    void*   (*reallocate)(void* user_data, void* ptr, size_t old_size, size_t new_size);  // Optional reallocation of the memory block 'ptr', which remains valid if NULL is returned. If null, a new block is allocated and copied. By default NULL.
+    void    (*release)(void* user_data, void* ptr, size_t size);                        // Optional release of the memory block 'ptr' with 'size' bytes. Can be null for arenas. By default NULL.
+    void*   user_data;                                                                  // User data pointer for all callbacks. By default NULL.
+}
+MGLAllocator;
+
 // Query formatting descriptor structure.
 typedef struct MGLFormattingOptions
 {
@@ -85,6 +267,10 @@ typedef struct MGLFormattingOptions
     enum MGLFormattingOrder order;          // Specifies the formatting order (if sorted for instance). By default MGLFormattingOrderDefault.
     int                     enable_hex;     // Specifies whether unknown enumerations shall be printed as hex codes (if != 0). By default 1.
     const char*             filter;         // Optional filter to only output parameters which contain this string. By default NULL.
+    unsigned                categories;     // Bitwise OR of MGLStateCategory flags to only output parameters of these categories, or 0 for all categories. By default 0.
+    MGLFilter               compiled_filter;// Optional compiled filter to only output the selected parameters. Headlines are omitted if specified. By default NULL.
+    const MGLAllocator*     allocator;      // Optional allocator for the output string. It is copied into the output string, which keeps using it for 'reuse'. By default NULL.
+    enum MGLFormattingOutput output;        // Specifies the output format of mglPrintRenderState* and mglPrintBindingPoints*. Other print functions always output text. By default MGLFormattingOutputText.
 }
 MGLFormattingOptions;
 
@@ -327,6 +513,171 @@ typedef struct MGLRenderState
 }
 MGLRenderState;
 
+// Implementation dependent limits. These values never change for the lifetime of a GL context.
+typedef struct MGLImplementationLimits
+{
+    GLfloat     fAliasedLineWidthRange[2];                                                      // GL_ALIASED_LINE_WIDTH_RANGE
+    GLint       iCompressedTextureFormats[MGL_MAX_COMPRESSED_TEXTURE_FORMATS];                  // GL_COMPRESSED_TEXTURE_FORMATS
+    GLint       iContextFlags;                                                                  // GL_CONTEXT_FLAGS
+    GLint       iLayerProvokingVertex;                                                          // GL_LAYER_PROVOKING_VERTEX
+    GLint       iMajorVersion;                                                                  // GL_MAJOR_VERSION
+    GLint       iMax3DTextureSize;                                                              // GL_MAX_3D_TEXTURE_SIZE
+    GLint       iMaxArrayTextureLayers;                                                         // GL_MAX_ARRAY_TEXTURE_LAYERS
+    GLint       iMaxClipDistances;                                                              // GL_MAX_CLIP_DISTANCES
+    GLint       iMaxColorTextureSamples;                                                        // GL_MAX_COLOR_TEXTURE_SAMPLES
+    GLint       iMaxCombinedAtomicCounters;                                                     // GL_MAX_COMBINED_ATOMIC_COUNTERS
+    GLint       iMaxCombinedComputeUniformComponents;                                           // GL_MAX_COMBINED_COMPUTE_UNIFORM_COMPONENTS
+    GLint       iMaxCombinedFragmentUniformComponents;                                          // GL_MAX_COMBINED_FRAGMENT_UNIFORM_COMPONENTS
+    GLint       iMaxCombinedGeometryUniformComponents;                                          // GL_MAX_COMBINED_GEOMETRY_UNIFORM_COMPONENTS
+    GLint       iMaxCombinedShaderStorageBlocks;                                                // GL_MAX_COMBINED_SHADER_STORAGE_BLOCKS
+    GLint       iMaxCombinedTextureImageUnits;                                                  // GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS
+    GLint       iMaxCombinedUniformBlocks;                                                      // GL_MAX_COMBINED_UNIFORM_BLOCKS
+    GLint       iMaxCombinedVertexUniformComponents;                                            // GL_MAX_COMBINED_VERTEX_UNIFORM_COMPONENTS
+    GLint       iMaxComputeAtomicCounters;                                                      // GL_MAX_COMPUTE_ATOMIC_COUNTERS
+    GLint       iMaxComputeAtomicCounterBuffers;                                                // GL_MAX_COMPUTE_ATOMIC_COUNTER_BUFFERS
+    GLint       iMaxComputeShaderStorageBlocks;                                                 // GL_MAX_COMPUTE_SHADER_STORAGE_BLOCKS
+    GLint       iMaxComputeTextureImageUnits;                                                   // GL_MAX_COMPUTE_TEXTURE_IMAGE_UNITS
+    GLint       iMaxComputeUniformBlocks;                                                       // GL_MAX_COMPUTE_UNIFORM_BLOCKS
+    GLint       iMaxComputeUniformComponents;                                                   // GL_MAX_COMPUTE_UNIFORM_COMPONENTS
+    GLint       iMaxComputeWorkGroupCount[3];                                                   // GL_MAX_COMPUTE_WORK_GROUP_COUNT
+    GLint       iMaxComputeWorkGroup;                                                           // GL_MAX_COMPUTE_WORK_GROUP_INVOCATIONS
+    GLint       iMaxComputeWorkGroupSize[3];                                                    // GL_MAX_COMPUTE_WORK_GROUP_SIZE
+    GLint       iMaxCubeMapTextureSize;                                                         // GL_MAX_CUBE_MAP_TEXTURE_SIZE
+    GLint       iMaxDebugGroupStackDepth;                                                       // GL_MAX_DEBUG_GROUP_STACK_DEPTH
+    GLint       iMaxDepthTextureSamples;                                                        // GL_MAX_DEPTH_TEXTURE_SAMPLES
+    GLint       iMaxDrawBuffers;                                                                // GL_MAX_DRAW_BUFFERS
+    GLint       iMaxDualSourceDrawBuffers;                                                      // GL_MAX_DUAL_SOURCE_DRAW_BUFFERS
+    GLint       iMaxElementIndex;                                                               // GL_MAX_ELEMENT_INDEX
+    GLint       iMaxElementsIndices;                                                            // GL_MAX_ELEMENTS_INDICES
+    GLint       iMaxElementsVertices;                                                           // GL_MAX_ELEMENTS_VERTICES
+    GLint       iMaxFragmentAtomicCounters;                                                     // GL_MAX_FRAGMENT_ATOMIC_COUNTERS
+    GLint       iMaxFragmentShaderStorageBlocks;                                                // GL_MAX_FRAGMENT_SHADER_STORAGE_BLOCKS
+    GLint       iMaxFragmentInputComponents;                                                    // GL_MAX_FRAGMENT_INPUT_COMPONENTS
+    GLint       iMaxFragmentUniformComponents;                                                  // GL_MAX_FRAGMENT_UNIFORM_COMPONENTS
+    GLint       iMaxFragmentUniformVectors;                                                     // GL_MAX_FRAGMENT_UNIFORM_VECTORS
+    GLint       iMaxFragmentUniformBlocks;                                                      // GL_MAX_FRAGMENT_UNIFORM_BLOCKS
+    GLint       iMaxFramebufferWidth;                                                           // GL_MAX_FRAMEBUFFER_WIDTH
+    GLint       iMaxFramebufferHeight;                                                          // GL_MAX_FRAMEBUFFER_HEIGHT
+    GLint       iMaxFramebufferLayers;                                                          // GL_MAX_FRAMEBUFFER_LAYERS
+    GLint       iMaxFramebufferSamples;                                                         // GL_MAX_FRAMEBUFFER_SAMPLES
+    GLint       iMaxGeometryAtomicCounters;                                                     // GL_MAX_GEOMETRY_ATOMIC_COUNTERS
+    GLint       iMaxGeometryShaderStorageBlocks;                                                // GL_MAX_GEOMETRY_SHADER_STORAGE_BLOCKS
+    GLint       iMaxGeometryInputComponents;                                                    // GL_MAX_GEOMETRY_INPUT_COMPONENTS
+    GLint       iMaxGeometryOutputComponents;                                                   // GL_MAX_GEOMETRY_OUTPUT_COMPONENTS
+    GLint       iMaxGeometryTextureImageUnits;                                                  // GL_MAX_GEOMETRY_TEXTURE_IMAGE_UNITS
+    GLint       iMaxGeometryUniformBlocks;                                                      // GL_MAX_GEOMETRY_UNIFORM_BLOCKS
+    GLint       iMaxGeometryUniformComponents;                                                  // GL_MAX_GEOMETRY_UNIFORM_COMPONENTS
+    GLint       iMaxIntegerSamples;                                                             // GL_MAX_INTEGER_SAMPLES
+    GLint       iMaxLabelLength;                                                                // GL_MAX_LABEL_LENGTH
+    GLint       iMaxProgramTexelOffest;                                                         // GL_MAX_PROGRAM_TEXEL_OFFSET
+    GLint       iMaxRectangleTextureSize;                                                       // GL_MAX_RECTANGLE_TEXTURE_SIZE
+    GLint       iMaxRenderbufferSize;                                                           // GL_MAX_RENDERBUFFER_SIZE
+    GLint       iMaxSampleMaskWords;                                                            // GL_MAX_SAMPLE_MASK_WORDS
+    GLint       iMaxServerWaitTimeout;                                                          // GL_MAX_SERVER_WAIT_TIMEOUT
+    GLint       iMaxShaderStorageBufferBindings;                                                // GL_MAX_SHADER_STORAGE_BUFFER_BINDINGS
+    GLint       iMaxTessControlAtomicCounters;                                                  // GL_MAX_TESS_CONTROL_ATOMIC_COUNTERS
+    GLint       iMaxTessControlShaderStorageBlocks;                                             // GL_MAX_TESS_CONTROL_SHADER_STORAGE_BLOCKS
+    GLint       iMaxTessEvaluationAtomicCounters;                                               // GL_MAX_TESS_EVALUATION_ATOMIC_COUNTERS
+    GLint       iMaxTessEvaluationShaderStorageBlocks;                                          // GL_MAX_TESS_EVALUATION_SHADER_STORAGE_BLOCKS
+    GLint       iMaxTextureBufferSize;                                                          // GL_MAX_TEXTURE_BUFFER_SIZE
+    GLint       iMaxTextureImageUnits;                                                          // GL_MAX_TEXTURE_IMAGE_UNITS
+    GLfloat     fMaxTextureLODBias;                                                             // GL_MAX_TEXTURE_LOD_BIAS
+    GLint       iMaxTextureSize;                                                                // GL_MAX_TEXTURE_SIZE
+    GLint       iMaxTransformFeedbackBuffers;                                                   // GL_MAX_TRANSFORM_FEEDBACK_BUFFERS
+    GLint       iMaxUniformBufferBindings;                                                      // GL_MAX_UNIFORM_BUFFER_BINDINGS
+    GLint       iMaxUniformBlockSize;                                                           // GL_MAX_UNIFORM_BLOCK_SIZE
+    GLint       iMaxUniformLocations;                                                           // GL_MAX_UNIFORM_LOCATIONS
+    GLint       iMaxVaryingComponents;                                                          // GL_MAX_VARYING_COMPONENTS
+    GLint       iMaxVaryingVectors;                                                             // GL_MAX_VARYING_VECTORS
+    GLint       iMaxVaryingFloats;                                                              // GL_MAX_VARYING_FLOATS
+    GLint       iMaxVertexAtomicCounters;                                                       // GL_MAX_VERTEX_ATOMIC_COUNTERS
+    GLint       iMaxVertexAttribRelativeOffset;                                                 // GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET
+    GLint       iMaxVertexAttribBindings;                                                       // GL_MAX_VERTEX_ATTRIB_BINDINGS
+    GLint       iMaxVertexAttribs;                                                              // GL_MAX_VERTEX_ATTRIBS
+    GLint       iMaxVertexOutputComponents;                                                     // GL_MAX_VERTEX_OUTPUT_COMPONENTS
+    GLint       iMaxVertexShaderStorageBlocks;                                                  // GL_MAX_VERTEX_SHADER_STORAGE_BLOCKS
+    GLint       iMaxVertexTextureImageUnits;                                                    // GL_MAX_VERTEX_TEXTURE_IMAGE_UNITS
+    GLint       iMaxVertexUniformBlocks;                                                        // GL_MAX_VERTEX_UNIFORM_BLOCKS
+    GLint       iMaxVertexUniformComponents;                                                    // GL_MAX_VERTEX_UNIFORM_COMPONENTS
+    GLint       iMaxVertexUniformVectors;                                                       // GL_MAX_VERTEX_UNIFORM_VECTORS
+    GLint       iMaxViewportDims[2];                                                            // GL_MAX_VIEWPORT_DIMS
+    GLint       iMaxViewports;                                                                  // GL_MAX_VIEWPORTS
+    GLint       iMinMapBufferAlignment;                                                         // GL_MIN_MAP_BUFFER_ALIGNMENT
+    GLint       iMinProgramTexelOffest;                                                         // GL_MIN_PROGRAM_TEXEL_OFFSET
+    GLint       iMinorVersion;                                                                  // GL_MINOR_VERSION
+    GLint       iNumCompressedTextureFormats;                                                   // GL_NUM_COMPRESSED_TEXTURE_FORMATS
+    GLint       iNumExtensions;                                                                 // GL_NUM_EXTENSIONS
+    GLint       iNumProgramBinaryFormats;                                                       // GL_NUM_PROGRAM_BINARY_FORMATS
+    GLint       iNumShaderBinaryFormats;                                                        // GL_NUM_SHADER_BINARY_FORMATS
+    GLint       iProgramBinaryFormats[MGL_MAX_PROGRAM_BINARY_FORMATS];                          // GL_PROGRAM_BINARY_FORMATS
+    GLfloat     fPointSizeGranularity;                                                          // GL_POINT_SIZE_GRANULARITY
+    GLfloat     fPointSizeRange[2];                                                             // GL_POINT_SIZE_RANGE
+    GLboolean   bShaderCompiler;                                                                // GL_SHADER_COMPILER
+    GLint       iShaderBinaryFormats[MGL_MAX_SHADER_BINARY_FORMATS];                            // GL_SHADER_BINARY_FORMATS
+    GLint       iShaderStorageBufferOffsetAlignment;                                            // GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT
+    GLfloat     fSmoothLineWidthRange[2];                                                       // GL_SMOOTH_LINE_WIDTH_RANGE
+    GLfloat     fSmoothLineWidthGranularity;                                                    // GL_SMOOTH_LINE_WIDTH_GRANULARITY
+    GLint       iSubPixelBits;                                                                  // GL_SUBPIXEL_BITS
+    GLint       iTextureBufferOffsetAlignment;                                                  // GL_TEXTURE_BUFFER_OFFSET_ALIGNMENT
+    GLint       iUniformBufferOffsetAlignment;                                                  // GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT
+    GLint       iViewportBoundsRange[2];                                                        // GL_VIEWPORT_BOUNDS_RANGE
+    GLint       iViewportIndexProvokingVertex;                                                  // GL_VIEWPORT_INDEX_PROVOKING_VERTEX
+    GLint       iViewportSubPixelBits;                                                          // GL_VIEWPORT_SUBPIXEL_BITS
+}
+MGLImplementationLimits;
+
+// Packed render state for bulk storage (see mglPackRenderState). Implementation dependent limits are omitted and all boolean states are packed into bits.
+// The version, flags, and hot states are contiguous, so frequently changing states can be compared or hashed without touching the cold states.
+// The layout of the state words may change between library versions; use mglUnpackRenderState to access individual states.
+typedef struct MGLPackedRenderState
+{
+    GLint   iMajorVersion;                              // GL_MAJOR_VERSION
+    GLint   iMinorVersion;                              // GL_MINOR_VERSION
+    GLuint  flags[MGL_PACKED_RENDER_STATE_FLAG_WORDS];  // All boolean states, one bit per element.
+    GLuint  hot[MGL_PACKED_RENDER_STATE_HOT_WORDS];     // Blend, depth-stencil, rasterizer, program, texture, framebuffer, and all non-indexed buffer and vertex bindings.
+    GLuint  cold[MGL_PACKED_RENDER_STATE_COLD_WORDS];   // Indexed buffer and vertex bindings, pixel store states, hints, and all remaining states.
+}
+MGLPackedRenderState;
+
+// Statistics of the queries of all fields of a single GL version.
+typedef struct MGLQueryStatsVersion
+{
+    unsigned long long  num_get_calls;  // Number of glGet* calls.
+    double              time;           // Wall time (in seconds) of all glGet* calls. Only measured if MENTAL_GL_QUERY_STATS is defined.
+}
+MGLQueryStatsVersion;
+
+// Query statistics that are accumulated by all queries they are passed to (see MGLQueryOptions and MGLBindingPointsQueryOptions). Must be zero initialized.
+typedef struct MGLQueryStats
+{
+    unsigned long long      num_queries;                        // Number of queries.
+    unsigned long long      num_get_calls;                      // Number of glGet* calls, incl. queries of the context version.
+    unsigned long long      num_active_texture_calls;           // Number of glActiveTexture calls.
+    double                  time;                               // Wall time (in seconds) of all queries. Only measured if MENTAL_GL_QUERY_STATS is defined.
+    MGLQueryStatsVersion    versions[MGL_QUERY_STATS_VERSIONS]; // Statistics for the fields of each GL version, from GL_VERSION_1_0 in versions[0] to GL_VERSION_4_6 in versions[18].
+}
+MGLQueryStats;
+
+// Render state query descriptor structure.
+typedef struct MGLQueryOptions
+{
+    unsigned                        categories; // Bitwise OR of MGLStateCategory flags to only query states of these categories, or 0 for all categories. By default 0.
+    const MGLImplementationLimits*  limits;     // Optional cached implementation limits. If non-null, they are copied regardless of 'categories'. By default NULL.
+    const struct MGLShadowState*    shadow;     // Optional shadow state. If non-null, the states of the selected categories are copied from the shadow state without any glGet calls. By default NULL.
+    MGLQueryStats*                  stats;      // Optional query statistics. If non-null, the costs of this query are added to it. By default NULL.
+    const MGLAllocator*             allocator;  // Optional allocator for temporary buffers. By default NULL.
+}
+MGLQueryOptions;
+
+// Binding points query descriptor structure.
+typedef struct MGLBindingPointsQueryOptions
+{
+    unsigned        targets;    // Bitwise OR of MGLTextureTarget flags to only query these texture targets, or 0 for all targets. By default 0.
+    GLuint          units;      // Bitwise OR of (1 << i) to only query the texture units GL_TEXTURE0 + i, or 0 for all units. By default 0.
+    MGLQueryStats*  stats;      // Optional query statistics. If non-null, the costs of this query are added to it. By default NULL.
+}
+MGLBindingPointsQueryOptions;
+
 typedef struct MGLBindingPoints
 {
     GLint iTextureBinding1D[MGL_MAX_TEXTURE_LAYERS];                    // GL_TEXTURE_BINDING_1D
@@ -342,6 +693,124 @@ typedef struct MGLBindingPoints
 }
 MGLBindingPoints;
 
+// Shadow render state, which is updated by the mglShadow* wrapper functions so the render state can be retrieved without any glGet calls.
+// States that are changed by other means than the wrapper functions are only updated by mglSyncShadowState or a periodic verification.
+typedef struct MGLShadowState
+{
+    MGLImplementationLimits limits;         // Implementation dependent limits. Queried once by mglInitShadowState.
+    MGLRenderState          render_state;   // Shadow copy of the render state.
+    MGLBindingPoints        binding_points; // Shadow copy of the binding points.
+    GLint                   sampler_bindings[MGL_MAX_TEXTURE_LAYERS];   // Shadow copy of the sampler bindings of the texture units [GL_TEXTURE0 .. GL_TEXTURE31].
+    GLint                   stencil_bits;   // Number of stencil bits of the bound draw framebuffer, which the stencil reference values are clamped to.
+    unsigned                verify_interval;// Number of frames between two verifications against the actual GL state, or 0 to disable verification.
+    unsigned                frame;          // Frame counter, incremented by mglShadowNextFrame.
+    unsigned                num_mismatches; // Number of verifications so far where the shadow state diverged from the actual GL state.
+    MGLRedundancyCounter    redundancy;     // Optional redundancy counter. If non-null, the wrapper functions count all calls that only set values which are already current. By default NULL.
+}
+MGLShadowState;
+
+// Context object descriptor structure (see mglCreateContext).
+typedef struct MGLContextDescriptor
+{
+    unsigned            flags;              // Bitwise OR of MGLContextFlags. By default 0.
+    unsigned            verify_interval;    // Verification interval of the shadow state if MGLContextFlagShadowState is set (see mglInitShadowState). By default 0.
+    const MGLAllocator* allocator;          // Optional allocator for the context object itself and the temporary buffers of its queries. It is copied into the context object. By default NULL.
+}
+MGLContextDescriptor;
+
+// GPU object as reported by mglQueryObjects.
+typedef struct MGLObjectInfo
+{
+    enum MGLObjectType  type;               // Object type.
+    GLenum              target;             // Target the object was found at, e.g. GL_TEXTURE_2D, GL_UNIFORM_BUFFER, or GL_RENDERBUFFER.
+    GLuint              name;               // Object name.
+    GLint               width;              // Width of the base level, or 0 for buffers.
+    GLint               height;             // Height of the base level, or 0 for buffers.
+    GLint               depth;              // Depth or number of layers of the base level, or 0 for buffers.
+    GLint               internal_format;    // Internal format of the base level, or 0 for buffers.
+    GLint               num_levels;         // Number of MIP-map levels with a non-zero size.
+    GLint               samples;            // Number of samples, or 0 if the object is not multi-sampled.
+    unsigned long long  bytes;              // Estimated size (in bytes) of all MIP-map levels, cube faces, and samples, or the buffer size. Buffer textures are 0, since their memory is owned by a buffer.
+}
+MGLObjectInfo;
+
+// Watch list entry structure (see mglCompileWatchList).
+typedef struct MGLWatchEntry
+{
+    GLenum  pname;  // Parameter name of a render state field, e.g. GL_BLEND or GL_UNIFORM_BUFFER_BINDING.
+    GLint   index;  // Element index of an indexed field (see MGLFieldFlagIndexed), or -1 for all elements within the implementation limit. Ignored for all other fields.
+}
+MGLWatchEntry;
+
+// Weights of each transition cost tier (see mglEvaluateTransition and mglGetDefaultTransitionWeights).
+typedef struct MGLTransitionWeights
+{
+    double  base[MGL_TRANSITION_TIERS];         // Cost that is added once if any state of the tier changed, e.g. for the validation of the respective driver state.
+    double  per_change[MGL_TRANSITION_TIERS];   // Cost that is added for each changed field, or each changed element of arrays and binding points.
+}
+MGLTransitionWeights;
+
+// Transition cost as reported by mglEvaluateTransition.
+typedef struct MGLTransitionCost
+{
+    double  score;                              // Weighted score of all tiers.
+    double  tier_scores[MGL_TRANSITION_TIERS];  // Weighted score of each tier.
+    size_t  num_changes[MGL_TRANSITION_TIERS];  // Number of changed fields, or changed elements of arrays and binding points, of each tier.
+}
+MGLTransitionCost;
+
+// Draw record for mglSortDrawRecords.
+typedef struct MGLDrawRecord
+{
+    const MGLRenderState*   render_state;   // Render state of the draw call.
+    const MGLBindingPoints* binding_points; // Binding points of the draw call, or null.
+    unsigned long long      key;            // Sort key of the draw call (see mglRenderStateSortKey). Written by mglSortDrawRecords.
+    size_t                  index;          // Index of the draw call in its original order. Written by mglSortDrawRecords.
+}
+MGLDrawRecord;
+
+// Draw order statistics as reported by mglSortDrawRecords.
+typedef struct MGLDrawSortStats
+{
+    size_t  transitions_before; // Number of changes of the draw framebuffer, program, vertex array, primary texture bindings, and blend enable between consecutive draw calls in their original order.
+    size_t  transitions_after;  // Number of such changes between consecutive draw calls in sorted order.
+    double  score_before;       // Sum of the transition scores (see mglEvaluateTransition) between consecutive draw calls in their original order.
+    double  score_after;        // Sum of the transition scores between consecutive draw calls in sorted order.
+}
+MGLDrawSortStats;
+
+// Changed field as reported by mglDiffRenderState and mglDiffBindingPoints.
+typedef struct MGLStateChange
+{
+    const char* name;   // Parameter name of the changed field, e.g. "GL_BLEND".
+    size_t      offset; // Byte offset of the changed field within its state structure.
+    size_t      size;   // Size (in bytes) of the changed field within its state structure.
+}
+MGLStateChange;
+
+// Function to convert an enum value into its name, or NULL if the value is unknown.
+typedef const char* (*MGLEnumToStringProc)(GLenum);
+
+// Function to receive formatted output from mglPrintRenderStateTo and mglPrintBindingPointsTo. 'data' is not null-terminated and only valid during the call.
+typedef void (*MGLWriteProc)(const char* data, size_t len, void* user);
+
+// Descriptor of a single field within MGLRenderState or MGLBindingPoints (see mglGetRenderStateFields and mglGetBindingPointsFields).
+typedef struct MGLFieldDescriptor
+{
+    const char*         name;           // Parameter name, e.g. "GL_BLEND".
+    GLenum              pname;          // Parameter to query the field, or 0 if the GL version of this field is unavailable in the GL headers.
+    unsigned            version;        // Minimum GL version of this field, encoded as ((MAJOR << 16) | MINOR).
+    unsigned            category;       // State category (MGLStateCategory).
+    unsigned            type;           // Field type (MGLFieldType).
+    unsigned            flags;          // Field flags (MGLFieldFlags).
+    unsigned            count;          // Number of elements. For dynamic arrays the maximum number of elements, and for bitfields the number of bits.
+    size_t              offset;         // Byte offset of the field within its state structure.
+    size_t              count_offset;   // Byte offset of the GLint field that holds the actual number of elements of a dynamic array, or MGL_FIELD_NO_OFFSET.
+    size_t              limits_offset;  // Byte offset of the field within MGLImplementationLimits, or MGL_FIELD_NO_OFFSET if the field is no implementation dependent limit.
+    MGLEnumToStringProc proc;           // Optional enum to string conversion function for enum, bitfield, and enum array fields.
+}
+MGLFieldDescriptor;
+
 
 // *****************************************************************
 //      PUBLIC FUNCTIONS
@@ -354,106 +823,700 @@ extern "C" {
 // Queries the entire OpenGL render state and stores it in 'render_state'.
 void mglQueryRenderState(MGLRenderState* render_state);
 
+// Queries all implementation dependent limits and stores them in 'limits'. These never change for the lifetime of a GL context, so they only need to be queried once.
+void mglQueryImplementationLimits(MGLImplementationLimits* limits);
+
+// Queries the OpenGL render state without any implementation dependent limits and stores it in 'render_state'.
+// If 'limits' is non-null, the limits and the context version are copied from there. Otherwise, only the context version is queried and all limits remain zero.
+void mglQueryRenderStateWithLimits(MGLRenderState* render_state, const MGLImplementationLimits* limits);
+
+// Queries the OpenGL render state as specified by 'options' and stores it in 'render_state'. States of unselected categories remain zero.
+// The context version is always queried. Limits are only queried if MGLStateCategoryLimits is selected and no cached limits are specified.
+void mglQueryRenderStateEx(MGLRenderState* render_state, const MGLQueryOptions* options);
+
 // Queries the entire OpenGL binding points and stores it in 'binding_points'.
 void mglQueryBindingPoints(MGLBindingPoints* binding_points);
 
+// Queries the OpenGL binding points as specified by 'options' and stores it in 'binding_points'. Unselected targets and units remain zero.
+// Only the texture units up to GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS are queried. For GL 4.5 and later, the bindings are queried with glGetIntegeri_v if
+// MENTAL_GL_INDEXED_TEXTURE_BINDINGS is defined, which leaves the active texture unit untouched. Otherwise, the active texture unit is only changed for
+// the selected units and restored afterwards.
+void mglQueryBindingPointsEx(MGLBindingPoints* binding_points, const MGLBindingPointsQueryOptions* options);
+
+// Prints the query statistics specified by 'stats' and returns the formatted output string. Only GL versions with at least one glGet call are printed.
+// Wall times are printed as "n/a" if MENTAL_GL_QUERY_STATS is not defined.
+MGLString mglPrintQueryStats(const MGLQueryStats* stats, const MGLFormattingOptions* formatting);
+
 // Prints the entire OpenGL render states specified by 'render_state' and returns the formatted output string.
 MGLString mglPrintRenderState(const MGLRenderState* render_state, const MGLFormattingOptions* formatting);
 
 // Prints the entire OpenGL binding points specified by 'binding_points' and returns the formatted output string.
 MGLString mglPrintBindingPoints(const MGLBindingPoints* binding_points, const MGLFormattingOptions* formatting);
 
-// Returns the null-terminated string from the specified opaque object.
-const char* mglGetUTF8String(MGLString s);
+// Compares the render states 'lhs' and 'rhs', writes up to 'max_changes' changed fields into 'changes', and returns the total number of changed fields.
+// 'changes' may be null to only determine the number of changed fields.
+size_t mglDiffRenderState(const MGLRenderState* lhs, const MGLRenderState* rhs, MGLStateChange* changes, size_t max_changes);
 
-// Release all resources allocated by this library.
-void mglFreeString(MGLString s);
+// Compares the binding points 'lhs' and 'rhs', writes up to 'max_changes' changed fields into 'changes', and returns the total number of changed fields.
+size_t mglDiffBindingPoints(const MGLBindingPoints* lhs, const MGLBindingPoints* rhs, MGLStateChange* changes, size_t max_changes);
 
-#ifdef __cplusplus
-} // /extern "C"
-#endif
+// Stores the default transition weights in 'weights'. They approximate the relative driver costs of each tier, from framebuffer changes as the most expensive to uniform buffer ranges as the cheapest.
+void mglGetDefaultTransitionWeights(MGLTransitionWeights* weights);
 
+// Classifies the changes from the render state 'lhs' to 'rhs' and, if both are non-null, from the binding points 'lhs_binding_points' to 'rhs_binding_points' into cost tiers (see MGLTransitionTier),
+// stores the per-tier breakdown in 'cost' if non-null, and returns the weighted score. If 'weights' is null, the default transition weights are used.
+double mglEvaluateTransition(const MGLRenderState* lhs, const MGLRenderState* rhs, const MGLBindingPoints* lhs_binding_points, const MGLBindingPoints* rhs_binding_points, const MGLTransitionWeights* weights, MGLTransitionCost* cost);
 
-// *****************************************************************
-//      IMPLEMENTATION
-// *****************************************************************
+// Returns a 64-bit sort key of 'render_state' and 'binding_points' (may be null) that orders expensive states in its high bits: the draw framebuffer in bits 56-63, the program in bits 42-55,
+// the vertex array in bits 28-41, a hash of the primary texture bindings (units 0 to 3) in bits 14-27, blend enable in bit 13, and a hash of the entire render state in bits 0-12.
+// Object names that exceed their bit range are folded, so draw calls with equal keys most likely share the same state, but this is not guaranteed.
+unsigned long long mglRenderStateSortKey(const MGLRenderState* render_state, const MGLBindingPoints* binding_points);
 
-#ifdef MENTAL_GL_IMPLEMENTATION
+// Computes the sort key of each draw record, sorts the draw records by their key, and stores the state transitions before and after sorting in 'stats' if non-null.
+// Draw records with equal keys keep their original order. Transition scores use 'weights', or the default transition weights if 'weights' is null.
+void mglSortDrawRecords(MGLDrawRecord* records, size_t num_records, const MGLTransitionWeights* weights, MGLDrawSortStats* stats);
 
+// Writes a compact binary snapshot of 'render_state' into 'data' and returns the size (in bytes) of the snapshot. Nothing is written if 'data' is null or 'size' is too small.
+// The snapshot is little-endian, stores only the fields available for the context version, and tags each field by its pname, so it remains readable across library versions.
+size_t mglSerializeRenderState(const MGLRenderState* render_state, void* data, size_t size);
 
-#ifdef _MSC_VER
-#pragma warning(push)
-#pragma warning(disable:4996)
-#endif // /_MSC_VER
+// Reads a binary snapshot written by mglSerializeRenderState into 'render_state' and returns the size (in bytes) of the snapshot, or 0 if the snapshot is invalid.
+// Fields that are not stored in the snapshot remain zero. On failure, 'render_state' is left unchanged.
+size_t mglDeserializeRenderState(MGLRenderState* render_state, const void* data, size_t size);
 
+// Writes a compact binary snapshot of 'binding_points' into 'data' and returns the size (in bytes) of the snapshot. Nothing is written if 'data' is null or 'size' is too small.
+size_t mglSerializeBindingPoints(const MGLBindingPoints* binding_points, void* data, size_t size);
 
-#ifdef _WIN32
-#include <Windows.h>
-#endif
+// Reads a binary snapshot written by mglSerializeBindingPoints into 'binding_points' and returns the size (in bytes) of the snapshot, or 0 if the snapshot is invalid.
+size_t mglDeserializeBindingPoints(MGLBindingPoints* binding_points, const void* data, size_t size);
 
-#include <string.h>
-#include <stdio.h>
-#include <stdlib.h>
+// Packs the render state 'render_state' into 'packed'. Implementation dependent limits are not stored.
+void mglPackRenderState(MGLPackedRenderState* packed, const MGLRenderState* render_state);
 
-#ifdef __APPLE__
-#   include <OpenGL/OpenGL.h>
-#else
-#   include <GL/GL.h>
-#   include <GL/glext.h>
-#endif
+// Unpacks the packed render state 'packed' into 'render_state'. If 'limits' is non-null, the implementation dependent limits are copied from there. Otherwise, they remain zero.
+void mglUnpackRenderState(MGLRenderState* render_state, const MGLPackedRenderState* packed, const MGLImplementationLimits* limits);
 
+// Returns a 64-bit hash of all render states in 'render_state' except the implementation dependent limits and GL_TIMESTAMP. Padding bytes are ignored.
+// The hash is deterministic across runs and equals the hash of the packed render state (see mglHashPackedRenderState).
+unsigned long long mglHashRenderState(const MGLRenderState* render_state);
 
-// *****************************************************************
-//      INTERNAL MACROS
-// *****************************************************************
+// Returns a 64-bit hash of the packed render state 'packed' that equals the hash of the unpacked render state (see mglHashRenderState).
+unsigned long long mglHashPackedRenderState(const MGLPackedRenderState* packed);
 
-#define MGL_CASE2STR(NAME)                          case NAME: return #NAME
+// Returns a 64-bit hash of all binding points in 'binding_points'.
+unsigned long long mglHashBindingPoints(const MGLBindingPoints* binding_points);
 
-#define MGL_MIN(A, B)                               ((A) < (B) ? (A) : (B))
-#define MGL_MAX(A, B)                               ((A) > (B) ? (A) : (B))
+// Prints only the render states that differ between 'lhs' and 'rhs' in the form "old -> new" and returns the formatted output string.
+MGLString mglPrintRenderStateDiff(const MGLRenderState* lhs, const MGLRenderState* rhs, const MGLFormattingOptions* formatting);
 
-#ifndef MGL_MALLOC
-#define MGL_MALLOC(TYPE)                            ((TYPE*)malloc(sizeof(TYPE)))
-#endif
+// Prints only the binding points that differ between 'lhs' and 'rhs' in the form "old -> new" and returns the formatted output string.
+MGLString mglPrintBindingPointsDiff(const MGLBindingPoints* lhs, const MGLBindingPoints* rhs, const MGLFormattingOptions* formatting);
 
-#ifndef MGL_CALLOC
-#define MGL_CALLOC(TYPE, COUNT)                     ((TYPE*)calloc(COUNT, sizeof(TYPE)))
-#endif
+// Prints the entire OpenGL render states like mglPrintRenderState, but writes the output into 'reuse' and returns it. If 'reuse' is null, a new string is returned.
+// The string keeps its internal buffers between calls, so printing into the same string repeatedly does not allocate any memory once the buffers are large enough.
+MGLString mglPrintRenderStateInto(MGLString reuse, const MGLRenderState* render_state, const MGLFormattingOptions* formatting);
 
-#ifndef MGL_FREE
-#define MGL_FREE(OBJ)                               free(OBJ)
-#endif
+// Prints the entire OpenGL binding points like mglPrintBindingPoints, but writes the output into 'reuse' and returns it. If 'reuse' is null, a new string is returned.
+MGLString mglPrintBindingPointsInto(MGLString reuse, const MGLBindingPoints* binding_points, const MGLFormattingOptions* formatting);
 
-#define MGL_STRING_MIN_CAPACITY                     16
-#define MGL_STRING_NPOS                             (size_t)~0
+// Prints the render state differences like mglPrintRenderStateDiff, but writes the output into 'reuse' and returns it. If 'reuse' is null, a new string is returned.
+MGLString mglPrintRenderStateDiffInto(MGLString reuse, const MGLRenderState* lhs, const MGLRenderState* rhs, const MGLFormattingOptions* formatting);
 
-#define MGL_MAX_NUM_RENDER_STATES                   264
+// Prints the binding points differences like mglPrintBindingPointsDiff, but writes the output into 'reuse' and returns it. If 'reuse' is null, a new string is returned.
+MGLString mglPrintBindingPointsDiffInto(MGLString reuse, const MGLBindingPoints* lhs, const MGLBindingPoints* rhs, const MGLFormattingOptions* formatting);
 
+// Prints the entire OpenGL render states like mglPrintRenderState, but passes each formatted line to 'proc' as soon as it is produced instead of building an output string.
+// Only a single parameter/value pair is held in memory at a time, regardless of the formatting order.
+void mglPrintRenderStateTo(const MGLRenderState* render_state, const MGLFormattingOptions* formatting, MGLWriteProc proc, void* user);
 
-// *****************************************************************
-//      INTERNAL FUNCTION OBJECTS
-// *****************************************************************
+// Prints the entire OpenGL binding points like mglPrintBindingPoints, but passes each formatted line to 'proc' as soon as it is produced instead of building an output string.
+void mglPrintBindingPointsTo(const MGLBindingPoints* binding_points, const MGLFormattingOptions* formatting, MGLWriteProc proc, void* user);
 
-typedef const char* (*MGLEnumToStringProc)(GLenum);
+// Returns the static descriptor table of all fields in MGLRenderState and stores the number of fields in 'num_fields'.
+// The fields are in the same order as they are printed by mglPrintRenderState, i.e. grouped by their minimum GL version.
+const MGLFieldDescriptor* mglGetRenderStateFields(size_t* num_fields);
 
+// Returns the static descriptor table of all fields in MGLBindingPoints and stores the number of fields in 'num_fields'.
+const MGLFieldDescriptor* mglGetBindingPointsFields(size_t* num_fields);
 
-// *****************************************************************
-//      INTERNAL STRUCTURES
-// *****************************************************************
+// Returns the implementation limit of the number of elements of the indexed field 'pname' (e.g. GL_MAX_UNIFORM_BUFFER_BINDINGS for GL_UNIFORM_BUFFER_BINDING)
+// for the GL version 'version', encoded as ((MAJOR << 16) | MINOR), or 0 if the field has no such limit (see MGLFieldFlagIndexed).
+GLenum mglGetIndexedFieldLimit(GLenum pname, unsigned version);
 
-typedef struct MGLStringInternal
+// Returns the name of the specified GLenum value as printed by this library (e.g. "GL_SRC_ALPHA"), or NULL if the value is unknown.
+// If multiple names share the same value (e.g. GL_NONE and GL_ZERO), the preferred one is returned.
+const char* mglEnumName(GLenum value);
+
+// Compiles the filter specified by 'desc' into a filter object for MGLFormattingOptions::compiled_filter.
+// Parameters are selected if they match the categories and any pattern or pname. If neither patterns nor pnames are specified, all parameters of the categories are selected.
+// Returns NULL if the filter object cannot be allocated.
+MGLFilter mglCompileFilter(const MGLFilterDescriptor* desc);
+
+// Releases the specified filter object.
+void mglFreeFilter(MGLFilter filter);
+
+// Returns the null-terminated string from the specified opaque object, or an empty string if 's' is null.
+const char* mglGetUTF8String(MGLString s);
+
+// Release all resources allocated by this library.
+void mglFreeString(MGLString s);
+
+// Initializes the shadow state 'shadow' by querying the implementation limits, the entire render state, and the binding points once.
+// If 'verify_interval' is non-zero, mglShadowNextFrame verifies the shadow state against the actual GL state every 'verify_interval' frames.
+void mglInitShadowState(MGLShadowState* shadow, unsigned verify_interval);
+
+// Re-queries the entire render state and binding points for the shadow state 'shadow'. The implementation limits are kept.
+void mglSyncShadowState(MGLShadowState* shadow);
+
+// Compares the shadow state 'shadow' against the actual GL state and re-synchronizes it. Returns non-zero if the shadow state diverged.
+int mglVerifyShadowState(MGLShadowState* shadow);
+
+// Advances the frame counter of the shadow state 'shadow' and runs the periodic verification if due. Returns non-zero if the shadow state diverged.
+int mglShadowNextFrame(MGLShadowState* shadow);
+
+// Wrapper functions that forward to the respective GL function and update the shadow state 'shadow' in place.
+// Binding a vertex array object or framebuffer re-queries the states owned by that object, since they cannot be tracked otherwise.
+void mglShadowEnable(MGLShadowState* shadow, GLenum cap);
+void mglShadowDisable(MGLShadowState* shadow, GLenum cap);
+void mglShadowBlendColor(MGLShadowState* shadow, GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
+void mglShadowBlendEquation(MGLShadowState* shadow, GLenum mode);
+void mglShadowBlendEquationSeparate(MGLShadowState* shadow, GLenum mode_rgb, GLenum mode_alpha);
+void mglShadowBlendFunc(MGLShadowState* shadow, GLenum sfactor, GLenum dfactor);
+void mglShadowBlendFuncSeparate(MGLShadowState* shadow, GLenum src_rgb, GLenum dst_rgb, GLenum src_alpha, GLenum dst_alpha);
+void mglShadowColorMask(MGLShadowState* shadow, GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha);
+void mglShadowLogicOp(MGLShadowState* shadow, GLenum opcode);
+void mglShadowClearColor(MGLShadowState* shadow, GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
+void mglShadowClearDepth(MGLShadowState* shadow, GLdouble depth);
+void mglShadowClearStencil(MGLShadowState* shadow, GLint s);
+void mglShadowDepthFunc(MGLShadowState* shadow, GLenum func);
+void mglShadowDepthMask(MGLShadowState* shadow, GLboolean flag);
+void mglShadowDepthRange(MGLShadowState* shadow, GLdouble near_val, GLdouble far_val);
+void mglShadowStencilFunc(MGLShadowState* shadow, GLenum func, GLint ref, GLuint mask);
+void mglShadowStencilFuncSeparate(MGLShadowState* shadow, GLenum face, GLenum func, GLint ref, GLuint mask);
+void mglShadowStencilOp(MGLShadowState* shadow, GLenum sfail, GLenum dpfail, GLenum dppass);
+void mglShadowStencilOpSeparate(MGLShadowState* shadow, GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass);
+void mglShadowStencilMask(MGLShadowState* shadow, GLuint mask);
+void mglShadowStencilMaskSeparate(MGLShadowState* shadow, GLenum face, GLuint mask);
+void mglShadowCullFace(MGLShadowState* shadow, GLenum mode);
+void mglShadowFrontFace(MGLShadowState* shadow, GLenum mode);
+void mglShadowPolygonMode(MGLShadowState* shadow, GLenum face, GLenum mode);
+void mglShadowPolygonOffset(MGLShadowState* shadow, GLfloat factor, GLfloat units);
+void mglShadowLineWidth(MGLShadowState* shadow, GLfloat width);
+void mglShadowPointSize(MGLShadowState* shadow, GLfloat size);
+void mglShadowViewport(MGLShadowState* shadow, GLint x, GLint y, GLsizei width, GLsizei height);
+void mglShadowScissor(MGLShadowState* shadow, GLint x, GLint y, GLsizei width, GLsizei height);
+void mglShadowSampleCoverage(MGLShadowState* shadow, GLfloat value, GLboolean invert);
+void mglShadowProvokingVertex(MGLShadowState* shadow, GLenum mode);
+void mglShadowClipControl(MGLShadowState* shadow, GLenum origin, GLenum depth);
+void mglShadowHint(MGLShadowState* shadow, GLenum target, GLenum mode);
+void mglShadowPixelStorei(MGLShadowState* shadow, GLenum pname, GLint param);
+void mglShadowBindBuffer(MGLShadowState* shadow, GLenum target, GLuint buffer);
+void mglShadowBindBufferBase(MGLShadowState* shadow, GLenum target, GLuint index, GLuint buffer);
+void mglShadowBindBufferRange(MGLShadowState* shadow, GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
+void mglShadowUseProgram(MGLShadowState* shadow, GLuint program);
+void mglShadowBindProgramPipeline(MGLShadowState* shadow, GLuint pipeline);
+void mglShadowBindVertexArray(MGLShadowState* shadow, GLuint array);
+void mglShadowPrimitiveRestartIndex(MGLShadowState* shadow, GLuint index);
+void mglShadowPatchParameteri(MGLShadowState* shadow, GLenum pname, GLint value);
+void mglShadowBindFramebuffer(MGLShadowState* shadow, GLenum target, GLuint framebuffer);
+void mglShadowBindRenderbuffer(MGLShadowState* shadow, GLenum target, GLuint renderbuffer);
+void mglShadowDrawBuffer(MGLShadowState* shadow, GLenum buf);
+void mglShadowDrawBuffers(MGLShadowState* shadow, GLsizei n, const GLenum* bufs);
+void mglShadowReadBuffer(MGLShadowState* shadow, GLenum src);
+void mglShadowActiveTexture(MGLShadowState* shadow, GLenum texture);
+void mglShadowBindTexture(MGLShadowState* shadow, GLenum target, GLuint texture);
+void mglShadowBindSampler(MGLShadowState* shadow, GLuint unit, GLuint sampler);
+
+// Creates a redundancy counter for the 'redundancy' member of MGLShadowState. Calls are counted for each state they set and for the current call site.
+// Returns NULL if the counter cannot be allocated.
+MGLRedundancyCounter mglCreateRedundancyCounter(void);
+
+// Releases the specified redundancy counter object.
+void mglFreeRedundancyCounter(MGLRedundancyCounter counter);
+
+// Resets all counts of the specified redundancy counter. Call sites are kept.
+void mglResetRedundancyCounter(MGLRedundancyCounter counter);
+
+// Sets the call site for all subsequent wrapper calls, e.g. a source location or render pass name, or NULL for the unnamed call site.
+// Call sites are identified by their name, which must remain valid for the lifetime of the counter. If a new call site cannot be allocated, the unnamed call site is used instead.
+void mglSetRedundancyCallSite(MGLRedundancyCounter counter, const char* site);
+
+// Returns the number of redundant calls, i.e. calls that only set values which were already current, and optionally the total number of calls in 'num_calls'.
+size_t mglGetNumRedundantCalls(MGLRedundancyCounter counter, size_t* num_calls);
+
+// Prints the number of redundant calls and the total number of calls for each state and each call site with at least one call, and returns the formatted output string.
+// States are selected and ordered by 'formatting' like in mglPrintRenderState. Call sites that exceed the maximum number of output lines are omitted.
+MGLString mglPrintRedundancyCounter(MGLRedundancyCounter counter, const MGLFormattingOptions* formatting);
+
+// Creates a capture object that records render states per draw call as deltas in a preallocated ring buffer of 'budget' bytes.
+// Besides the ring buffer, the capture object only holds three full render states: the oldest and newest captured state, and a cursor for reconstruction.
+// Returns NULL if the capture object or its ring buffer cannot be allocated.
+MGLCapture mglCreateCapture(size_t budget);
+
+// Releases the specified capture object.
+void mglFreeCapture(MGLCapture capture);
+
+// Begins a new frame capture and discards all previously captured render states. The first captured render state of the frame is the keyframe.
+void mglBeginCaptureFrame(MGLCapture capture);
+
+// Captures 'render_state' as the next draw call of the current frame and returns non-zero on success, or 0 if no frame capture is in progress.
+// Only the changes to the previous draw call are stored. If the ring buffer is full, the oldest draw calls are discarded.
+int mglCaptureRenderState(MGLCapture capture, const MGLRenderState* render_state);
+
+// Ends the current frame capture. Subsequent calls to mglCaptureRenderState are ignored until the next call to mglBeginCaptureFrame.
+void mglEndCaptureFrame(MGLCapture capture);
+
+// Returns the number of draw calls that are available in the capture object, and stores the index of the oldest available draw call in 'first'.
+// Draw calls are indexed in capture order starting with 0 at mglBeginCaptureFrame.
+size_t mglGetCaptureRange(MGLCapture capture, size_t* first);
+
+// Reconstructs the render state of the draw call with the specified index into 'render_state' and returns non-zero on success, or 0 if the draw call is unavailable.
+// Reconstructing draw calls in ascending order only applies the changes since the previously reconstructed draw call.
+int mglGetCapturedRenderState(MGLCapture capture, size_t index, MGLRenderState* render_state);
+
+// Creates a state store that interns render states, so identical render states are only stored once and referenced by an ID. Memory for 'capacity' distinct states is reserved up front.
+// Returns NULL if the state store cannot be allocated.
+MGLStateStore mglCreateStateStore(size_t capacity);
+
+// Releases the specified state store object and all of its render states.
+void mglFreeStateStore(MGLStateStore store);
+
+// Interns 'render_state' and returns its non-zero ID. If an identical render state is already stored, its ID is returned and its reference count is incremented.
+// Render states are compared like mglHashRenderState, i.e. without implementation dependent limits and GL_TIMESTAMP. Returns 0 if the state store cannot grow.
+GLuint mglInternRenderState(MGLStateStore store, const MGLRenderState* render_state);
+
+// Increments the reference count of the render state with the specified ID.
+void mglRetainRenderState(MGLStateStore store, GLuint id);
+
+// Decrements the reference count of the render state with the specified ID. The render state is removed once its reference count reaches zero, and its ID may be reused.
+void mglReleaseRenderState(MGLStateStore store, GLuint id);
+
+// Unpacks the render state with the specified ID into 'render_state' like mglUnpackRenderState and returns non-zero on success, or 0 if the ID is invalid.
+int mglGetInternedRenderState(MGLStateStore store, GLuint id, MGLRenderState* render_state, const MGLImplementationLimits* limits);
+
+// Returns the packed render state with the specified ID, or NULL if the ID is invalid. The pointer is only valid until the next call to mglInternRenderState.
+const MGLPackedRenderState* mglGetInternedPackedRenderState(MGLStateStore store, GLuint id);
+
+// Returns the number of distinct render states in the specified state store.
+size_t mglGetNumInternedRenderStates(MGLStateStore store);
+
+// Creates a context object for the GL context that is current on the calling thread, and queries its implementation limits once. 'desc' may be null for default settings.
+// Separate context objects never share any memory, not even a cache line, so each thread can query its own GL context through its own context object without locks.
+// Returns NULL if the context object cannot be allocated.
+MGLContext mglCreateContext(const MGLContextDescriptor* desc);
+
+// Releases the specified context object.
+void mglFreeContext(MGLContext context);
+
+// Returns the implementation limits of the specified context object, which were queried by mglCreateContext.
+const MGLImplementationLimits* mglGetContextLimits(MGLContext context);
+
+// Returns the shadow state of the specified context object, or NULL if MGLContextFlagShadowState was not set. Pass it to the mglShadow* wrapper functions.
+MGLShadowState* mglGetContextShadowState(MGLContext context);
+
+// Returns the accumulated query statistics of the specified context object, or NULL if MGLContextFlagQueryStats was not set. The statistics can be reset with memset.
+MGLQueryStats* mglGetContextQueryStats(MGLContext context);
+
+// Queries the render state of the specified categories, or all categories if 'categories' is 0, with the cached limits, shadow state, and statistics of the specified context object.
+// The context object must belong to the GL context that is current on the calling thread.
+void mglQueryRenderStateWithContext(MGLContext context, MGLRenderState* render_state, unsigned categories);
+
+// Queries the binding points with the shadow state and statistics of the specified context object.
+void mglQueryBindingPointsWithContext(MGLContext context, MGLBindingPoints* binding_points);
+
+// Queries the textures of 'binding_points' and the buffers and renderbuffer of 'render_state', writes the 'max_objects' largest ones into 'objects' sorted by their estimated size,
+// and returns the total number of distinct objects. Either state may be null. If 'probe_names' is non-zero, all object names in [1, probe_names] are probed as well to include unbound objects.
+// Objects are queried with direct state access for GL 4.5 and later; unbound textures can only be probed then. Otherwise, each object is temporarily bound and the previous binding is restored.
+size_t mglQueryObjects(const MGLRenderState* render_state, const MGLBindingPoints* binding_points, GLuint probe_names, MGLObjectInfo* objects, size_t max_objects);
+
+// Prints the objects specified by 'objects' in the given order, one line per object, followed by their total estimated size, and returns the formatted output string.
+MGLString mglPrintObjects(const MGLObjectInfo* objects, size_t num_objects, const MGLFormattingOptions* formatting);
+
+// Compiles the render state fields specified by 'entries' into a flat query plan for the GL context that is current on the calling thread, so all lookups and version checks are resolved once.
+// Entries are skipped if their field is unknown, unavailable for the GL version of the current context, a dynamic array, or an index is out of range.
+// Returns NULL if the watch list cannot be allocated.
+MGLWatchList mglCompileWatchList(const MGLWatchEntry* entries, size_t num_entries);
+
+// Releases the specified watch list object.
+void mglFreeWatchList(MGLWatchList list);
+
+// Returns the number of bytes that mglQueryWatchList writes into its output buffer.
+size_t mglGetWatchListSize(MGLWatchList list);
+
+// Returns the descriptor of the field of the specified watch list entry, or NULL if the entry was skipped, and stores the byte offset of its values within the output buffer in 'offset'
+// and the number of elements in 'count' if non-null. Values have the same type and layout as their member in MGLRenderState; every entry starts at an offset aligned to 8 bytes.
+const MGLFieldDescriptor* mglGetWatchListEntry(MGLWatchList list, size_t entry, size_t* offset, size_t* count);
+
+// Runs the query plan of the specified watch list and writes all values into 'data', which must provide at least mglGetWatchListSize bytes.
+void mglQueryWatchList(MGLWatchList list, void* data);
+
+#ifdef MENTAL_GL_PRINT_QUEUE
+
+// Creates a print queue with a background thread that prints up to 'capacity' queued states with the formatting options 'formatting' and passes the output to 'proc'.
+// 'proc' is only called from the background thread. The formatting options are copied, but any strings, filter objects, and allocators they refer to must outlive the print queue. The allocator is called from the background thread.
+// Returns NULL if the print queue cannot be allocated or its background thread cannot be started.
+MGLPrintQueue mglCreatePrintQueue(size_t capacity, const MGLFormattingOptions* formatting, MGLWriteProc proc, void* user);
+
+// Waits until all queued states are printed, stops the background thread, and releases the specified print queue.
+void mglFreePrintQueue(MGLPrintQueue queue);
+
+// Copies 'render_state' into the print queue and returns non-zero on success, or 0 if the queue is full. Never waits for any formatting.
+int mglEnqueueRenderState(MGLPrintQueue queue, const MGLRenderState* render_state);
+
+// Copies 'binding_points' into the print queue and returns non-zero on success, or 0 if the queue is full. Never waits for any formatting.
+int mglEnqueueBindingPoints(MGLPrintQueue queue, const MGLBindingPoints* binding_points);
+
+// Waits until all queued states are printed.
+void mglFlushPrintQueue(MGLPrintQueue queue);
+
+#endif // /MENTAL_GL_PRINT_QUEUE
+
+#ifdef __cplusplus
+} // /extern "C"
+#endif
+
+
+// *****************************************************************
+//      IMPLEMENTATION
+// *****************************************************************
+
+#ifdef MENTAL_GL_IMPLEMENTATION
+
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable:4996)
+#endif // /_MSC_VER
+
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#ifdef MENTAL_GL_PRINT_QUEUE
+#include <pthread.h>
+#endif
+#ifdef MENTAL_GL_QUERY_STATS
+#include <time.h>
+#endif
+#endif
+
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef __APPLE__
+#   include <OpenGL/OpenGL.h>
+#else
+#   include <GL/gl.h>
+#   include <GL/glext.h>
+#endif
+
+
+// *****************************************************************
+//      INTERNAL MACROS
+// *****************************************************************
+
+#define MGL_MIN(A, B)                               ((A) < (B) ? (A) : (B))
+#define MGL_MAX(A, B)                               ((A) > (B) ? (A) : (B))
+
+// Supported range of GL versions, encoded as ((MAJOR << 16) | MINOR)
+#if defined MENTAL_GL_MIN_VERSION && defined MENTAL_GL_MAX_VERSION && MENTAL_GL_MIN_VERSION > MENTAL_GL_MAX_VERSION
+#error MENTAL_GL_MIN_VERSION must not be greater than MENTAL_GL_MAX_VERSION
+#endif
+
+#ifdef MENTAL_GL_MIN_VERSION
+#define MGL_MIN_VERSION                             ((((MENTAL_GL_MIN_VERSION) / 10) << 16) | ((MENTAL_GL_MIN_VERSION) % 10))
+#else
+#define MGL_MIN_VERSION                             (1 << 16)
+#endif
+
+#ifdef MENTAL_GL_MAX_VERSION
+#define MGL_MAX_VERSION                             ((((MENTAL_GL_MAX_VERSION) / 10) << 16) | ((MENTAL_GL_MAX_VERSION) % 10))
+#else
+#define MGL_MAX_VERSION                             (~0u)
+#endif
+
+// Returns non-zero if the encoded GL version 'REQUIRED' is supported by the context version 'VERSION'. Folds to a constant for versions outside of the range
+// (MGL_MIN_VERSION, MGL_MAX_VERSION], so the compiler strips unreachable blocks and hard-wires all blocks up to the minimum version
+#define MGL_IS_VERSION_SUPPORTED(VERSION, REQUIRED) \
+    ((unsigned)(REQUIRED) <= (unsigned)MGL_MAX_VERSION && ((unsigned)(REQUIRED) <= (unsigned)MGL_MIN_VERSION || (unsigned)(VERSION) >= (unsigned)(REQUIRED)))
+
+// MGL_MALLOC is still accepted for compatibility, but ignored since all allocations are zero initialized with MGL_CALLOC
+
+// Default reallocation is only used if the default allocation functions are not overridden
+#if !defined MGL_REALLOC && !defined MGL_CALLOC && !defined MGL_FREE
+#define MGL_REALLOC(OBJ, SIZE)                      realloc(OBJ, SIZE)
+#endif
+
+#ifndef MGL_CALLOC
+#define MGL_CALLOC(TYPE, COUNT)                     ((TYPE*)calloc(COUNT, sizeof(TYPE)))
+#endif
+
+#ifndef MGL_FREE
+#define MGL_FREE(OBJ)                               free(OBJ)
+#endif
+
+#define MGL_STRING_MIN_CAPACITY                     16
+#define MGL_STRING_NPOS                             (size_t)~0
+
+#define MGL_MAX_NUM_RENDER_STATES                   272
+
+#define MGL_SNAPSHOT_FORMAT_VERSION                 1
+#define MGL_SNAPSHOT_HEADER_SIZE                    20
+#define MGL_SNAPSHOT_RECORD_SIZE                    8
+
+#define MGL_CAPTURE_ENTRY_SIZE                      4
+#define MGL_CAPTURE_RECORD_SIZE                     6
+
+#define MGL_HASH_LANES                              8
+
+#define MGL_MAX_SHADOW_CALL_FIELDS                  24
+#define MGL_REDUNDANCY_NO_FIELD                     0xFFFF
+
+#define MGL_CACHE_LINE_SIZE                         64
+
+#define MGL_MAX_OBJECT_LEVELS                       32
+#define MGL_MAX_INDEXED_LIMITS                      8
+#define MGL_SORT_KEY_TEXTURE_UNITS                  4
+#define MGL_MAX_BOUND_OBJECTS                       (MGL_MAX_TEXTURE_LAYERS * 10 + MGL_MAX_UNIFORM_BUFFER_BINDINGS + MGL_MAX_TRANSFORM_FEEDBACK_BUFFER_BINDINGS + MGL_MAX_SHADER_STORAGE_BUFFER_BINDINGS + 6)
+
+
+// *****************************************************************
+//      INTERNAL STRUCTURES
+// *****************************************************************
+
+typedef struct MGLStringInternal
 {
-    size_t  cap; // capacity
-    size_t  len; // length
-    char*   buf; // buffer (incl. NUL char)
+    size_t              cap;        // capacity
+    size_t              len;        // length
+    char*               buf;        // buffer (incl. NUL char)
+    const MGLAllocator* allocator;  // allocator for 'buf', or null for the default allocator
+    int                 failed;     // non-zero if an allocation failed, so nothing is appended until the flag is reset
 }
 MGLStringInternal;
 
+// Internal object behind MGLString; 'str' must be the first member so mglGetUTF8String can access it directly
+typedef struct MGLOutputStringInternal
+{
+    MGLStringInternal   str;        // formatted output string
+    MGLStringInternal*  parts;      // persistent string parts for parameters and values (2*MGL_MAX_NUM_RENDER_STATES entries), or null
+    MGLAllocator        allocator;  // copy of the allocator from the formatting options; only used if 'allocate' is non-null
+}
+MGLOutputStringInternal;
+
+// Destination for string pairs that are written immediately instead of being collected in a string pair array
+typedef struct MGLStringStream
+{
+    MGLWriteProc                proc;
+    void*                       user;
+    const MGLFormattingOptions* formatting;
+    size_t                      max_par_len;    // incl. distance
+    MGLStringInternal           line;           // line buffer for the current string pair
+}
+MGLStringStream;
+
+// Internal object behind MGLCapture. Each entry in 'ring' is a u32 entry size followed by the changed element ranges of the previous entry.
+// A zero entry size, or less than one entry header until the end of the ring buffer, marks the wrap-around to the beginning
+typedef struct MGLCaptureInternal
+{
+    unsigned char*  ring;           // ring buffer of delta entries
+    size_t          capacity;       // size of the ring buffer (in bytes)
+    size_t          head;           // byte offset of the oldest entry
+    size_t          tail;           // byte offset behind the newest entry
+    size_t          first;          // draw call index of the oldest entry
+    size_t          count;          // number of entries
+    int             recording;      // non-zero between mglBeginCaptureFrame and mglEndCaptureFrame
+    size_t          cursor;         // draw call index of 'cursor_state', or MGL_STRING_NPOS if the cursor is invalid
+    size_t          cursor_offset;  // byte offset of the entry of 'cursor_state'
+    MGLRenderState  base;           // full render state of the oldest entry
+    MGLRenderState  last;           // full render state of the newest entry
+    MGLRenderState  cursor_state;   // full render state of the most recently reconstructed entry
+}
+MGLCaptureInternal;
+
+#ifdef MENTAL_GL_PRINT_QUEUE
+
+#ifdef _WIN32
+typedef CRITICAL_SECTION    MGLMutex;
+typedef CONDITION_VARIABLE  MGLCondition;
+typedef HANDLE              MGLThread;
+#else
+typedef pthread_mutex_t     MGLMutex;
+typedef pthread_cond_t      MGLCondition;
+typedef pthread_t           MGLThread;
+#endif
+
+// Queued state of a print queue
+typedef struct MGLPrintQueueSlot
+{
+    int                 is_render_state;    // non-zero for 'render_state', zero for 'binding_points'
+    union
+    {
+        MGLRenderState      render_state;
+        MGLBindingPoints    binding_points;
+    }
+    data;
+}
+MGLPrintQueueSlot;
+
+// Internal object behind MGLPrintQueue. The slot at 'head' stays in the queue while it is printed, so producers never overwrite it
+typedef struct MGLPrintQueueInternal
+{
+    MGLMutex                mutex;
+    MGLCondition            queued;     // signaled when a slot is queued or the thread must quit
+    MGLCondition            printed;    // signaled when a slot has been printed
+    MGLThread               thread;
+    MGLPrintQueueSlot*      slots;
+    size_t                  capacity;
+    size_t                  head;
+    size_t                  count;
+    int                     quit;
+    MGLFormattingOptions    formatting;
+    MGLWriteProc            proc;
+    void*                   user;
+}
+MGLPrintQueueInternal;
+
+#endif // /MENTAL_GL_PRINT_QUEUE
+
+// Call site of a redundancy counter
+typedef struct MGLRedundancyCallSite
+{
+    const char* name;
+    size_t      num_calls;
+    size_t      num_redundant;
+}
+MGLRedundancyCallSite;
+
+// Internal object behind MGLRedundancyCounter. Fields are indexed like g_MGLRenderStateFields
+typedef struct MGLRedundancyCounterInternal
+{
+    unsigned short          fields[sizeof(MGLRenderState)];                 // field index of each byte of MGLRenderState, or MGL_REDUNDANCY_NO_FIELD
+    unsigned short          sampler_binding_field;                          // field index of GL_SAMPLER_BINDING for the entries of MGLShadowState::sampler_bindings
+    size_t                  num_calls[MGL_MAX_NUM_RENDER_STATES];
+    size_t                  num_redundant[MGL_MAX_NUM_RENDER_STATES];
+    MGLRedundancyCallSite*  sites;                                          // sites[0] is the unnamed call site
+    size_t                  num_sites;
+    size_t                  capacity;
+    size_t                  site;                                           // index of the current call site
+    unsigned short          call_fields[MGL_MAX_SHADOW_CALL_FIELDS];        // fields stored by the current wrapper call (glDrawBuffer stores the most with 17 fields)
+    unsigned char           call_changed[MGL_MAX_SHADOW_CALL_FIELDS];       // non-zero if the respective field was changed by the current wrapper call
+    size_t                  num_call_fields;
+}
+MGLRedundancyCounterInternal;
+
+// Internal object behind MGLContext. It starts at a cache line boundary within 'memory' and its size is padded to whole cache lines
+typedef struct MGLContextInternal
+{
+    MGLImplementationLimits limits;
+    MGLQueryStats           stats;
+    MGLShadowState          shadow;
+    unsigned                flags;
+    MGLAllocator            allocator;  // copy of the allocator from the descriptor; only used if 'allocate' is non-null
+    void*                   memory;     // unaligned memory block this object is stored in
+    size_t                  size;       // size (in bytes) of 'memory'
+}
+MGLContextInternal;
+
+// Binding point of buffers and renderbuffers within MGLRenderState
+typedef struct MGLObjectBindingInternal
+{
+    GLenum  target;
+    size_t  offset; // byte offset of the GLint array within MGLRenderState
+    size_t  count;  // number of elements
+}
+MGLObjectBindingInternal;
+
+// Implementation limits of indexed fields, which are queried on demand at most once per query
+typedef struct MGLIndexedLimitsCache
+{
+    GLenum      limits[MGL_MAX_INDEXED_LIMITS];
+    GLint       values[MGL_MAX_INDEXED_LIMITS];
+    size_t      count;
+}
+MGLIndexedLimitsCache;
+
+// Kinds of glGet calls in a watch list query plan
+enum MGLWatchOp
+{
+    MGLWatchOpBoolean,
+    MGLWatchOpInteger,
+    MGLWatchOpInteger64,
+    MGLWatchOpFloat,
+    MGLWatchOpDouble,
+    MGLWatchOpIntegerIndexed,
+    MGLWatchOpInteger64Indexed,
+};
+
+// Single glGet call in a watch list query plan
+typedef struct MGLWatchOpInternal
+{
+    GLenum      pname;
+    GLuint      index;  // element index for indexed queries
+    unsigned    op;     // MGLWatchOp
+    unsigned    offset; // byte offset within the output buffer
+}
+MGLWatchOpInternal;
+
+// Resolved watch list entry
+typedef struct MGLWatchEntryInternal
+{
+    const MGLFieldDescriptor*   field;  // field descriptor, or null if the entry was skipped
+    size_t                      offset;
+    size_t                      count;
+}
+MGLWatchEntryInternal;
+
+// Internal object behind MGLWatchList; the plan and entries are allocated in the same memory block right after this structure
+typedef struct MGLWatchListInternal
+{
+    const MGLWatchOpInternal*       ops;
+    size_t                          num_ops;
+    const MGLWatchEntryInternal*    entries;
+    size_t                          num_entries;
+    size_t                          size;           // size of the output buffer
+    size_t                          memory_size;    // size of the entire memory block
+}
+MGLWatchListInternal;
+
+// Interned render state of a state store
+typedef struct MGLStateStoreEntry
+{
+    MGLPackedRenderState    state;
+    unsigned long long      hash;
+    GLuint                  ref_count;  // number of references, or 0 if the entry is in the free list
+    GLuint                  next_free;  // ID of the next entry in the free list, or 0
+}
+MGLStateStoreEntry;
+
+// Internal object behind MGLStateStore. IDs are entry indices plus one, and 'table' is an open addressing hash table of IDs with linear probing
+typedef struct MGLStateStoreInternal
+{
+    MGLStateStoreEntry* entries;
+    size_t              capacity;       // number of allocated entries
+    size_t              num_entries;    // number of used entries incl. the free list
+    size_t              num_states;     // number of referenced entries
+    GLuint              first_free;     // ID of the first entry in the free list, or 0
+    GLuint*             table;          // hash table of IDs, or 0 for empty slots
+    size_t              table_size;     // power of two and at least twice the capacity
+}
+MGLStateStoreInternal;
+
+// Hash state over a sequence of 32-bit words with MGL_HASH_LANES independent lanes, so that blocks of words can be processed in parallel
+typedef struct MGLHashState
+{
+    GLuint  lanes[MGL_HASH_LANES];
+    size_t  count; // number of words so far
+}
+MGLHashState;
+
 typedef struct MGLStringPairArray
 {
     MGLStringInternal*  first;
     MGLStringInternal*  second;
     size_t              index;
+    unsigned            categories;
+    MGLStringStream*    stream;     // optional stream to write each string pair immediately
 }
 MGLStringPairArray;
 
@@ -466,67 +1529,165 @@ MGLStringPairArray;
 extern "C" {
 #endif
 
-static void mglStringInternalReset(MGLStringInternal* s)
+// Allocates 'size' bytes of zero initialized memory with the specified allocator, or with MGL_CALLOC if 'allocator' is null
+static void* mglAlloc(const MGLAllocator* allocator, size_t size)
 {
-    if (s)
+    if (allocator != NULL)
     {
-        s->cap = 0;
-        s->len = 0;
-        s->buf = NULL;
+        void* ptr = allocator->allocate(allocator->user_data, size);
+        if (ptr != NULL)
+            memset(ptr, 0, size);
+        return ptr;
+    }
+    return MGL_CALLOC(char, size);
+}
+
+// Releases the memory block 'ptr' of 'size' bytes with the specified allocator, or with MGL_FREE if 'allocator' is null
+static void mglFree(const MGLAllocator* allocator, void* ptr, size_t size)
+{
+    if (ptr != NULL)
+    {
+        if (allocator == NULL)
+            MGL_FREE(ptr);
+        else if (allocator->release != NULL)
+            allocator->release(allocator->user_data, ptr, size);
+    }
+}
+
+// Resizes the memory block 'ptr' from 'old_size' to 'new_size' bytes, in place if the allocator supports it. New bytes are not initialized
+static void* mglRealloc(const MGLAllocator* allocator, void* ptr, size_t old_size, size_t new_size)
+{
+    if (allocator != NULL && allocator->reallocate != NULL)
+        return allocator->reallocate(allocator->user_data, ptr, old_size, new_size);
+
+    #ifdef MGL_REALLOC
+    if (allocator == NULL)
+        return MGL_REALLOC(ptr, new_size);
+    #endif
+
+    // Fall back to allocate, copy, and release
+    void* new_ptr = mglAlloc(allocator, new_size);
+    if (new_ptr != NULL && ptr != NULL)
+    {
+        memcpy(new_ptr, ptr, MGL_MIN(old_size, new_size));
+        mglFree(allocator, ptr, old_size);
     }
+    return new_ptr;
 }
 
-// Allocates a new internal string object with the specified initial capacity (minimum is 'MGL_STRING_MIN_CAPACITY')
+// Allocates a new internal string object with the specified initial capacity (minimum is 'MGL_STRING_MIN_CAPACITY'); keeps the allocator of 's'.
+// If the allocation fails, the string remains empty without a buffer and is marked as failed
 static void mglStringInternalInit(MGLStringInternal* s, size_t init_cap)
 {
     if (s)
     {
-        s->cap      = MGL_MAX(MGL_STRING_MIN_CAPACITY, init_cap);
+        const size_t cap = MGL_MAX(MGL_STRING_MIN_CAPACITY, init_cap);
+
         s->len      = 0;
-        s->buf      = MGL_CALLOC(char, s->cap);
-        s->buf[0]   = '\0';
+        s->buf      = (char*)mglAlloc(s->allocator, cap);
+        s->cap      = (s->buf != NULL ? cap : 0);
+        s->failed   = (s->buf == NULL);
+
+        if (s->buf != NULL)
+            s->buf[0] = '\0';
     }
 }
 
-// Allocates a new internal string object and initializes the string buffer with the specified null terminated string
-static void mglStringInternalInitWith(MGLStringInternal* s, const char* val)
+// Releases the specified internal string object
+static void mglStringInternalFree(MGLStringInternal* s)
 {
-    if (val)
+    if (s && s->buf)
+        mglFree(s->allocator, s->buf, s->cap);
+}
+
+// Allocates enough space for the specified capacity (if its larger than the current string capacity). Returns zero if the string is marked as failed
+static int mglStringInternalReserve(MGLStringInternal* s, size_t cap)
+{
+    if (s == NULL || s->failed)
+        return 0;
+
+    if (cap > s->cap)
     {
-        size_t len = strlen(val);
-        s->cap          = MGL_MAX(MGL_STRING_MIN_CAPACITY, len + 1);
-        s->len          = len;
-        s->buf          = MGL_CALLOC(char, s->cap);
-        memcpy(s->buf, val, s->len);
+        // Grow string buffer, which keeps the previous string; the previous buffer remains valid if the allocation fails
+        char* new_buf = (char*)mglRealloc(s->allocator, s->buf, (s->buf != NULL ? s->cap : 0), cap);
+        if (new_buf == NULL)
+        {
+            s->failed = 1;
+            return 0;
+        }
+        s->buf          = new_buf;
+        s->cap          = cap;
         s->buf[s->len]  = '\0';
     }
-    else
-        mglStringInternalInit(s, 0);
+
+    return 1;
 }
 
-// Releases the specified internal string object
-static void mglStringInternalFree(MGLStringInternal* s)
+// Clears the string but keeps its buffer and its failed state; allocates a buffer with minimal capacity if there is none yet
+static void mglStringInternalClear(MGLStringInternal* s)
 {
-    if (s && s->buf)
-        MGL_FREE(s->buf);
+    if (s)
+    {
+        if (s->buf == NULL && !s->failed)
+            mglStringInternalInit(s, 0);
+        s->len = 0;
+        if (s->buf != NULL)
+            s->buf[0] = '\0';
+    }
+}
+
+// Replaces the string with the specified null terminated string and only allocates a new buffer if the current capacity is insufficient
+static void mglStringInternalAssign(MGLStringInternal* s, const char* val)
+{
+    if (s)
+    {
+        size_t len = (val != NULL ? strlen(val) : 0);
+
+        if (s->buf == NULL && !s->failed)
+            mglStringInternalInit(s, len + 1);
+        else
+            s->len = 0;
+
+        // Leave the string empty if there is not enough space
+        if (!mglStringInternalReserve(s, len + 1))
+        {
+            if (s->buf != NULL)
+                s->buf[0] = '\0';
+            return;
+        }
+
+        if (len > 0)
+            memcpy(s->buf, val, len);
+        s->len          = len;
+        s->buf[s->len]  = '\0';
+    }
 }
 
 #if 0 // UNUSED
-// Allocates enough space for the specified capacity (if its larger than the current string capacity)
-static void mglStringInternalReserve(MGLStringInternal* s, size_t cap)
+static void mglStringInternalReset(MGLStringInternal* s)
 {
-    if (s && cap > s->cap)
+    if (s)
     {
-        // Allocate new string buffer and copy previous string into new buffer
-        char* new_buf = MGL_CALLOC(char, cap);
-        memcpy(new_buf, s->buf, s->len);
-        new_buf[s->len] = '\0';
+        s->cap = 0;
+        s->len = 0;
+        s->buf = NULL;
+    }
+}
 
-        // Replace previous string
-        MGL_FREE(s->buf);
-        s->cap = cap;
-        s->buf = new_buf;
+// Allocates a new internal string object and initializes the string buffer with the specified null terminated string
+static void mglStringInternalInitWith(MGLStringInternal* s, const char* val)
+{
+    if (val)
+    {
+        size_t len = strlen(val);
+        s->cap          = MGL_MAX(MGL_STRING_MIN_CAPACITY, len + 1);
+        s->len          = len;
+        s->buf          = (char*)mglAlloc(s->allocator, s->cap);
+        memcpy(s->buf, val, s->len);
+        s->buf[s->len]  = '\0';
     }
+    else
+        mglStringInternalInit(s, 0);
 }
 
 // Copies the specified internal string object
@@ -536,2388 +1697,6521 @@ static void mglStringInternalCopy(MGLStringInternal* dst, const MGLStringInterna
     {
         dst->cap = src->cap;
         dst->len = src->len;
-        dst->buf = MGL_CALLOC(char, dst->cap);
+        dst->buf = (char*)mglAlloc(dst->allocator, dst->cap);
         memcpy(dst->buf, src->buf, dst->len + 1);
     }
 }
 #endif // /UNUSED
 
-// Resizes the string to the specified length and fills the new characters with 'chr'
-static void mglStringInternalResize(MGLStringInternal* s, size_t len, char chr)
+// Resizes the string to the specified length and fills the new characters with 'chr'.
+// Returns zero and keeps the previous string if the string is marked as failed or the allocation fails, which marks the string as failed
+static int mglStringInternalResize(MGLStringInternal* s, size_t len, char chr)
 {
-    if (s)
+    if (s == NULL || s->failed)
+        return 0;
+
+    if (len + 1 > s->cap)
     {
-        if (len + 1 > s->cap)
+        // Grow string buffer, in place if the allocator supports it
+        size_t new_cap  = MGL_MAX(len + 1, s->cap * 2);
+        char* new_buf   = (char*)mglRealloc(s->allocator, s->buf, s->cap, new_cap);
+
+        if (new_buf == NULL)
         {
-            // Allocate new string buffer and copy previous string into new buffer
-            size_t new_cap  = MGL_MAX(len + 1, s->cap * 2);
-            char* new_buf   = MGL_CALLOC(char, new_cap);
-            memcpy(new_buf, s->buf, s->len);
+            s->failed = 1;
+            return 0;
+        }
 
-            // Initialize new characters
-            if (chr != 0)
-            {
-                for (size_t i = s->len; i < len; ++i)
-                    new_buf[i] = chr;
+        // Initialize new characters
+        if (chr != 0)
+        {
+            for (size_t i = s->len; i < len; ++i)
+                new_buf[i] = chr;
+        }
+        new_buf[len] = '\0';
+
+        // Replace previous string
+        s->cap = new_cap;
+        s->len = len;
+        s->buf = new_buf;
+    }
+    else if (len < s->len)
+    {
+        // Keep the capacity, so reused strings do not reallocate when they grow again
+        s->buf[len] = '\0';
+        s->len = len;
+    }
+    else if (len > s->len)
+    {
+        // Initialize new characters
+        if (chr != 0)
+        {
+            for (size_t i = s->len; i < len; ++i)
+                s->buf[i] = chr;
+        }
+        s->buf[len] = '\0';
+        s->len = len;
+    }
+
+    return 1;
+}
+
+// Appends the specified appendix to the internal string object
+static void mglStringInternalAppend(MGLStringInternal* s, const MGLStringInternal* appendix)
+{
+    if (s && appendix && appendix->len > 0)
+    {
+        // Resize string and copy appendix into new area
+        size_t lhs_len = s->len;
+        if (mglStringInternalResize(s, lhs_len + appendix->len, 0))
+            memcpy(s->buf + lhs_len, appendix->buf, appendix->len);
+    }
+}
+
+// Appends the specified appendix sub-string (with offset and length) to the internal string object
+static void mglStringInternalAppendSub(MGLStringInternal* s, const MGLStringInternal* appendix, size_t off, size_t len)
+{
+    if (s && appendix && appendix->len > off && len > 0)
+    {
+        // Resize string and copy appendix into new area
+        size_t lhs_len = s->len;
+        size_t rhs_len = MGL_MIN(len, appendix->len - off);
+        if (rhs_len > 0 && mglStringInternalResize(s, lhs_len + rhs_len, 0))
+            memcpy(s->buf + lhs_len, appendix->buf + off, rhs_len);
+    }
+}
+
+// Appends the specified appendix to the internal string object
+static void mglStringInternalAppendCStr(MGLStringInternal* s, const char* appendix)
+{
+    if (s && appendix && *appendix != '\0')
+    {
+        // Resize string and copy appendix into new area
+        size_t lhs_len = s->len;
+        size_t rhs_len = strlen(appendix);
+        if (mglStringInternalResize(s, lhs_len + rhs_len, 0))
+            memcpy(s->buf + lhs_len, appendix, rhs_len);
+    }
+}
+
+static size_t mglStringInternalFindChar(const MGLStringInternal* s, char search_char, size_t off, size_t len)
+{
+    if (s)
+    {
+        len = MGL_MIN(len, s->len);
+        for (; off < len; ++off)
+        {
+            if (s->buf[off] == search_char)
+                return off;
+        }
+    }
+    return MGL_STRING_NPOS;
+}
+
+static void mglGetIntegerDynamicArray(GLenum pname, GLint* data, GLuint count, GLuint limit, const MGLAllocator* allocator)
+{
+    if (count > limit)
+    {
+        // Allocate temporary container if the array is too small
+        GLint* tmp_data = (GLint*)mglAlloc(allocator, sizeof(GLint)*count);
+        if (tmp_data == NULL)
+        {
+            // Array can not be queried without overflowing 'data'
+            memset(data, 0, sizeof(GLint)*limit);
+            return;
+        }
+        glGetIntegerv(pname, tmp_data);
+        memcpy(data, tmp_data, sizeof(GLint)*limit);
+        mglFree(allocator, tmp_data, sizeof(GLint)*count);
+    }
+    else
+        glGetIntegerv(pname, data);
+}
+
+// Queries the first 'count' of 'max_count' elements and zero-fills the rest. Returns the number of glGet calls; requires GL 3.0
+static GLuint mglGetIntegerStaticArray(GLenum pname, GLint* data, GLuint count, GLuint max_count)
+{
+    count = MGL_MIN(count, max_count);
+    memset(&(data[count]), 0, sizeof(GLint)*(max_count - count));
+    #ifdef GL_VERSION_3_0
+    for (GLuint i = 0; i < count; ++i)
+        glGetIntegeri_v(pname, i, &(data[i]));
+    return count;
+    #else
+    (void)pname;
+    memset(data, 0, sizeof(GLint)*count);
+    return 0;
+    #endif
+}
+
+// Queries the first 'count' of 'max_count' elements and zero-fills the rest. Returns the number of glGet calls; requires GL 3.2
+static GLuint mglGetInteger64StaticArray(GLenum pname, GLint64* data, GLuint count, GLuint max_count)
+{
+    count = MGL_MIN(count, max_count);
+    memset(&(data[count]), 0, sizeof(GLint64)*(max_count - count));
+    #ifdef GL_VERSION_3_2
+    for (GLuint i = 0; i < count; ++i)
+        glGetInteger64i_v(pname, i, &(data[i]));
+    return count;
+    #else
+    (void)pname;
+    memset(data, 0, sizeof(GLint64)*count);
+    return 0;
+    #endif
+}
+
+// Returns the current wall time in seconds, or 0 if MENTAL_GL_QUERY_STATS is not defined
+static double mglQueryStatsTime(void)
+{
+    #if defined MENTAL_GL_QUERY_STATS && defined _WIN32
+    LARGE_INTEGER frequency, counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart / (double)frequency.QuadPart;
+    #elif defined MENTAL_GL_QUERY_STATS && defined CLOCK_MONOTONIC
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (double)t.tv_sec + (double)t.tv_nsec * 1.0e-9;
+    #elif defined MENTAL_GL_QUERY_STATS
+    // Fall back to processor time if POSIX clocks are not available (e.g. strict ISO C without _POSIX_C_SOURCE)
+    return (double)clock() / (double)CLOCKS_PER_SEC;
+    #else
+    return 0.0;
+    #endif
+}
+
+// Returns the index of the specified GL version, encoded as ((MAJOR << 16) | MINOR), within MGLQueryStats::versions
+static size_t mglQueryStatsVersionIndex(unsigned version)
+{
+    // Internal constant parameters
+    static const size_t g_firstIndex[] = { 0, 0, 6, 8, 12 }; // GL 1.0, 2.0, 3.0, 4.0
+
+    const unsigned major = MGL_MAX(1u, MGL_MIN(version >> 16, 4u));
+    return MGL_MIN(g_firstIndex[major] + (version & 0xFFFF), (size_t)MGL_QUERY_STATS_VERSIONS - 1);
+}
+
+// Adds a store into the specified shadow entry to the current wrapper call of the redundancy counter; each field is only counted once per call
+static void mglCountShadowStore(MGLShadowState* shadow, const void* entry, int changed)
+{
+    MGLRedundancyCounterInternal* counter = (MGLRedundancyCounterInternal*)shadow->redundancy;
+
+    const char* p   = (const char*)entry;
+    const char* rs  = (const char*)&(shadow->render_state);
+
+    // Map shadow entry to its field index; all entries besides the render state are sampler bindings
+    unsigned short field = counter->sampler_binding_field;
+
+    if (p >= rs && p < rs + sizeof(MGLRenderState))
+        field = counter->fields[p - rs];
+
+    for (size_t i = 0; i < counter->num_call_fields; ++i)
+    {
+        if (counter->call_fields[i] == field)
+        {
+            counter->call_changed[i] |= (unsigned char)changed;
+            return;
+        }
+    }
+
+    if (counter->num_call_fields < MGL_MAX_SHADOW_CALL_FIELDS)
+    {
+        counter->call_fields[counter->num_call_fields]  = field;
+        counter->call_changed[counter->num_call_fields] = (unsigned char)changed;
+        ++(counter->num_call_fields);
+    }
+}
+
+// Stores 'size' bytes of 'value' into the specified shadow entry and counts the store if the shadow state has a redundancy counter
+static void mglShadowStore(MGLShadowState* shadow, void* entry, const void* value, size_t size)
+{
+    if (shadow->redundancy != NULL)
+        mglCountShadowStore(shadow, entry, memcmp(entry, value, size) != 0);
+    memcpy(entry, value, size);
+}
+
+static void mglShadowStoreBoolean(MGLShadowState* shadow, GLboolean* entry, GLboolean value)
+{
+    mglShadowStore(shadow, entry, &value, sizeof(value));
+}
+
+static void mglShadowStoreInteger(MGLShadowState* shadow, GLint* entry, GLint value)
+{
+    mglShadowStore(shadow, entry, &value, sizeof(value));
+}
+
+#ifdef GL_VERSION_3_2
+static void mglShadowStoreInteger64(MGLShadowState* shadow, GLint64* entry, GLint64 value)
+{
+    mglShadowStore(shadow, entry, &value, sizeof(value));
+}
+#endif
+
+static void mglShadowStoreFloat(MGLShadowState* shadow, GLfloat* entry, GLfloat value)
+{
+    mglShadowStore(shadow, entry, &value, sizeof(value));
+}
+
+static void mglShadowStoreDouble(MGLShadowState* shadow, GLdouble* entry, GLdouble value)
+{
+    mglShadowStore(shadow, entry, &value, sizeof(value));
+}
+
+// Finishes the current wrapper call of the redundancy counter. A call is redundant for each field it did not change, and redundant for its call site if it did not change any field
+static void mglShadowEndCall(MGLShadowState* shadow)
+{
+    MGLRedundancyCounterInternal* counter = (MGLRedundancyCounterInternal*)shadow->redundancy;
+
+    if (counter == NULL || counter->num_call_fields == 0)
+        return;
+
+    int changed = 0;
+
+    for (size_t i = 0; i < counter->num_call_fields; ++i)
+    {
+        const unsigned short field = counter->call_fields[i];
+        if (field != MGL_REDUNDANCY_NO_FIELD)
+        {
+            ++(counter->num_calls[field]);
+            if (!counter->call_changed[i])
+                ++(counter->num_redundant[field]);
+        }
+        changed |= counter->call_changed[i];
+    }
+
+    MGLRedundancyCallSite* site = &(counter->sites[counter->site]);
+    ++(site->num_calls);
+    if (!changed)
+        ++(site->num_redundant);
+
+    counter->num_call_fields = 0;
+}
+
+// Returns the shadow entry for the specified capability, or NULL if the capability is not tracked
+static GLboolean* mglShadowCapability(MGLRenderState* rs, GLenum cap)
+{
+    switch (cap)
+    {
+        case GL_BLEND:                  return &(rs->bBlend);
+        case GL_CULL_FACE:              return &(rs->bCullFace);
+        case GL_DEPTH_TEST:             return &(rs->bDepthTest);
+        case GL_DITHER:                 return &(rs->bDither);
+        case GL_LINE_SMOOTH:            return &(rs->bLineSmooth);
+        case GL_POLYGON_SMOOTH:         return &(rs->bPolygonSmooth);
+        case GL_SCISSOR_TEST:           return &(rs->bScissorTest);
+        case GL_STENCIL_TEST:           return &(rs->bStencilTest);
+        #ifdef GL_VERSION_1_1
+        case GL_COLOR_LOGIC_OP:         return &(rs->bColorLogicOp);
+        case GL_POLYGON_OFFSET_FILL:    return &(rs->bPolygonOffsetFill);
+        case GL_POLYGON_OFFSET_LINE:    return &(rs->bPolygonOffsetLine);
+        case GL_POLYGON_OFFSET_POINT:   return &(rs->bPolygonOffsetPoint);
+        #endif // /GL_VERSION_1_1
+        #ifdef GL_VERSION_3_2
+        case GL_PROGRAM_POINT_SIZE:     return &(rs->bProgramPointSize);
+        #endif // /GL_VERSION_3_2
+    }
+    return NULL;
+}
+
+// Returns the shadow entry of the texture binding of the active texture unit for the specified target, or NULL if the target is not tracked
+static GLint* mglShadowTextureBinding(MGLRenderState* rs, GLenum target)
+{
+    switch (target)
+    {
+        case GL_TEXTURE_1D:                     return &(rs->iTextureBinding1D);
+        case GL_TEXTURE_2D:                     return &(rs->iTextureBinding2D);
+        #ifdef GL_VERSION_1_2
+        case GL_TEXTURE_3D:                     return &(rs->iTextureBinding3D);
+        #endif // /GL_VERSION_1_2
+        #ifdef GL_VERSION_1_3
+        case GL_TEXTURE_CUBE_MAP:               return &(rs->iTextureBindingCubeMap);
+        #endif // /GL_VERSION_1_3
+        #ifdef GL_VERSION_3_0
+        case GL_TEXTURE_1D_ARRAY:               return &(rs->iTextureBinding1DArray);
+        case GL_TEXTURE_2D_ARRAY:               return &(rs->iTextureBinding2DArray);
+        #endif // /GL_VERSION_3_0
+        #ifdef GL_VERSION_3_1
+        case GL_TEXTURE_BUFFER:                 return &(rs->iTextureBindingBuffer);
+        case GL_TEXTURE_RECTANGLE:              return &(rs->iTextureBindingRectangle);
+        #endif // /GL_VERSION_3_1
+        #ifdef GL_VERSION_3_2
+        case GL_TEXTURE_2D_MULTISAMPLE:         return &(rs->iTextureBinding2DMultisample);
+        case GL_TEXTURE_2D_MULTISAMPLE_ARRAY:   return &(rs->iTextureBinding2DMultisampleArray);
+        #endif // /GL_VERSION_3_2
+    }
+    return NULL;
+}
+
+// Returns the shadow entries of the texture bindings of all texture units for the specified target, or NULL if the target is not tracked
+static GLint* mglShadowTextureBindingPoints(MGLBindingPoints* bp, GLenum target)
+{
+    switch (target)
+    {
+        case GL_TEXTURE_1D:                     return bp->iTextureBinding1D;
+        case GL_TEXTURE_2D:                     return bp->iTextureBinding2D;
+        #ifdef GL_VERSION_1_2
+        case GL_TEXTURE_3D:                     return bp->iTextureBinding3D;
+        #endif // /GL_VERSION_1_2
+        #ifdef GL_VERSION_1_3
+        case GL_TEXTURE_CUBE_MAP:               return bp->iTextureBindingCubeMap;
+        #endif // /GL_VERSION_1_3
+        #ifdef GL_VERSION_3_0
+        case GL_TEXTURE_1D_ARRAY:               return bp->iTextureBinding1DArray;
+        case GL_TEXTURE_2D_ARRAY:               return bp->iTextureBinding2DArray;
+        #endif // /GL_VERSION_3_0
+        #ifdef GL_VERSION_3_1
+        case GL_TEXTURE_BUFFER:                 return bp->iTextureBindingBuffer;
+        case GL_TEXTURE_RECTANGLE:              return bp->iTextureBindingRectangle;
+        #endif // /GL_VERSION_3_1
+        #ifdef GL_VERSION_3_2
+        case GL_TEXTURE_2D_MULTISAMPLE:         return bp->iTextureBinding2DMultisample;
+        case GL_TEXTURE_2D_MULTISAMPLE_ARRAY:   return bp->iTextureBinding2DMultisampleArray;
+        #endif // /GL_VERSION_3_2
+    }
+    return NULL;
+}
+
+// Stores an indexed buffer binding in the shadow entries. Ranges are only tracked if they are queried, i.e. for GL 3.2 and later
+static void mglShadowStoreIndexedBuffer(MGLShadowState* shadow, GLint* bindings, GLint64* starts, GLint64* sizes, GLuint limit, GLuint index, GLuint buffer, GLint64 offset, GLint64 size)
+{
+    #define MGL_VERSION(MAJOR, MINOR)       (((MAJOR) << 16) | (MINOR))
+    #define MGL_VERSION_MIN(MAJOR, MINOR)   MGL_IS_VERSION_SUPPORTED(MGL_VERSION(shadow->render_state.iMajorVersion, shadow->render_state.iMinorVersion), MGL_VERSION(MAJOR, MINOR))
+
+    if (index < limit)
+    {
+        mglShadowStoreInteger(shadow, &(bindings[index]), (GLint)buffer);
+        #ifdef GL_VERSION_3_2
+        if (MGL_VERSION_MIN(3, 2))
+        {
+            mglShadowStoreInteger64(shadow, &(starts[index]), offset);
+            mglShadowStoreInteger64(shadow, &(sizes[index]), size);
+        }
+        #else
+        (void)starts;
+        (void)sizes;
+        (void)offset;
+        (void)size;
+        #endif
+    }
+
+    #undef MGL_VERSION
+    #undef MGL_VERSION_MIN
+}
+
+// Stores an indexed buffer binding for the specified target in the shadow state
+static void mglShadowIndexedBufferBinding(MGLShadowState* shadow, GLenum target, GLuint index, GLuint buffer, GLint64 offset, GLint64 size)
+{
+    MGLRenderState* rs = &(shadow->render_state);
+    switch (target)
+    {
+        #ifdef GL_VERSION_3_0
+        case GL_TRANSFORM_FEEDBACK_BUFFER:
+            mglShadowStoreIndexedBuffer(shadow, rs->iTransformFeedbackBufferBinding, rs->iTransformFeedbackBufferStart, rs->iTransformFeedbackBufferSize, MGL_MAX_TRANSFORM_FEEDBACK_BUFFER_BINDINGS, index, buffer, offset, size);
+            break;
+        #endif // /GL_VERSION_3_0
+        #ifdef GL_VERSION_3_1
+        case GL_UNIFORM_BUFFER:
+            mglShadowStoreIndexedBuffer(shadow, rs->iUniformBufferBinding, rs->iUniformBufferStart, rs->iUniformBufferSize, MGL_MAX_UNIFORM_BUFFER_BINDINGS, index, buffer, offset, size);
+            break;
+        #endif // /GL_VERSION_3_1
+        #ifdef GL_VERSION_4_3
+        case GL_SHADER_STORAGE_BUFFER:
+            mglShadowStoreIndexedBuffer(shadow, rs->iShaderStorageBufferBinding, rs->iShaderStorageBufferStart, rs->iShaderStorageBufferSize, MGL_MAX_SHADER_STORAGE_BUFFER_BINDINGS, index, buffer, offset, size);
+            break;
+        #endif // /GL_VERSION_4_3
+    }
+}
+
+// Queries the sampler bindings of all texture units [GL_TEXTURE0 .. GL_TEXTURE31] for the shadow state
+static void mglShadowQuerySamplerBindings(MGLShadowState* shadow)
+{
+    memset(shadow->sampler_bindings, 0, sizeof(shadow->sampler_bindings));
+
+    #define MGL_VERSION(MAJOR, MINOR)       (((MAJOR) << 16) | (MINOR))
+    #define MGL_VERSION_MIN(MAJOR, MINOR)   MGL_IS_VERSION_SUPPORTED(MGL_VERSION(shadow->render_state.iMajorVersion, shadow->render_state.iMinorVersion), MGL_VERSION(MAJOR, MINOR))
+
+    #ifdef GL_VERSION_3_3
+    if (MGL_VERSION_MIN(3, 3))
+    {
+        // Store current active texture layer
+        GLint iPrevActiveTexture = 0;
+        glGetIntegerv(GL_ACTIVE_TEXTURE, &iPrevActiveTexture);
+
+        // Don't query texture units beyond the actual number of units
+        const GLint num_layers = MGL_MAX(1, MGL_MIN(MGL_MAX_TEXTURE_LAYERS, shadow->limits.iMaxCombinedTextureImageUnits));
+
+        for (GLint layer = 0; layer < num_layers; ++layer)
+        {
+            glActiveTexture(GL_TEXTURE0 + layer);
+            glGetIntegerv(GL_SAMPLER_BINDING, &(shadow->sampler_bindings[layer]));
+        }
+
+        // Restore previous active texture layer
+        glActiveTexture(iPrevActiveTexture);
+    }
+    #endif // /GL_VERSION_3_3
+
+    #undef MGL_VERSION
+    #undef MGL_VERSION_MIN
+}
+
+// Loads the texture and sampler bindings of the active texture unit into the shadow render state
+static void mglShadowLoadActiveTextureUnit(MGLShadowState* shadow)
+{
+    MGLRenderState* rs = &(shadow->render_state);
+    const MGLBindingPoints* bp = &(shadow->binding_points);
+    const GLint layer = rs->iActiveTexture - GL_TEXTURE0;
+
+    if (layer >= 0 && layer < MGL_MAX_TEXTURE_LAYERS)
+    {
+        rs->iTextureBinding1D                   = bp->iTextureBinding1D[layer];
+        rs->iTextureBinding1DArray              = bp->iTextureBinding1DArray[layer];
+        rs->iTextureBinding2D                   = bp->iTextureBinding2D[layer];
+        rs->iTextureBinding2DArray              = bp->iTextureBinding2DArray[layer];
+        rs->iTextureBinding2DMultisample        = bp->iTextureBinding2DMultisample[layer];
+        rs->iTextureBinding2DMultisampleArray   = bp->iTextureBinding2DMultisampleArray[layer];
+        rs->iTextureBinding3D                   = bp->iTextureBinding3D[layer];
+        rs->iTextureBindingBuffer               = bp->iTextureBindingBuffer[layer];
+        rs->iTextureBindingCubeMap              = bp->iTextureBindingCubeMap[layer];
+        rs->iTextureBindingRectangle            = bp->iTextureBindingRectangle[layer];
+        rs->iSamplerBinding                     = shadow->sampler_bindings[layer];
+    }
+    else
+    {
+        // Texture unit is not covered by the binding points, so query the texture states of this unit
+        MGLRenderState tex_rs;
+        MGLQueryOptions options = { MGLStateCategoryTextures, &(shadow->limits), NULL, NULL, NULL };
+        mglQueryRenderStateEx(&tex_rs, &options);
+
+        rs->iTextureBinding1D                   = tex_rs.iTextureBinding1D;
+        rs->iTextureBinding1DArray              = tex_rs.iTextureBinding1DArray;
+        rs->iTextureBinding2D                   = tex_rs.iTextureBinding2D;
+        rs->iTextureBinding2DArray              = tex_rs.iTextureBinding2DArray;
+        rs->iTextureBinding2DMultisample        = tex_rs.iTextureBinding2DMultisample;
+        rs->iTextureBinding2DMultisampleArray   = tex_rs.iTextureBinding2DMultisampleArray;
+        rs->iTextureBinding3D                   = tex_rs.iTextureBinding3D;
+        rs->iTextureBindingBuffer               = tex_rs.iTextureBindingBuffer;
+        rs->iTextureBindingCubeMap              = tex_rs.iTextureBindingCubeMap;
+        rs->iTextureBindingRectangle            = tex_rs.iTextureBindingRectangle;
+        rs->iSamplerBinding                     = tex_rs.iSamplerBinding;
+    }
+}
+
+// Re-queries the states that are owned by the bound vertex array object
+static void mglShadowQueryVertexArrayStates(MGLShadowState* shadow)
+{
+    MGLRenderState* rs = &(shadow->render_state);
+
+    #define MGL_VERSION(MAJOR, MINOR)       (((MAJOR) << 16) | (MINOR))
+    #define MGL_VERSION_MIN(MAJOR, MINOR)   MGL_IS_VERSION_SUPPORTED(MGL_VERSION(rs->iMajorVersion, rs->iMinorVersion), MGL_VERSION(MAJOR, MINOR))
+
+    glGetIntegerv(GL_ELEMENT_ARRAY_BUFFER_BINDING, &(rs->iElementArrayBufferBinding));
+
+    #ifdef GL_VERSION_4_3
+    if (MGL_VERSION_MIN(4, 3))
+    {
+        // Don't query vertex buffer bindings beyond the actual number of bindings
+        const GLuint num_bindings = (GLuint)MGL_MAX(0, shadow->limits.iMaxVertexAttribBindings);
+        mglGetIntegerStaticArray(GL_VERTEX_BINDING_DIVISOR, &(rs->iVertexBindingDivisor[0]), num_bindings, MGL_MAX_VERTEX_BUFFER_BINDINGS);
+        mglGetIntegerStaticArray(GL_VERTEX_BINDING_OFFSET, &(rs->iVertexBindingOffset[0]), num_bindings, MGL_MAX_VERTEX_BUFFER_BINDINGS);
+        mglGetIntegerStaticArray(GL_VERTEX_BINDING_STRIDE, &(rs->iVertexBindingStride[0]), num_bindings, MGL_MAX_VERTEX_BUFFER_BINDINGS);
+    }
+    #endif // /GL_VERSION_4_3
+
+    #undef MGL_VERSION
+    #undef MGL_VERSION_MIN
+}
+
+// Queries the number of stencil bits of the bound draw framebuffer for the shadow state
+static void mglShadowQueryStencilBits(MGLShadowState* shadow)
+{
+    const MGLRenderState* rs = &(shadow->render_state);
+
+    #define MGL_VERSION(MAJOR, MINOR)       (((MAJOR) << 16) | (MINOR))
+    #define MGL_VERSION_MIN(MAJOR, MINOR)   MGL_IS_VERSION_SUPPORTED(MGL_VERSION(rs->iMajorVersion, rs->iMinorVersion), MGL_VERSION(MAJOR, MINOR))
+
+    shadow->stencil_bits = 0;
+
+    #ifdef GL_VERSION_3_0
+    if (MGL_VERSION_MIN(3, 0))
+    {
+        // GL_STENCIL_BITS is not available in core profiles; the stencil size can only be queried if there is a stencil attachment
+        const GLenum attachment = (rs->iDrawFramebufferBinding != 0 ? GL_STENCIL_ATTACHMENT : GL_STENCIL);
+        GLint type = GL_NONE;
+        glGetFramebufferAttachmentParameteriv(GL_DRAW_FRAMEBUFFER, attachment, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE, &type);
+        if (type != GL_NONE)
+            glGetFramebufferAttachmentParameteriv(GL_DRAW_FRAMEBUFFER, attachment, GL_FRAMEBUFFER_ATTACHMENT_STENCIL_SIZE, &(shadow->stencil_bits));
+    }
+    else
+    #endif // /GL_VERSION_3_0
+    glGetIntegerv(GL_STENCIL_BITS, &(shadow->stencil_bits));
+
+    #undef MGL_VERSION
+    #undef MGL_VERSION_MIN
+}
+
+// Clamps the stencil reference value 'ref' to [0, 2^s - 1] where 's' is the number of stencil bits, as it is reported by GL
+static GLint mglShadowClampStencilRef(const MGLShadowState* shadow, GLint ref)
+{
+    const GLint max_ref = (shadow->stencil_bits >= 31 ? 0x7FFFFFFF : (GLint)((1u << MGL_MAX(0, shadow->stencil_bits)) - 1u));
+    return MGL_MAX(0, MGL_MIN(ref, max_ref));
+}
+
+// Re-queries the states that are owned by the bound framebuffer objects
+static void mglShadowQueryFramebufferStates(MGLShadowState* shadow)
+{
+    MGLRenderState* rs = &(shadow->render_state);
+
+    #define MGL_VERSION(MAJOR, MINOR)       (((MAJOR) << 16) | (MINOR))
+    #define MGL_VERSION_MIN(MAJOR, MINOR)   MGL_IS_VERSION_SUPPORTED(MGL_VERSION(rs->iMajorVersion, rs->iMinorVersion), MGL_VERSION(MAJOR, MINOR))
+
+    // Stencil reference values are reported clamped to the stencil bits of the bound draw framebuffer
+    mglShadowQueryStencilBits(shadow);
+    glGetIntegerv(GL_STENCIL_REF, &(rs->iStencilRef));
+
+    #ifdef GL_VERSION_2_0
+    if (MGL_VERSION_MIN(2, 0))
+        glGetIntegerv(GL_STENCIL_BACK_REF, &(rs->iStencilBackRef));
+    #endif // /GL_VERSION_2_0
+
+    glGetIntegerv(GL_DRAW_BUFFER, &(rs->iDrawBuffer));
+    glGetIntegerv(GL_READ_BUFFER, &(rs->iReadBuffer));
+
+    #ifdef GL_VERSION_1_3
+    if (MGL_VERSION_MIN(1, 3))
+    {
+        glGetIntegerv(GL_SAMPLE_BUFFERS, &(rs->iSampleBuffers));
+        glGetIntegerv(GL_SAMPLES, &(rs->iSamples));
+    }
+    #endif // /GL_VERSION_1_3
+
+    #ifdef GL_VERSION_2_0
+    if (MGL_VERSION_MIN(2, 0))
+    {
+        for (GLint i = 0; i < 16; ++i)
+            glGetIntegerv(GL_DRAW_BUFFER0 + i, &(rs->iDrawBuffer_i[i]));
+    }
+    #endif // /GL_VERSION_2_0
+
+    #ifdef GL_VERSION_4_1
+    if (MGL_VERSION_MIN(4, 1))
+    {
+        glGetIntegerv(GL_IMPLEMENTATION_COLOR_READ_FORMAT, &(rs->iImplementationColorReadFormat));
+        glGetIntegerv(GL_IMPLEMENTATION_COLOR_READ_TYPE, &(rs->iImplementationColorReadType));
+    }
+    #endif // /GL_VERSION_4_1
+
+    #undef MGL_VERSION
+    #undef MGL_VERSION_MIN
+}
+
+// Writes the decimal representation of 'val' into 's' (incl. NUL char) and returns its length; 's' must provide space for 21 characters
+static size_t mglFormatUInt64(char* s, unsigned long long val)
+{
+    // Internal constant parameters
+    static const char* g_digitPairs = "0001020304050607080910111213141516171819202122232425262728293031323334353637383940414243444546474849"
+                                      "5051525354555657585960616263646566676869707172737475767778798081828384858687888990919293949596979899";
+
+    char    buf[20];
+    char*   p = buf + sizeof(buf);
+
+    // Emit two digits at a time from the end
+    while (val >= 100)
+    {
+        const unsigned d = (unsigned)(val % 100) * 2;
+        val /= 100;
+        *--p = g_digitPairs[d + 1];
+        *--p = g_digitPairs[d];
+    }
+
+    if (val >= 10)
+    {
+        const unsigned d = (unsigned)val * 2;
+        *--p = g_digitPairs[d + 1];
+        *--p = g_digitPairs[d];
+    }
+    else
+        *--p = (char)('0' + val);
+
+    const size_t len = (size_t)(buf + sizeof(buf) - p);
+    memcpy(s, p, len);
+    s[len] = '\0';
+
+    return len;
+}
+
+// Writes the decimal representation of 'val' into 's' (incl. NUL char) and returns its length; 's' must provide space for 21 characters
+static size_t mglFormatInt64(char* s, long long val)
+{
+    if (val < 0)
+    {
+        *s = '-';
+        return 1 + mglFormatUInt64(s + 1, 0ull - (unsigned long long)val);
+    }
+    return mglFormatUInt64(s, (unsigned long long)val);
+}
+
+// Writes 'val' with six decimal places into 's' (incl. NUL char) exactly as sprintf with "%f" would, and returns its length
+// Values are converted directly if their rounding can be determined from the scaled value, otherwise sprintf is used; 's' must provide space for 64 characters
+static size_t mglFormatDouble(char* s, double val)
+{
+    unsigned long long bits;
+    memcpy(&bits, &val, sizeof(bits));
+
+    const int       negative    = (int)(bits >> 63);
+    const double    abs_val     = (negative ? -val : val);
+
+    // Scaled value is below 2^40, so its fraction is exact and within 2^-14 of the exact product (NaN fails this comparison)
+    if (abs_val < 1.0e6)
+    {
+        const double        scaled  = abs_val * 1.0e6;
+        unsigned long long  n       = (unsigned long long)scaled;
+        const double        frac    = scaled - (double)n;
+
+        // Only take the fast path if the value is not close to a rounding tie
+        if (frac < 0.4995 || frac > 0.5005)
+        {
+            if (frac > 0.5)
+                ++n;
+
+            char* p = s;
+            if (negative)
+                *p++ = '-';
+
+            // Write integral part and six fractional digits with leading zeros
+            p += mglFormatUInt64(p, n / 1000000);
+            *p++ = '.';
+
+            unsigned long long f = n % 1000000;
+            for (int i = 6; i > 0; --i)
+            {
+                p[i - 1] = (char)('0' + f % 10);
+                f /= 10;
+            }
+            p += 6;
+            *p = '\0';
+
+            return (size_t)(p - s);
+        }
+    }
+
+    // Limit output for huge values to the size of the buffer
+    const int len = snprintf(s, 64, "%f", val);
+    return (size_t)MGL_MIN(len, 63);
+}
+
+static void mglEnumToHex(char* s, unsigned val)
+{
+    // Internal constant parameters
+    static const char* g_hexDigits = "0123456789ABCDEF";
+
+    s[0] = '0';
+    s[1] = 'x';
+    for (int i = 0; i < 8; ++i)
+        s[2 + i] = g_hexDigits[(val >> (28 - i * 4)) & 0xF];
+    s[10] = '\0';
+}
+
+// Appends the specified string pair as formatted line to the string 's'; long arrays are split into multiple lines, one for each element
+static void mglAppendStringPair(MGLStringInternal* s, const MGLStringInternal* cur_par, const MGLStringInternal* cur_val, size_t max_par_len, const MGLFormattingOptions* formatting)
+{
+    const size_t cur_spaces_len = max_par_len - cur_par->len;
+
+    mglStringInternalAppend(s, cur_par);
+    mglStringInternalResize(s, s->len + cur_spaces_len, formatting->separator);
+
+    if (cur_val->len > formatting->array_limit && cur_val->buf[cur_val->len - 1] == '}')
+    {
+        // Append string in multiple lines, one for each element
+        size_t off = 0, next_off = 0;
+
+        while (off < cur_val->len)
+        {
+            // Find end of current element
+            next_off = mglStringInternalFindChar(cur_val, ',', off, MGL_STRING_NPOS);
+            if (next_off != MGL_STRING_NPOS)
+            {
+                mglStringInternalAppendSub(s, cur_val, off, next_off - off + 1);
+                mglStringInternalAppendCStr(s, "\n");
+                mglStringInternalResize(s, s->len + cur_par->len + cur_spaces_len + 1, formatting->separator);
+                off = next_off + 1;
+            }
+            else
+            {
+                mglStringInternalAppendSub(s, cur_val, off, MGL_STRING_NPOS);
+                break;
+            }
+        }
+    }
+    else
+        mglStringInternalAppend(s, cur_val);
+
+    mglStringInternalAppendCStr(s, "\n");
+}
+
+// Formats the specified string pair into the line buffer of the stream and passes it to the write callback
+static void mglWriteStringPair(MGLStringStream* stream, const MGLStringInternal* par, const MGLStringInternal* val)
+{
+    mglStringInternalClear(&(stream->line));
+    mglAppendStringPair(&(stream->line), par, val, stream->max_par_len, stream->formatting);
+
+    // Stop writing once an allocation failed, so no truncated lines are passed to the callback
+    if (!par->failed && !val->failed && !stream->line.failed)
+        stream->proc(stream->line.buf, stream->line.len, stream->user);
+}
+
+// Moves on to the next string pair, or writes the current string pair immediately if the array has a stream
+static void mglNextStringPair(MGLStringPairArray* str_array)
+{
+    if (str_array->stream != NULL)
+        mglWriteStringPair(str_array->stream, &(str_array->first[str_array->index]), &(str_array->second[str_array->index]));
+    else
+        ++(str_array->index);
+}
+
+static void mglNextHeadline(MGLStringPairArray* str_array, const char* headline)
+{
+    mglStringInternalAssign(&(str_array->first[str_array->index]), headline);
+    mglStringInternalClear(&(str_array->second[str_array->index]));
+    mglNextStringPair(str_array);
+}
+
+static void mglNextParamString(MGLStringPairArray* str_array, unsigned category, const char* par, const char* val)
+{
+    if ((str_array->categories & category) == 0)
+        return;
+
+    mglStringInternalAssign(&(str_array->first[str_array->index]), par);
+    mglStringInternalAssign(&(str_array->second[str_array->index]), val);
+    mglNextStringPair(str_array);
+}
+
+static void mglNextParamInteger(MGLStringPairArray* str_array, unsigned category, const char* par, GLint val)
+{
+    if ((str_array->categories & category) == 0)
+        return;
+
+    char s_val[24];
+    mglFormatInt64(s_val, val);
+    mglNextParamString(str_array, category, par, s_val);
+}
+
+static void mglNextParamUInteger(MGLStringPairArray* str_array, unsigned category, const char* par, GLuint val)
+{
+    if ((str_array->categories & category) == 0)
+        return;
+
+    char s_val[24];
+    mglFormatUInt64(s_val, val);
+    mglNextParamString(str_array, category, par, s_val);
+}
+
+static void mglNextParamIntegerHex(MGLStringPairArray* str_array, unsigned category, const char* par, GLint val)
+{
+    if ((str_array->categories & category) == 0)
+        return;
+
+    char s_hex[11];
+    mglEnumToHex(s_hex, (unsigned)val);
+    mglNextParamString(str_array, category, par, s_hex);
+}
+
+static void mglNextParamBoolean(MGLStringPairArray* str_array, unsigned category, const char* par, GLboolean val)
+{
+    if ((str_array->categories & category) == 0)
+        return;
+
+    mglNextParamString(str_array, category, par, (val ? "GL_TRUE" : "GL_FALSE"));
+}
+
+static void mglNextParamEnum(MGLStringPairArray* str_array, unsigned category, const char* par, GLint val, MGLEnumToStringProc proc)
+{
+    if ((str_array->categories & category) == 0)
+        return;
+
+    const char* s_val = proc(val);
+    if (!s_val)
+    {
+        char s_hex[11];
+        mglEnumToHex(s_hex, (unsigned)val);
+        mglNextParamString(str_array, category, par, s_hex);
+    }
+    else
+        mglNextParamString(str_array, category, par, s_val);
+}
+
+static void mglNextParamInteger64(MGLStringPairArray* str_array, unsigned category, const char* par, GLint64 val)
+{
+    if ((str_array->categories & category) == 0)
+        return;
+
+    char s_val[24];
+    mglFormatInt64(s_val, (long long)val);
+    mglNextParamString(str_array, category, par, s_val);
+}
+
+static void mglNextParamFloat(MGLStringPairArray* str_array, unsigned category, const char* par, GLfloat val)
+{
+    if ((str_array->categories & category) == 0)
+        return;
+
+    char s_val[64];
+    mglFormatDouble(s_val, (double)val);
+    mglNextParamString(str_array, category, par, s_val);
+}
+
+static void mglNextParamDouble(MGLStringPairArray* str_array, unsigned category, const char* par, GLdouble val)
+{
+    if ((str_array->categories & category) == 0)
+        return;
+
+    char s_val[64];
+    mglFormatDouble(s_val, val);
+    mglNextParamString(str_array, category, par, s_val);
+}
+
+static void mglNextParamIntegerArray(MGLStringPairArray* str_array, unsigned category, const char* par, const GLint* val, size_t count, size_t limit, int to_hex)
+{
+    if ((str_array->categories & category) == 0)
+        return;
+
+    char s_val[24];
+
+    MGLStringInternal* out_par = &(str_array->first[str_array->index]);
+    MGLStringInternal* out_val = &(str_array->second[str_array->index]);
+
+    mglStringInternalAssign(out_par, par);
+    mglStringInternalClear(out_val);
+
+    mglStringInternalAppendCStr(out_val, "{ ");
+
+    size_t n = MGL_MIN(count, limit);
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        if (to_hex)
+            mglEnumToHex(s_val, (unsigned)val[i]);
+        else
+            mglFormatInt64(s_val, val[i]);
+
+        mglStringInternalAppendCStr(out_val, s_val);
+
+        if (i + 1 < n)
+            mglStringInternalAppendCStr(out_val, ", ");
+    }
+
+    if (count > limit)
+        mglStringInternalAppendCStr(out_val, ", ... ");
+
+    mglStringInternalAppendCStr(out_val, " }");
+
+    mglNextStringPair(str_array);
+}
+
+static void mglNextParamEnumArray(MGLStringPairArray* str_array, unsigned category, const char* par, const GLint* val, size_t count, size_t limit, MGLEnumToStringProc proc)
+{
+    if ((str_array->categories & category) == 0)
+        return;
+
+    MGLStringInternal* out_par = &(str_array->first[str_array->index]);
+    MGLStringInternal* out_val = &(str_array->second[str_array->index]);
+
+    mglStringInternalAssign(out_par, par);
+    mglStringInternalClear(out_val);
+
+    mglStringInternalAppendCStr(out_val, "{ ");
+
+    size_t n = MGL_MIN(count, limit);
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        const char* s_val = proc(val[i]);
+        if (!s_val)
+        {
+            char s_hex[11];
+            mglEnumToHex(s_hex, (unsigned)val[i]);
+            mglStringInternalAppendCStr(out_val, s_hex);
+        }
+        else
+            mglStringInternalAppendCStr(out_val, s_val);
+
+        if (i + 1 < n)
+            mglStringInternalAppendCStr(out_val, ", ");
+    }
+
+    if (count > limit)
+        mglStringInternalAppendCStr(out_val, ", ... ");
+
+    mglStringInternalAppendCStr(out_val, " }");
+
+    mglNextStringPair(str_array);
+}
+
+static void mglNextParamInteger64Array(MGLStringPairArray* str_array, unsigned category, const char* par, const GLint64* val, size_t count, size_t limit)
+{
+    if ((str_array->categories & category) == 0)
+        return;
+
+    char s_val[24];
+
+    MGLStringInternal* out_par = &(str_array->first[str_array->index]);
+    MGLStringInternal* out_val = &(str_array->second[str_array->index]);
+
+    mglStringInternalAssign(out_par, par);
+    mglStringInternalClear(out_val);
+
+    mglStringInternalAppendCStr(out_val, "{ ");
+
+    size_t n = MGL_MIN(count, limit);
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        mglFormatInt64(s_val, (long long)val[i]);
+
+        mglStringInternalAppendCStr(out_val, s_val);
+
+        if (i + 1 < n)
+            mglStringInternalAppendCStr(out_val, ", ");
+    }
+
+    if (count > limit)
+        mglStringInternalAppendCStr(out_val, ", ... ");
+
+    mglStringInternalAppendCStr(out_val, " }");
+
+    mglNextStringPair(str_array);
+}
+
+static void mglNextParamBitfield(MGLStringPairArray* str_array, unsigned category, const char* par, GLbitfield val, size_t count, MGLEnumToStringProc proc)
+{
+    if ((str_array->categories & category) == 0)
+        return;
+
+    size_t num_fields = 0;
+
+    MGLStringInternal* out_par = &(str_array->first[str_array->index]);
+    MGLStringInternal* out_val = &(str_array->second[str_array->index]);
+
+    mglStringInternalAssign(out_par, par);
+    mglStringInternalClear(out_val);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        GLenum flag = (1u << i);
+        if ((val & flag) != 0)
+        {
+            if (num_fields > 0)
+                mglStringInternalAppendCStr(out_val, " | ");
+            ++num_fields;
+
+            const char* s_val = proc(flag);
+            if (!s_val)
+            {
+                char s_hex[11];
+                mglEnumToHex(s_hex, (unsigned)val);
+                mglStringInternalAppendCStr(out_val, s_hex);
+            }
+            else
+                mglStringInternalAppendCStr(out_val, s_val);
+        }
+    }
+
+    if (num_fields == 0)
+        mglStringInternalAppendCStr(out_val, "0");
+
+    mglNextStringPair(str_array);
+}
+
+static void mglNextParamFloatArray(MGLStringPairArray* str_array, unsigned category, const char* par, const GLfloat* val, size_t count)
+{
+    if ((str_array->categories & category) == 0)
+        return;
+
+    char s_val[64];
+
+    MGLStringInternal* out_par = &(str_array->first[str_array->index]);
+    MGLStringInternal* out_val = &(str_array->second[str_array->index]);
+
+    mglStringInternalAssign(out_par, par);
+    mglStringInternalClear(out_val);
+
+    mglStringInternalAppendCStr(out_val, "{ ");
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        mglFormatDouble(s_val, (double)val[i]);
+        mglStringInternalAppendCStr(out_val, s_val);
+
+        if (i + 1 < count)
+            mglStringInternalAppendCStr(out_val, ", ");
+    }
+
+    mglStringInternalAppendCStr(out_val, " }");
+
+    mglNextStringPair(str_array);
+}
+
+static void mglNextParamDoubleArray(MGLStringPairArray* str_array, unsigned category, const char* par, const GLdouble* val, size_t count)
+{
+    if ((str_array->categories & category) == 0)
+        return;
+
+    char s_val[64];
+
+    MGLStringInternal* out_par = &(str_array->first[str_array->index]);
+    MGLStringInternal* out_val = &(str_array->second[str_array->index]);
+
+    mglStringInternalAssign(out_par, par);
+    mglStringInternalClear(out_val);
+
+    mglStringInternalAppendCStr(out_val, "{ ");
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        mglFormatDouble(s_val, val[i]);
+        mglStringInternalAppendCStr(out_val, s_val);
+
+        if (i + 1 < count)
+            mglStringInternalAppendCStr(out_val, ", ");
+    }
+
+    mglStringInternalAppendCStr(out_val, " }");
+
+    mglNextStringPair(str_array);
+}
+
+static void mglNextParamBooleanArray(MGLStringPairArray* str_array, unsigned category, const char* par, const GLboolean* val, size_t count)
+{
+    if ((str_array->categories & category) == 0)
+        return;
+
+    MGLStringInternal* out_par = &(str_array->first[str_array->index]);
+    MGLStringInternal* out_val = &(str_array->second[str_array->index]);
+
+    mglStringInternalAssign(out_par, par);
+    mglStringInternalClear(out_val);
+
+    mglStringInternalAppendCStr(out_val, "{ ");
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        mglStringInternalAppendCStr(out_val, (val[i] != GL_FALSE ? "GL_TRUE" : "GL_FALSE"));
+        if (i + 1 < count)
+            mglStringInternalAppendCStr(out_val, ", ");
+    }
+
+    mglStringInternalAppendCStr(out_val, " }");
+
+    mglNextStringPair(str_array);
+}
+
+
+// *****************************************************************
+//      CONVERSION FUNCTIONS
+// *****************************************************************
+
+// Groups of GLenum names; each conversion function only returns names of its own group, since different names share the same value (e.g. GL_NONE and GL_ZERO)
+enum MGLEnumGroup
+{
+    MGLEnumGroupHintMode                        = (1 << 0),
+    MGLEnumGroupCullFaceMode                    = (1 << 1),
+    MGLEnumGroupPolygonMode                     = (1 << 2),
+    MGLEnumGroupFrontFace                       = (1 << 3),
+    MGLEnumGroupLogicOpMode                     = (1 << 4),
+    MGLEnumGroupCompressedTextureInternalFormat = (1 << 5),
+    MGLEnumGroupTexture                         = (1 << 6),
+    MGLEnumGroupBlendFunc                       = (1 << 7),
+    MGLEnumGroupBlendEquationMode               = (1 << 8),
+    MGLEnumGroupDrawBufferMode                  = (1 << 9),
+    MGLEnumGroupStencilOp                       = (1 << 10),
+    MGLEnumGroupCompareFunc                     = (1 << 11),
+    MGLEnumGroupProvokingVertexMode             = (1 << 12),
+    MGLEnumGroupContextFlagBit                  = (1 << 13),
+    MGLEnumGroupImplementationColorReadFormat   = (1 << 14),
+    MGLEnumGroupImplementationColorReadType     = (1 << 15),
+    MGLEnumGroupClipOrigin                      = (1 << 16),
+    MGLEnumGroupClipDepthMode                   = (1 << 17),
+    MGLEnumGroupObjectTarget                    = (1 << 18),
+    MGLEnumGroupInternalFormat                  = (1 << 19),
+};
+
+typedef struct MGLEnumNameEntry
+{
+    GLenum      value;
+    const char* name;
+    unsigned    groups; // Bitwise OR of MGLEnumGroup flags
+}
+MGLEnumNameEntry;
+
+// All GLenum names sorted by their values; values are written as literals so the table does not depend on the available GL headers
+// Multiple names with the same value are sorted by preference, i.e. the first one is returned by mglEnumName
+static const MGLEnumNameEntry g_MGLEnumNames[] =
+{
+    { 0x0000, "GL_NONE",                                        MGLEnumGroupDrawBufferMode },
+    { 0x0000, "GL_ZERO",                                        MGLEnumGroupBlendFunc | MGLEnumGroupStencilOp },
+    { 0x0001, "GL_ONE",                                         MGLEnumGroupBlendFunc },
+    { 0x0001, "GL_CONTEXT_FLAG_FORWARD_COMPATIBLE_BIT",         MGLEnumGroupContextFlagBit },
+    { 0x0002, "GL_CONTEXT_FLAG_DEBUG_BIT",                      MGLEnumGroupContextFlagBit },
+    { 0x0004, "GL_CONTEXT_FLAG_ROBUST_ACCESS_BIT",              MGLEnumGroupContextFlagBit },
+    { 0x0200, "GL_NEVER",                                       MGLEnumGroupCompareFunc },
+    { 0x0201, "GL_LESS",                                        MGLEnumGroupCompareFunc },
+    { 0x0202, "GL_EQUAL",                                       MGLEnumGroupCompareFunc },
+    { 0x0203, "GL_LEQUAL",                                      MGLEnumGroupCompareFunc },
+    { 0x0204, "GL_GREATER",                                     MGLEnumGroupCompareFunc },
+    { 0x0205, "GL_NOTEQUAL",                                    MGLEnumGroupCompareFunc },
+    { 0x0206, "GL_GEQUAL",                                      MGLEnumGroupCompareFunc },
+    { 0x0207, "GL_ALWAYS",                                      MGLEnumGroupCompareFunc },
+    { 0x0300, "GL_SRC_COLOR",                                   MGLEnumGroupBlendFunc },
+    { 0x0301, "GL_ONE_MINUS_SRC_COLOR",                         MGLEnumGroupBlendFunc },
+    { 0x0302, "GL_SRC_ALPHA",                                   MGLEnumGroupBlendFunc },
+    { 0x0303, "GL_ONE_MINUS_SRC_ALPHA",                         MGLEnumGroupBlendFunc },
+    { 0x0304, "GL_DST_ALPHA",                                   MGLEnumGroupBlendFunc },
+    { 0x0305, "GL_ONE_MINUS_DST_ALPHA",                         MGLEnumGroupBlendFunc },
+    { 0x0306, "GL_DST_COLOR",                                   MGLEnumGroupBlendFunc },
+    { 0x0307, "GL_ONE_MINUS_DST_COLOR",                         MGLEnumGroupBlendFunc },
+    { 0x0308, "GL_SRC_ALPHA_SATURATE",                          MGLEnumGroupBlendFunc },
+    { 0x0400, "GL_FRONT_LEFT",                                  MGLEnumGroupDrawBufferMode },
+    { 0x0401, "GL_FRONT_RIGHT",                                 MGLEnumGroupDrawBufferMode },
+    { 0x0402, "GL_BACK_LEFT",                                   MGLEnumGroupDrawBufferMode },
+    { 0x0403, "GL_BACK_RIGHT",                                  MGLEnumGroupDrawBufferMode },
+    { 0x0404, "GL_FRONT",                                       MGLEnumGroupCullFaceMode | MGLEnumGroupDrawBufferMode },
+    { 0x0405, "GL_BACK",                                        MGLEnumGroupCullFaceMode | MGLEnumGroupDrawBufferMode },
+    { 0x0406, "GL_LEFT",                                        MGLEnumGroupDrawBufferMode },
+    { 0x0407, "GL_RIGHT",                                       MGLEnumGroupDrawBufferMode },
+    { 0x0408, "GL_FRONT_AND_BACK",                              MGLEnumGroupCullFaceMode | MGLEnumGroupDrawBufferMode },
+    { 0x0900, "GL_CW",                                          MGLEnumGroupFrontFace },
+    { 0x0901, "GL_CCW",                                         MGLEnumGroupFrontFace },
+    { 0x0DE0, "GL_TEXTURE_1D",                                  MGLEnumGroupObjectTarget },
+    { 0x0DE1, "GL_TEXTURE_2D",                                  MGLEnumGroupObjectTarget },
+    { 0x1100, "GL_DONT_CARE",                                   MGLEnumGroupHintMode },
+    { 0x1101, "GL_FASTEST",                                     MGLEnumGroupHintMode },
+    { 0x1102, "GL_NICEST",                                      MGLEnumGroupHintMode },
+    { 0x1400, "GL_BYTE",                                        MGLEnumGroupImplementationColorReadType },
+    { 0x1401, "GL_UNSIGNED_BYTE",                               MGLEnumGroupImplementationColorReadType },
+    { 0x1402, "GL_SHORT",                                       MGLEnumGroupImplementationColorReadType },
+    { 0x1403, "GL_UNSIGNED_SHORT",                              MGLEnumGroupImplementationColorReadType },
+    { 0x1404, "GL_INT",                                         MGLEnumGroupImplementationColorReadType },
+    { 0x1405, "GL_UNSIGNED_INT",                                MGLEnumGroupImplementationColorReadType },
+    { 0x1406, "GL_FLOAT",                                       MGLEnumGroupImplementationColorReadType },
+    { 0x140B, "GL_HALF_FLOAT",                                  MGLEnumGroupImplementationColorReadType },
+    { 0x1500, "GL_CLEAR",                                       MGLEnumGroupLogicOpMode },
+    { 0x1501, "GL_AND",                                         MGLEnumGroupLogicOpMode },
+    { 0x1502, "GL_AND_REVERSE",                                 MGLEnumGroupLogicOpMode },
+    { 0x1503, "GL_COPY",                                        MGLEnumGroupLogicOpMode },
+    { 0x1504, "GL_AND_INVERTED",                                MGLEnumGroupLogicOpMode },
+    { 0x1505, "GL_NOOP",                                        MGLEnumGroupLogicOpMode },
+    { 0x1506, "GL_XOR",                                         MGLEnumGroupLogicOpMode },
+    { 0x1507, "GL_OR",                                          MGLEnumGroupLogicOpMode },
+    { 0x1508, "GL_NOR",                                         MGLEnumGroupLogicOpMode },
+    { 0x1509, "GL_EQUIV",                                       MGLEnumGroupLogicOpMode },
+    { 0x150A, "GL_INVERT",                                      MGLEnumGroupLogicOpMode | MGLEnumGroupStencilOp },
+    { 0x150B, "GL_OR_REVERSE",                                  MGLEnumGroupLogicOpMode },
+    { 0x150C, "GL_COPY_INVERTED",                               MGLEnumGroupLogicOpMode },
+    { 0x150D, "GL_OR_INVERTED",                                 MGLEnumGroupLogicOpMode },
+    { 0x150E, "GL_NAND",                                        MGLEnumGroupLogicOpMode },
+    { 0x150F, "GL_SET",                                         MGLEnumGroupLogicOpMode },
+    { 0x1901, "GL_STENCIL_INDEX",                               MGLEnumGroupImplementationColorReadFormat },
+    { 0x1902, "GL_DEPTH_COMPONENT",                             MGLEnumGroupImplementationColorReadFormat },
+    { 0x1903, "GL_RED",                                         MGLEnumGroupImplementationColorReadFormat },
+    { 0x1904, "GL_GREEN",                                       MGLEnumGroupImplementationColorReadFormat },
+    { 0x1905, "GL_BLUE",                                        MGLEnumGroupImplementationColorReadFormat },
+    { 0x1907, "GL_RGB",                                         MGLEnumGroupImplementationColorReadFormat },
+    { 0x1908, "GL_RGBA",                                        MGLEnumGroupImplementationColorReadFormat },
+    { 0x1B00, "GL_POINT",                                       MGLEnumGroupPolygonMode },
+    { 0x1B01, "GL_LINE",                                        MGLEnumGroupPolygonMode },
+    { 0x1B02, "GL_FILL",                                        MGLEnumGroupPolygonMode },
+    { 0x1E00, "GL_KEEP",                                        MGLEnumGroupStencilOp },
+    { 0x1E01, "GL_REPLACE",                                     MGLEnumGroupStencilOp },
+    { 0x1E02, "GL_INCR",                                        MGLEnumGroupStencilOp },
+    { 0x1E03, "GL_DECR",                                        MGLEnumGroupStencilOp },
+    { 0x2A10, "GL_R3_G3_B2",                                    MGLEnumGroupInternalFormat },
+    { 0x8001, "GL_CONSTANT_COLOR",                              MGLEnumGroupBlendFunc },
+    { 0x8002, "GL_ONE_MINUS_CONSTANT_COLOR",                    MGLEnumGroupBlendFunc },
+    { 0x8003, "GL_CONSTANT_ALPHA",                              MGLEnumGroupBlendFunc },
+    { 0x8004, "GL_ONE_MINUS_CONSTANT_ALPHA",                    MGLEnumGroupBlendFunc },
+    { 0x8006, "GL_FUNC_ADD",                                    MGLEnumGroupBlendEquationMode },
+    { 0x8007, "GL_MIN",                                         MGLEnumGroupBlendEquationMode },
+    { 0x8008, "GL_MAX",                                         MGLEnumGroupBlendEquationMode },
+    { 0x800A, "GL_FUNC_SUBTRACT",                               MGLEnumGroupBlendEquationMode },
+    { 0x800B, "GL_FUNC_REVERSE_SUBTRACT",                       MGLEnumGroupBlendEquationMode },
+    { 0x8032, "GL_UNSIGNED_BYTE_3_3_2",                         MGLEnumGroupImplementationColorReadType },
+    { 0x8033, "GL_UNSIGNED_SHORT_4_4_4_4",                      MGLEnumGroupImplementationColorReadType },
+    { 0x8034, "GL_UNSIGNED_SHORT_5_5_5_1",                      MGLEnumGroupImplementationColorReadType },
+    { 0x8035, "GL_UNSIGNED_INT_8_8_8_8",                        MGLEnumGroupImplementationColorReadType },
+    { 0x8036, "GL_UNSIGNED_INT_10_10_10_2",                     MGLEnumGroupImplementationColorReadType },
+    { 0x804F, "GL_RGB4",                                        MGLEnumGroupInternalFormat },
+    { 0x8050, "GL_RGB5",                                        MGLEnumGroupInternalFormat },
+    { 0x8051, "GL_RGB8",                                        MGLEnumGroupInternalFormat },
+    { 0x8052, "GL_RGB10",                                       MGLEnumGroupInternalFormat },
+    { 0x8053, "GL_RGB12",                                       MGLEnumGroupInternalFormat },
+    { 0x8054, "GL_RGB16",                                       MGLEnumGroupInternalFormat },
+    { 0x8055, "GL_RGBA2",                                       MGLEnumGroupInternalFormat },
+    { 0x8056, "GL_RGBA4",                                       MGLEnumGroupInternalFormat },
+    { 0x8057, "GL_RGB5_A1",                                     MGLEnumGroupInternalFormat },
+    { 0x8058, "GL_RGBA8",                                       MGLEnumGroupInternalFormat },
+    { 0x8059, "GL_RGB10_A2",                                    MGLEnumGroupInternalFormat },
+    { 0x805A, "GL_RGBA12",                                      MGLEnumGroupInternalFormat },
+    { 0x805B, "GL_RGBA16",                                      MGLEnumGroupInternalFormat },
+    { 0x806F, "GL_TEXTURE_3D",                                  MGLEnumGroupObjectTarget },
+    { 0x80E0, "GL_BGR",                                         MGLEnumGroupImplementationColorReadFormat },
+    { 0x80E1, "GL_BGRA",                                        MGLEnumGroupImplementationColorReadFormat },
+    { 0x81A5, "GL_DEPTH_COMPONENT16",                           MGLEnumGroupInternalFormat },
+    { 0x81A6, "GL_DEPTH_COMPONENT24",                           MGLEnumGroupInternalFormat },
+    { 0x81A7, "GL_DEPTH_COMPONENT32",                           MGLEnumGroupInternalFormat },
+    { 0x8225, "GL_COMPRESSED_RED",                              MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x8226, "GL_COMPRESSED_RG",                               MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x8229, "GL_R8",                                          MGLEnumGroupInternalFormat },
+    { 0x822A, "GL_R16",                                         MGLEnumGroupInternalFormat },
+    { 0x822B, "GL_RG8",                                         MGLEnumGroupInternalFormat },
+    { 0x822C, "GL_RG16",                                        MGLEnumGroupInternalFormat },
+    { 0x822D, "GL_R16F",                                        MGLEnumGroupInternalFormat },
+    { 0x822E, "GL_R32F",                                        MGLEnumGroupInternalFormat },
+    { 0x822F, "GL_RG16F",                                       MGLEnumGroupInternalFormat },
+    { 0x8230, "GL_RG32F",                                       MGLEnumGroupInternalFormat },
+    { 0x8231, "GL_R8I",                                         MGLEnumGroupInternalFormat },
+    { 0x8232, "GL_R8UI",                                        MGLEnumGroupInternalFormat },
+    { 0x8233, "GL_R16I",                                        MGLEnumGroupInternalFormat },
+    { 0x8234, "GL_R16UI",                                       MGLEnumGroupInternalFormat },
+    { 0x8235, "GL_R32I",                                        MGLEnumGroupInternalFormat },
+    { 0x8236, "GL_R32UI",                                       MGLEnumGroupInternalFormat },
+    { 0x8237, "GL_RG8I",                                        MGLEnumGroupInternalFormat },
+    { 0x8238, "GL_RG8UI",                                       MGLEnumGroupInternalFormat },
+    { 0x8239, "GL_RG16I",                                       MGLEnumGroupInternalFormat },
+    { 0x823A, "GL_RG16UI",                                      MGLEnumGroupInternalFormat },
+    { 0x823B, "GL_RG32I",                                       MGLEnumGroupInternalFormat },
+    { 0x823C, "GL_RG32UI",                                      MGLEnumGroupInternalFormat },
+    { 0x8260, "GL_UNDEFINED_VERTEX",                            MGLEnumGroupProvokingVertexMode },
+    { 0x8362, "GL_UNSIGNED_BYTE_2_3_3_REV",                     MGLEnumGroupImplementationColorReadType },
+    { 0x8363, "GL_UNSIGNED_SHORT_5_6_5",                        MGLEnumGroupImplementationColorReadType },
+    { 0x8364, "GL_UNSIGNED_SHORT_5_6_5_REV",                    MGLEnumGroupImplementationColorReadType },
+    { 0x8365, "GL_UNSIGNED_SHORT_4_4_4_4_REV",                  MGLEnumGroupImplementationColorReadType },
+    { 0x8366, "GL_UNSIGNED_SHORT_1_5_5_5_REV",                  MGLEnumGroupImplementationColorReadType },
+    { 0x8367, "GL_UNSIGNED_INT_8_8_8_8_REV",                    MGLEnumGroupImplementationColorReadType },
+    { 0x8368, "GL_UNSIGNED_INT_2_10_10_10_REV",                 MGLEnumGroupImplementationColorReadType },
+    { 0x83F0, "GL_COMPRESSED_RGB_S3TC_DXT1_EXT",                MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x83F1, "GL_COMPRESSED_RGBA_S3TC_DXT1_EXT",               MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x83F2, "GL_COMPRESSED_RGBA_S3TC_DXT3_EXT",               MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x83F3, "GL_COMPRESSED_RGBA_S3TC_DXT5_EXT",               MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x84C0, "GL_TEXTURE0",                                    MGLEnumGroupTexture },
+    { 0x84C1, "GL_TEXTURE1",                                    MGLEnumGroupTexture },
+    { 0x84C2, "GL_TEXTURE2",                                    MGLEnumGroupTexture },
+    { 0x84C3, "GL_TEXTURE3",                                    MGLEnumGroupTexture },
+    { 0x84C4, "GL_TEXTURE4",                                    MGLEnumGroupTexture },
+    { 0x84C5, "GL_TEXTURE5",                                    MGLEnumGroupTexture },
+    { 0x84C6, "GL_TEXTURE6",                                    MGLEnumGroupTexture },
+    { 0x84C7, "GL_TEXTURE7",                                    MGLEnumGroupTexture },
+    { 0x84C8, "GL_TEXTURE8",                                    MGLEnumGroupTexture },
+    { 0x84C9, "GL_TEXTURE9",                                    MGLEnumGroupTexture },
+    { 0x84CA, "GL_TEXTURE10",                                   MGLEnumGroupTexture },
+    { 0x84CB, "GL_TEXTURE11",                                   MGLEnumGroupTexture },
+    { 0x84CC, "GL_TEXTURE12",                                   MGLEnumGroupTexture },
+    { 0x84CD, "GL_TEXTURE13",                                   MGLEnumGroupTexture },
+    { 0x84CE, "GL_TEXTURE14",                                   MGLEnumGroupTexture },
+    { 0x84CF, "GL_TEXTURE15",                                   MGLEnumGroupTexture },
+    { 0x84D0, "GL_TEXTURE16",                                   MGLEnumGroupTexture },
+    { 0x84D1, "GL_TEXTURE17",                                   MGLEnumGroupTexture },
+    { 0x84D2, "GL_TEXTURE18",                                   MGLEnumGroupTexture },
+    { 0x84D3, "GL_TEXTURE19",                                   MGLEnumGroupTexture },
+    { 0x84D4, "GL_TEXTURE20",                                   MGLEnumGroupTexture },
+    { 0x84D5, "GL_TEXTURE21",                                   MGLEnumGroupTexture },
+    { 0x84D6, "GL_TEXTURE22",                                   MGLEnumGroupTexture },
+    { 0x84D7, "GL_TEXTURE23",                                   MGLEnumGroupTexture },
+    { 0x84D8, "GL_TEXTURE24",                                   MGLEnumGroupTexture },
+    { 0x84D9, "GL_TEXTURE25",                                   MGLEnumGroupTexture },
+    { 0x84DA, "GL_TEXTURE26",                                   MGLEnumGroupTexture },
+    { 0x84DB, "GL_TEXTURE27",                                   MGLEnumGroupTexture },
+    { 0x84DC, "GL_TEXTURE28",                                   MGLEnumGroupTexture },
+    { 0x84DD, "GL_TEXTURE29",                                   MGLEnumGroupTexture },
+    { 0x84DE, "GL_TEXTURE30",                                   MGLEnumGroupTexture },
+    { 0x84DF, "GL_TEXTURE31",                                   MGLEnumGroupTexture },
+    { 0x84ED, "GL_COMPRESSED_RGB",                              MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x84EE, "GL_COMPRESSED_RGBA",                             MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x84F5, "GL_TEXTURE_RECTANGLE",                           MGLEnumGroupObjectTarget },
+    { 0x84F9, "GL_DEPTH_STENCIL",                               MGLEnumGroupImplementationColorReadFormat },
+    { 0x84FA, "GL_UNSIGNED_INT_24_8",                           MGLEnumGroupImplementationColorReadType },
+    { 0x8507, "GL_INCR_WRAP",                                   MGLEnumGroupStencilOp },
+    { 0x8508, "GL_DECR_WRAP",                                   MGLEnumGroupStencilOp },
+    { 0x8513, "GL_TEXTURE_CUBE_MAP",                            MGLEnumGroupObjectTarget },
+    { 0x8589, "GL_SRC1_ALPHA",                                  MGLEnumGroupBlendFunc },
+    { 0x86B0, "GL_COMPRESSED_RGB_FXT1_3DFX",                    MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x86B1, "GL_COMPRESSED_RGBA_FXT1_3DFX",                   MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x8814, "GL_RGBA32F",                                     MGLEnumGroupInternalFormat },
+    { 0x8815, "GL_RGB32F",                                      MGLEnumGroupInternalFormat },
+    { 0x881A, "GL_RGBA16F",                                     MGLEnumGroupInternalFormat },
+    { 0x881B, "GL_RGB16F",                                      MGLEnumGroupInternalFormat },
+    { 0x8892, "GL_ARRAY_BUFFER",                                MGLEnumGroupObjectTarget },
+    { 0x8893, "GL_ELEMENT_ARRAY_BUFFER",                        MGLEnumGroupObjectTarget },
+    { 0x88EB, "GL_PIXEL_PACK_BUFFER",                           MGLEnumGroupObjectTarget },
+    { 0x88EC, "GL_PIXEL_UNPACK_BUFFER",                         MGLEnumGroupObjectTarget },
+    { 0x88F0, "GL_DEPTH24_STENCIL8",                            MGLEnumGroupInternalFormat },
+    { 0x88F9, "GL_SRC1_COLOR",                                  MGLEnumGroupBlendFunc },
+    { 0x88FA, "GL_ONE_MINUS_SRC1_COLOR",                        MGLEnumGroupBlendFunc },
+    { 0x88FB, "GL_ONE_MINUS_SRC1_ALPHA",                        MGLEnumGroupBlendFunc },
+    { 0x8A11, "GL_UNIFORM_BUFFER",                              MGLEnumGroupObjectTarget },
+    { 0x8B90, "GL_PALETTE4_RGB8_OES",                           MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x8B91, "GL_PALETTE4_RGBA8_OES",                          MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x8B92, "GL_PALETTE4_R5_G6_B5_OES",                       MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x8B93, "GL_PALETTE4_RGBA4_OES",                          MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x8B94, "GL_PALETTE4_RGB5_A1_OES",                        MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x8B95, "GL_PALETTE8_RGB8_OES",                           MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x8B96, "GL_PALETTE8_RGBA8_OES",                          MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x8B97, "GL_PALETTE8_R5_G6_B5_OES",                       MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x8B98, "GL_PALETTE8_RGBA4_OES",                          MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x8B99, "GL_PALETTE8_RGB5_A1_OES",                        MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x8C18, "GL_TEXTURE_1D_ARRAY",                            MGLEnumGroupObjectTarget },
+    { 0x8C1A, "GL_TEXTURE_2D_ARRAY",                            MGLEnumGroupObjectTarget },
+    { 0x8C2A, "GL_TEXTURE_BUFFER",                              MGLEnumGroupObjectTarget },
+    { 0x8C3A, "GL_R11F_G11F_B10F",                              MGLEnumGroupInternalFormat },
+    { 0x8C3B, "GL_UNSIGNED_INT_10F_11F_11F_REV",                MGLEnumGroupImplementationColorReadType },
+    { 0x8C3D, "GL_RGB9_E5",                                     MGLEnumGroupInternalFormat },
+    { 0x8C3E, "GL_UNSIGNED_INT_5_9_9_9_REV",                    MGLEnumGroupImplementationColorReadType },
+    { 0x8C41, "GL_SRGB8",                                       MGLEnumGroupInternalFormat },
+    { 0x8C43, "GL_SRGB8_ALPHA8",                                MGLEnumGroupInternalFormat },
+    { 0x8C48, "GL_COMPRESSED_SRGB",                             MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x8C49, "GL_COMPRESSED_SRGB_ALPHA",                       MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x8C4A, "GL_COMPRESSED_SLUMINANCE_EXT",                   MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x8C4B, "GL_COMPRESSED_SLUMINANCE_ALPHA_EXT",             MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x8C4C, "GL_COMPRESSED_SRGB_S3TC_DXT1_EXT",               MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x8C4D, "GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT",         MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x8C4E, "GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT",         MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x8C4F, "GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT",         MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x8C70, "GL_COMPRESSED_LUMINANCE_LATC1_EXT",              MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x8C71, "GL_COMPRESSED_SIGNED_LUMINANCE_LATC1_EXT",       MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x8C72, "GL_COMPRESSED_LUMINANCE_ALPHA_LATC2_EXT",        MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x8C73, "GL_COMPRESSED_SIGNED_LUMINANCE_ALPHA_LATC2_EXT", MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x8C8E, "GL_TRANSFORM_FEEDBACK_BUFFER",                   MGLEnumGroupObjectTarget },
+    { 0x8CA1, "GL_LOWER_LEFT",                                  MGLEnumGroupClipOrigin },
+    { 0x8CA2, "GL_UPPER_LEFT",                                  MGLEnumGroupClipOrigin },
+    { 0x8CAC, "GL_DEPTH_COMPONENT32F",                          MGLEnumGroupInternalFormat },
+    { 0x8CAD, "GL_DEPTH32F_STENCIL8",                           MGLEnumGroupInternalFormat },
+    { 0x8CE0, "GL_COLOR_ATTACHMENT0",                           MGLEnumGroupDrawBufferMode },
+    { 0x8CE1, "GL_COLOR_ATTACHMENT1",                           MGLEnumGroupDrawBufferMode },
+    { 0x8CE2, "GL_COLOR_ATTACHMENT2",                           MGLEnumGroupDrawBufferMode },
+    { 0x8CE3, "GL_COLOR_ATTACHMENT3",                           MGLEnumGroupDrawBufferMode },
+    { 0x8CE4, "GL_COLOR_ATTACHMENT4",                           MGLEnumGroupDrawBufferMode },
+    { 0x8CE5, "GL_COLOR_ATTACHMENT5",                           MGLEnumGroupDrawBufferMode },
+    { 0x8CE6, "GL_COLOR_ATTACHMENT6",                           MGLEnumGroupDrawBufferMode },
+    { 0x8CE7, "GL_COLOR_ATTACHMENT7",                           MGLEnumGroupDrawBufferMode },
+    { 0x8CE8, "GL_COLOR_ATTACHMENT8",                           MGLEnumGroupDrawBufferMode },
+    { 0x8CE9, "GL_COLOR_ATTACHMENT9",                           MGLEnumGroupDrawBufferMode },
+    { 0x8CEA, "GL_COLOR_ATTACHMENT10",                          MGLEnumGroupDrawBufferMode },
+    { 0x8CEB, "GL_COLOR_ATTACHMENT11",                          MGLEnumGroupDrawBufferMode },
+    { 0x8CEC, "GL_COLOR_ATTACHMENT12",                          MGLEnumGroupDrawBufferMode },
+    { 0x8CED, "GL_COLOR_ATTACHMENT13",                          MGLEnumGroupDrawBufferMode },
+    { 0x8CEE, "GL_COLOR_ATTACHMENT14",                          MGLEnumGroupDrawBufferMode },
+    { 0x8CEF, "GL_COLOR_ATTACHMENT15",                          MGLEnumGroupDrawBufferMode },
+    { 0x8CF0, "GL_COLOR_ATTACHMENT16",                          MGLEnumGroupDrawBufferMode },
+    { 0x8CF1, "GL_COLOR_ATTACHMENT17",                          MGLEnumGroupDrawBufferMode },
+    { 0x8CF2, "GL_COLOR_ATTACHMENT18",                          MGLEnumGroupDrawBufferMode },
+    { 0x8CF3, "GL_COLOR_ATTACHMENT19",                          MGLEnumGroupDrawBufferMode },
+    { 0x8CF4, "GL_COLOR_ATTACHMENT20",                          MGLEnumGroupDrawBufferMode },
+    { 0x8CF5, "GL_COLOR_ATTACHMENT21",                          MGLEnumGroupDrawBufferMode },
+    { 0x8CF6, "GL_COLOR_ATTACHMENT22",                          MGLEnumGroupDrawBufferMode },
+    { 0x8CF7, "GL_COLOR_ATTACHMENT23",                          MGLEnumGroupDrawBufferMode },
+    { 0x8CF8, "GL_COLOR_ATTACHMENT24",                          MGLEnumGroupDrawBufferMode },
+    { 0x8CF9, "GL_COLOR_ATTACHMENT25",                          MGLEnumGroupDrawBufferMode },
+    { 0x8CFA, "GL_COLOR_ATTACHMENT26",                          MGLEnumGroupDrawBufferMode },
+    { 0x8CFB, "GL_COLOR_ATTACHMENT27",                          MGLEnumGroupDrawBufferMode },
+    { 0x8CFC, "GL_COLOR_ATTACHMENT28",                          MGLEnumGroupDrawBufferMode },
+    { 0x8CFD, "GL_COLOR_ATTACHMENT29",                          MGLEnumGroupDrawBufferMode },
+    { 0x8CFE, "GL_COLOR_ATTACHMENT30",                          MGLEnumGroupDrawBufferMode },
+    { 0x8CFF, "GL_COLOR_ATTACHMENT31",                          MGLEnumGroupDrawBufferMode },
+    { 0x8D41, "GL_RENDERBUFFER",                                MGLEnumGroupObjectTarget },
+    { 0x8D48, "GL_STENCIL_INDEX8",                              MGLEnumGroupInternalFormat },
+    { 0x8D62, "GL_RGB565",                                      MGLEnumGroupInternalFormat },
+    { 0x8D70, "GL_RGBA32UI",                                    MGLEnumGroupInternalFormat },
+    { 0x8D71, "GL_RGB32UI",                                     MGLEnumGroupInternalFormat },
+    { 0x8D76, "GL_RGBA16UI",                                    MGLEnumGroupInternalFormat },
+    { 0x8D77, "GL_RGB16UI",                                     MGLEnumGroupInternalFormat },
+    { 0x8D7C, "GL_RGBA8UI",                                     MGLEnumGroupInternalFormat },
+    { 0x8D7D, "GL_RGB8UI",                                      MGLEnumGroupInternalFormat },
+    { 0x8D82, "GL_RGBA32I",                                     MGLEnumGroupInternalFormat },
+    { 0x8D83, "GL_RGB32I",                                      MGLEnumGroupInternalFormat },
+    { 0x8D88, "GL_RGBA16I",                                     MGLEnumGroupInternalFormat },
+    { 0x8D89, "GL_RGB16I",                                      MGLEnumGroupInternalFormat },
+    { 0x8D8E, "GL_RGBA8I",                                      MGLEnumGroupInternalFormat },
+    { 0x8D8F, "GL_RGB8I",                                       MGLEnumGroupInternalFormat },
+    { 0x8DAD, "GL_FLOAT_32_UNSIGNED_INT_24_8_REV",              MGLEnumGroupImplementationColorReadType },
+    { 0x8DBB, "GL_COMPRESSED_RED_RGTC1",                        MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x8DBC, "GL_COMPRESSED_SIGNED_RED_RGTC1",                 MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x8DBD, "GL_COMPRESSED_RG_RGTC2",                         MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x8DBE, "GL_COMPRESSED_SIGNED_RG_RGTC2",                  MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x8E4D, "GL_FIRST_VERTEX_CONVENTION",                     MGLEnumGroupProvokingVertexMode },
+    { 0x8E4E, "GL_LAST_VERTEX_CONVENTION",                      MGLEnumGroupProvokingVertexMode },
+    { 0x8E4F, "GL_PROVOKING_VERTEX",                            MGLEnumGroupProvokingVertexMode },
+    { 0x8E8C, "GL_COMPRESSED_RGBA_BPTC_UNORM",                  MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x8E8D, "GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM",            MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x8E8E, "GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT",            MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x8E8F, "GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT",          MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x8F94, "GL_R8_SNORM",                                    MGLEnumGroupInternalFormat },
+    { 0x8F95, "GL_RG8_SNORM",                                   MGLEnumGroupInternalFormat },
+    { 0x8F96, "GL_RGB8_SNORM",                                  MGLEnumGroupInternalFormat },
+    { 0x8F97, "GL_RGBA8_SNORM",                                 MGLEnumGroupInternalFormat },
+    { 0x8F98, "GL_R16_SNORM",                                   MGLEnumGroupInternalFormat },
+    { 0x8F99, "GL_RG16_SNORM",                                  MGLEnumGroupInternalFormat },
+    { 0x8F9A, "GL_RGB16_SNORM",                                 MGLEnumGroupInternalFormat },
+    { 0x8F9B, "GL_RGBA16_SNORM",                                MGLEnumGroupInternalFormat },
+    { 0x9009, "GL_TEXTURE_CUBE_MAP_ARRAY",                      MGLEnumGroupObjectTarget },
+    { 0x906F, "GL_RGB10_A2UI",                                  MGLEnumGroupInternalFormat },
+    { 0x90D2, "GL_SHADER_STORAGE_BUFFER",                       MGLEnumGroupObjectTarget },
+    { 0x90EE, "GL_DISPATCH_INDIRECT_BUFFER",                    MGLEnumGroupObjectTarget },
+    { 0x9100, "GL_TEXTURE_2D_MULTISAMPLE",                      MGLEnumGroupObjectTarget },
+    { 0x9102, "GL_TEXTURE_2D_MULTISAMPLE_ARRAY",                MGLEnumGroupObjectTarget },
+    { 0x9270, "GL_COMPRESSED_R11_EAC",                          MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x9271, "GL_COMPRESSED_SIGNED_R11_EAC",                   MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x9272, "GL_COMPRESSED_RG11_EAC",                         MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x9273, "GL_COMPRESSED_SIGNED_RG11_EAC",                  MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x9274, "GL_COMPRESSED_RGB8_ETC2",                        MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x9275, "GL_COMPRESSED_SRGB8_ETC2",                       MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x9276, "GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2",    MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x9277, "GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2",   MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x9278, "GL_COMPRESSED_RGBA8_ETC2_EAC",                   MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x9279, "GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC",            MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x935E, "GL_NEGATIVE_ONE_TO_ONE",                         MGLEnumGroupClipDepthMode },
+    { 0x935F, "GL_ZERO_TO_ONE",                                 MGLEnumGroupClipDepthMode },
+    { 0x93B0, "GL_COMPRESSED_RGBA_ASTC_4x4_KHR",                MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x93B1, "GL_COMPRESSED_RGBA_ASTC_5x4_KHR",                MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x93B2, "GL_COMPRESSED_RGBA_ASTC_5x5_KHR",                MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x93B3, "GL_COMPRESSED_RGBA_ASTC_6x5_KHR",                MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x93B4, "GL_COMPRESSED_RGBA_ASTC_6x6_KHR",                MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x93B5, "GL_COMPRESSED_RGBA_ASTC_8x5_KHR",                MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x93B6, "GL_COMPRESSED_RGBA_ASTC_8x6_KHR",                MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x93B7, "GL_COMPRESSED_RGBA_ASTC_8x8_KHR",                MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x93B8, "GL_COMPRESSED_RGBA_ASTC_10x5_KHR",               MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x93B9, "GL_COMPRESSED_RGBA_ASTC_10x6_KHR",               MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x93BA, "GL_COMPRESSED_RGBA_ASTC_10x8_KHR",               MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x93BB, "GL_COMPRESSED_RGBA_ASTC_10x10_KHR",              MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x93BC, "GL_COMPRESSED_RGBA_ASTC_12x10_KHR",              MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x93BD, "GL_COMPRESSED_RGBA_ASTC_12x12_KHR",              MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x93D0, "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR",        MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x93D1, "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x4_KHR",        MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x93D2, "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x5_KHR",        MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x93D3, "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x5_KHR",        MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x93D4, "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x6_KHR",        MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x93D5, "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x5_KHR",        MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x93D6, "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x6_KHR",        MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x93D7, "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x8_KHR",        MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x93D8, "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x5_KHR",       MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x93D9, "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x6_KHR",       MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x93DA, "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x8_KHR",       MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x93DB, "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x10_KHR",      MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x93DC, "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_12x10_KHR",      MGLEnumGroupCompressedTextureInternalFormat },
+    { 0x93DD, "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_12x12_KHR",      MGLEnumGroupCompressedTextureInternalFormat }
+};
+
+#define MGL_NUM_ENUM_NAMES (sizeof(g_MGLEnumNames) / sizeof(g_MGLEnumNames[0]))
+
+// Returns the index of the first entry in g_MGLEnumNames whose value is not less than 'value' (binary search)
+static size_t mglFindEnumName(GLenum value)
+{
+    size_t first = 0, last = MGL_NUM_ENUM_NAMES;
+
+    while (first < last)
+    {
+        const size_t mid = first + (last - first) / 2;
+        if (g_MGLEnumNames[mid].value < value)
+            first = mid + 1;
+        else
+            last = mid;
+    }
+
+    return first;
+}
+
+// Returns the name of the specified value within the specified group, or NULL if the value has no name in this group
+static const char* mglEnumGroupName(GLenum value, unsigned group)
+{
+    for (size_t i = mglFindEnumName(value); i < MGL_NUM_ENUM_NAMES && g_MGLEnumNames[i].value == value; ++i)
+    {
+        if ((g_MGLEnumNames[i].groups & group) != 0)
+            return g_MGLEnumNames[i].name;
+    }
+    return NULL;
+}
+
+// Defines a conversion function for the specified group of GLenum names
+#define MGL_ENUM_GROUP_STR(NAME, GROUP)                         \
+    static const char* NAME(GLenum param)                       \
+    {                                                           \
+        return mglEnumGroupName(param, MGLEnumGroup##GROUP);    \
+    }
+
+MGL_ENUM_GROUP_STR( mglHintModeStr, HintMode )
+MGL_ENUM_GROUP_STR( mglCullFaceModeStr, CullFaceMode )
+MGL_ENUM_GROUP_STR( mglPolygonModeStr, PolygonMode )
+MGL_ENUM_GROUP_STR( mglFrontFaceStr, FrontFace )
+MGL_ENUM_GROUP_STR( mglLogicOpModeStr, LogicOpMode )
+MGL_ENUM_GROUP_STR( mglStencilOpStr, StencilOp )
+MGL_ENUM_GROUP_STR( mglCompareFuncStr, CompareFunc )
+
+#ifdef GL_VERSION_1_3
+MGL_ENUM_GROUP_STR( mglCompressedTextureInternalFormatStr, CompressedTextureInternalFormat )
+MGL_ENUM_GROUP_STR( mglTextureStr, Texture )
+#endif // /GL_VERSION_1_3
+
+#ifdef GL_VERSION_1_4
+MGL_ENUM_GROUP_STR( mglBlendFuncStr, BlendFunc )
+#endif // /GL_VERSION_1_4
+
+#ifdef GL_VERSION_2_0
+MGL_ENUM_GROUP_STR( mglBlendEquationModeStr, BlendEquationMode )
+MGL_ENUM_GROUP_STR( mglDrawBufferModeStr, DrawBufferMode )
+#endif // /GL_VERSION_2_0
+
+#ifdef GL_VERSION_3_0
+MGL_ENUM_GROUP_STR( mglContextFlagBitStr, ContextFlagBit )
+#endif // /GL_VERSION_3_0
+
+#ifdef GL_VERSION_3_2
+MGL_ENUM_GROUP_STR( mglProvokingVertexModeStr, ProvokingVertexMode )
+#endif // /GL_VERSION_3_2
+
+#ifdef GL_VERSION_4_1
+MGL_ENUM_GROUP_STR( mglImplementationColorReadFormatStr, ImplementationColorReadFormat )
+MGL_ENUM_GROUP_STR( mglImplementationColorReadTypeStr, ImplementationColorReadType )
+#endif // /GL_VERSION_4_1
+
+#ifdef GL_VERSION_4_5
+MGL_ENUM_GROUP_STR( mglClipOriginStr, ClipOrigin )
+MGL_ENUM_GROUP_STR( mglClipDepthModeStr, ClipDepthMode )
+#endif // /GL_VERSION_4_5
+
+#undef MGL_ENUM_GROUP_STR
+
+
+
+// *****************************************************************
+//      FIELD DESCRIPTORS
+// *****************************************************************
+
+// Selects 'X' if the respective GL version is available in the GL headers, otherwise 'Y'
+#define MGL_GL_VERSION_1_0(X, Y) X
+
+#ifdef GL_VERSION_1_1
+#define MGL_GL_VERSION_1_1(X, Y) X
+#else
+#define MGL_GL_VERSION_1_1(X, Y) Y
+#endif
+
+#ifdef GL_VERSION_1_2
+#define MGL_GL_VERSION_1_2(X, Y) X
+#else
+#define MGL_GL_VERSION_1_2(X, Y) Y
+#endif
+
+#ifdef GL_VERSION_1_3
+#define MGL_GL_VERSION_1_3(X, Y) X
+#else
+#define MGL_GL_VERSION_1_3(X, Y) Y
+#endif
+
+#ifdef GL_VERSION_1_4
+#define MGL_GL_VERSION_1_4(X, Y) X
+#else
+#define MGL_GL_VERSION_1_4(X, Y) Y
+#endif
+
+#ifdef GL_VERSION_1_5
+#define MGL_GL_VERSION_1_5(X, Y) X
+#else
+#define MGL_GL_VERSION_1_5(X, Y) Y
+#endif
+
+#ifdef GL_VERSION_2_0
+#define MGL_GL_VERSION_2_0(X, Y) X
+#else
+#define MGL_GL_VERSION_2_0(X, Y) Y
+#endif
+
+#ifdef GL_VERSION_2_1
+#define MGL_GL_VERSION_2_1(X, Y) X
+#else
+#define MGL_GL_VERSION_2_1(X, Y) Y
+#endif
+
+#ifdef GL_VERSION_3_0
+#define MGL_GL_VERSION_3_0(X, Y) X
+#else
+#define MGL_GL_VERSION_3_0(X, Y) Y
+#endif
+
+#ifdef GL_VERSION_3_1
+#define MGL_GL_VERSION_3_1(X, Y) X
+#else
+#define MGL_GL_VERSION_3_1(X, Y) Y
+#endif
+
+#ifdef GL_VERSION_3_2
+#define MGL_GL_VERSION_3_2(X, Y) X
+#else
+#define MGL_GL_VERSION_3_2(X, Y) Y
+#endif
+
+#ifdef GL_VERSION_3_3
+#define MGL_GL_VERSION_3_3(X, Y) X
+#else
+#define MGL_GL_VERSION_3_3(X, Y) Y
+#endif
+
+#ifdef GL_VERSION_4_0
+#define MGL_GL_VERSION_4_0(X, Y) X
+#else
+#define MGL_GL_VERSION_4_0(X, Y) Y
+#endif
+
+#ifdef GL_VERSION_4_1
+#define MGL_GL_VERSION_4_1(X, Y) X
+#else
+#define MGL_GL_VERSION_4_1(X, Y) Y
+#endif
+
+#ifdef GL_VERSION_4_2
+#define MGL_GL_VERSION_4_2(X, Y) X
+#else
+#define MGL_GL_VERSION_4_2(X, Y) Y
+#endif
+
+#ifdef GL_VERSION_4_3
+#define MGL_GL_VERSION_4_3(X, Y) X
+#else
+#define MGL_GL_VERSION_4_3(X, Y) Y
+#endif
+
+#ifdef GL_VERSION_4_5
+#define MGL_GL_VERSION_4_5(X, Y) X
+#else
+#define MGL_GL_VERSION_4_5(X, Y) Y
+#endif
+
+#define MGL_FIELD_ENTRY(STRUCT, MAJOR, MINOR, CAT, NAME, NAME_STR, TYPE, MEMBER, COUNT, COUNT_OFFSET, LIMITS_OFFSET, PROC, FLAGS) \
+    {                                                                   \
+        NAME_STR,                                                       \
+        ((((MAJOR) << 16) | (MINOR)) <= MGL_MAX_VERSION ? MGL_GL_VERSION_##MAJOR##_##MINOR(NAME, 0) : 0), \
+        (((MAJOR) << 16) | (MINOR)),                                    \
+        MGLStateCategory##CAT,                                          \
+        MGLFieldType##TYPE,                                             \
+        (FLAGS),                                                        \
+        (COUNT),                                                        \
+        offsetof(STRUCT, MEMBER),                                       \
+        (COUNT_OFFSET),                                                 \
+        (LIMITS_OFFSET),                                                \
+        MGL_GL_VERSION_##MAJOR##_##MINOR(PROC, NULL)                    \
+    }
+
+// Render state field
+#define MGL_FIELD(MAJOR, MINOR, CAT, NAME, TYPE, MEMBER, COUNT, PROC, FLAGS) \
+    MGL_FIELD_ENTRY(MGLRenderState, MAJOR, MINOR, CAT, NAME, #NAME, TYPE, MEMBER, COUNT, MGL_FIELD_NO_OFFSET, MGL_FIELD_NO_OFFSET, PROC, FLAGS)
+
+// Implementation dependent limit, which is also stored in MGLImplementationLimits
+#define MGL_LIMIT(MAJOR, MINOR, NAME, TYPE, MEMBER, COUNT, PROC, FLAGS) \
+    MGL_FIELD_ENTRY(MGLRenderState, MAJOR, MINOR, Limits, NAME, #NAME, TYPE, MEMBER, COUNT, MGL_FIELD_NO_OFFSET, offsetof(MGLImplementationLimits, MEMBER), PROC, FLAGS)
+
+// Implementation dependent limit with a dynamic number of elements, which is specified by the limit 'COUNT_MEMBER'
+#define MGL_LIMIT_DYN(MAJOR, MINOR, NAME, TYPE, MEMBER, LIMIT, COUNT_MEMBER, PROC) \
+    MGL_FIELD_ENTRY(MGLRenderState, MAJOR, MINOR, Limits, NAME, #NAME, TYPE, MEMBER, LIMIT, offsetof(MGLRenderState, COUNT_MEMBER), offsetof(MGLImplementationLimits, MEMBER), PROC, 0)
+
+// Binding point field
+#define MGL_FIELD_BP(MAJOR, MINOR, NAME, MEMBER) \
+    MGL_FIELD_ENTRY(MGLBindingPoints, MAJOR, MINOR, Textures, NAME, #NAME, IntegerArray, MEMBER, MGL_MAX_TEXTURE_LAYERS, MGL_FIELD_NO_OFFSET, MGL_FIELD_NO_OFFSET, NULL, 0)
+
+// All fields of MGLRenderState in the same order as they are printed by mglPrintRenderState
+static const MGLFieldDescriptor g_MGLRenderStateFields[] =
+{
+    // GL_VERSION_1_0
+    MGL_LIMIT( 1, 0, GL_MAJOR_VERSION, Integer, iMajorVersion, 1, NULL, 0 ),
+    MGL_LIMIT( 1, 0, GL_MINOR_VERSION, Integer, iMinorVersion, 1, NULL, 0 ),
+    MGL_FIELD( 1, 0, Blend, GL_BLEND, Boolean, bBlend, 1, NULL, 0 ),
+    MGL_FIELD( 1, 0, Framebuffer, GL_COLOR_CLEAR_VALUE, FloatArray, fColorClearValue, 4, NULL, 0 ),
+    MGL_FIELD( 1, 0, Blend, GL_COLOR_WRITEMASK, BooleanArray, bColorWriteMask, 4, NULL, 0 ),
+    MGL_FIELD( 1, 0, Rasterizer, GL_CULL_FACE, Boolean, bCullFace, 1, NULL, 0 ),
+    MGL_FIELD( 1, 0, Rasterizer, GL_CULL_FACE_MODE, Enum, iCullFaceMode, 1, mglCullFaceModeStr, 0 ),
+    MGL_FIELD( 1, 0, DepthStencil, GL_DEPTH_CLEAR_VALUE, Double, dDepthClearValue, 1, NULL, 0 ),
+    MGL_FIELD( 1, 0, DepthStencil, GL_DEPTH_FUNC, Enum, iDepthFunc, 1, mglCompareFuncStr, 0 ),
+    MGL_FIELD( 1, 0, DepthStencil, GL_DEPTH_RANGE, DoubleArray, dDepthRange, 2, NULL, 0 ),
+    MGL_FIELD( 1, 0, DepthStencil, GL_DEPTH_TEST, Boolean, bDepthTest, 1, NULL, 0 ),
+    MGL_FIELD( 1, 0, DepthStencil, GL_DEPTH_WRITEMASK, Boolean, bDepthWriteMask, 1, NULL, 0 ),
+    MGL_FIELD( 1, 0, Blend, GL_DITHER, Boolean, bDither, 1, NULL, 0 ),
+    MGL_FIELD( 1, 0, Framebuffer, GL_DOUBLEBUFFER, Boolean, bDoubleBuffer, 1, NULL, 0 ),
+    MGL_FIELD( 1, 0, Framebuffer, GL_DRAW_BUFFER, Integer, iDrawBuffer, 1, NULL, 0 ),
+    MGL_FIELD( 1, 0, Rasterizer, GL_FRONT_FACE, Enum, iFrontFace, 1, mglFrontFaceStr, 0 ),
+    MGL_FIELD( 1, 0, Rasterizer, GL_LINE_SMOOTH, Boolean, bLineSmooth, 1, NULL, 0 ),
+    MGL_FIELD( 1, 0, Hints, GL_LINE_SMOOTH_HINT, Enum, iLineSmoothHint, 1, mglHintModeStr, 0 ),
+    MGL_FIELD( 1, 0, Rasterizer, GL_LINE_WIDTH, Float, fLineWidth, 1, NULL, 0 ),
+    MGL_FIELD( 1, 0, Blend, GL_LOGIC_OP_MODE, Enum, iLogicOpMode, 1, mglLogicOpModeStr, 0 ),
+    MGL_LIMIT( 1, 0, GL_MAX_TEXTURE_SIZE, Integer, iMaxTextureSize, 1, NULL, 0 ),
+    MGL_LIMIT( 1, 0, GL_MAX_VIEWPORT_DIMS, IntegerArray, iMaxViewportDims, 2, NULL, 0 ),
+    MGL_FIELD( 1, 0, PixelStore, GL_PACK_ALIGNMENT, Integer, iPackAlignment, 1, NULL, 0 ),
+    MGL_FIELD( 1, 0, PixelStore, GL_PACK_LSB_FIRST, Boolean, bPackLSBFirst, 1, NULL, 0 ),
+    MGL_FIELD( 1, 0, PixelStore, GL_PACK_ROW_LENGTH, Integer, iPackRowLength, 1, NULL, 0 ),
+    MGL_FIELD( 1, 0, PixelStore, GL_PACK_SKIP_PIXELS, Integer, iPackSkipPixels, 1, NULL, 0 ),
+    MGL_FIELD( 1, 0, PixelStore, GL_PACK_SKIP_ROWS, Integer, iPackSkipRows, 1, NULL, 0 ),
+    MGL_FIELD( 1, 0, PixelStore, GL_PACK_SWAP_BYTES, Boolean, bPackSwapBytes, 1, NULL, 0 ),
+    MGL_FIELD( 1, 0, Rasterizer, GL_POINT_SIZE, Float, fPointSize, 1, NULL, 0 ),
+    MGL_LIMIT( 1, 0, GL_POINT_SIZE_GRANULARITY, Float, fPointSizeGranularity, 1, NULL, 0 ),
+    MGL_LIMIT( 1, 0, GL_POINT_SIZE_RANGE, FloatArray, fPointSizeRange, 2, NULL, 0 ),
+    MGL_FIELD( 1, 0, Rasterizer, GL_POLYGON_MODE, EnumArray, iPolygonMode, 2, mglPolygonModeStr, 0 ),
+    MGL_FIELD( 1, 0, Rasterizer, GL_POLYGON_SMOOTH, Boolean, bPolygonSmooth, 1, NULL, 0 ),
+    MGL_FIELD( 1, 0, Hints, GL_POLYGON_SMOOTH_HINT, Enum, iPolygonSmoothHint, 1, mglHintModeStr, 0 ),
+    MGL_FIELD( 1, 0, Framebuffer, GL_READ_BUFFER, Integer, iReadBuffer, 1, NULL, 0 ),
+    MGL_FIELD( 1, 0, Rasterizer, GL_SCISSOR_BOX, IntegerArray, iScissorBox, 4, NULL, 0 ),
+    MGL_FIELD( 1, 0, Rasterizer, GL_SCISSOR_TEST, Boolean, bScissorTest, 1, NULL, 0 ),
+    MGL_FIELD( 1, 0, DepthStencil, GL_STENCIL_CLEAR_VALUE, Integer, iStencilClearValue, 1, NULL, 0 ),
+    MGL_FIELD( 1, 0, DepthStencil, GL_STENCIL_FAIL, Enum, iStencilFail, 1, mglStencilOpStr, 0 ),
+    MGL_FIELD( 1, 0, DepthStencil, GL_STENCIL_FUNC, Enum, iStencilFunc, 1, mglCompareFuncStr, 0 ),
+    MGL_FIELD( 1, 0, DepthStencil, GL_STENCIL_PASS_DEPTH_FAIL, Enum, iStencilPassDepthFail, 1, mglStencilOpStr, 0 ),
+    MGL_FIELD( 1, 0, DepthStencil, GL_STENCIL_PASS_DEPTH_PASS, Enum, iStencilPassDepthPass, 1, mglStencilOpStr, 0 ),
+    MGL_FIELD( 1, 0, DepthStencil, GL_STENCIL_REF, Integer, iStencilRef, 1, NULL, 0 ),
+    MGL_FIELD( 1, 0, DepthStencil, GL_STENCIL_TEST, Boolean, bStencilTest, 1, NULL, 0 ),
+    MGL_FIELD( 1, 0, DepthStencil, GL_STENCIL_VALUE_MASK, IntegerHex, iStencilValueMask, 1, NULL, 0 ),
+    MGL_FIELD( 1, 0, DepthStencil, GL_STENCIL_WRITEMASK, IntegerHex, iStencilWriteMask, 1, NULL, 0 ),
+    MGL_FIELD( 1, 0, Framebuffer, GL_STEREO, Boolean, bStereo, 1, NULL, 0 ),
+    MGL_LIMIT( 1, 0, GL_SUBPIXEL_BITS, Integer, iSubPixelBits, 1, NULL, 0 ),
+    MGL_FIELD( 1, 0, Textures, GL_TEXTURE_BINDING_1D, Integer, iTextureBinding1D, 1, NULL, 0 ),
+    MGL_FIELD( 1, 0, Textures, GL_TEXTURE_BINDING_2D, Integer, iTextureBinding2D, 1, NULL, 0 ),
+    MGL_FIELD( 1, 0, PixelStore, GL_UNPACK_ALIGNMENT, Integer, iUnpackAlignment, 1, NULL, 0 ),
+    MGL_FIELD( 1, 0, PixelStore, GL_UNPACK_LSB_FIRST, Boolean, bUnpackLSBFirst, 1, NULL, 0 ),
+    MGL_FIELD( 1, 0, PixelStore, GL_UNPACK_ROW_LENGTH, Integer, iUnpackRowLength, 1, NULL, 0 ),
+    MGL_FIELD( 1, 0, PixelStore, GL_UNPACK_SKIP_PIXELS, Integer, iUnpackSkipPixels, 1, NULL, 0 ),
+    MGL_FIELD( 1, 0, PixelStore, GL_UNPACK_SKIP_ROWS, Integer, iUnpackSkipRows, 1, NULL, 0 ),
+    MGL_FIELD( 1, 0, PixelStore, GL_UNPACK_SWAP_BYTES, Boolean, bUnpackSwapBytes, 1, NULL, 0 ),
+    MGL_FIELD( 1, 0, Rasterizer, GL_VIEWPORT, IntegerArray, iViewport, 4, NULL, 0 ),
+
+    // GL_VERSION_1_1
+    MGL_FIELD( 1, 1, Blend, GL_COLOR_LOGIC_OP, Boolean, bColorLogicOp, 1, NULL, 0 ),
+    MGL_FIELD( 1, 1, Rasterizer, GL_POLYGON_OFFSET_FACTOR, Float, fPolygonOffsetFactor, 1, NULL, 0 ),
+    MGL_FIELD( 1, 1, Rasterizer, GL_POLYGON_OFFSET_UNITS, Float, fPolygonOffsetUnits, 1, NULL, 0 ),
+    MGL_FIELD( 1, 1, Rasterizer, GL_POLYGON_OFFSET_FILL, Boolean, bPolygonOffsetFill, 1, NULL, 0 ),
+    MGL_FIELD( 1, 1, Rasterizer, GL_POLYGON_OFFSET_LINE, Boolean, bPolygonOffsetLine, 1, NULL, 0 ),
+    MGL_FIELD( 1, 1, Rasterizer, GL_POLYGON_OFFSET_POINT, Boolean, bPolygonOffsetPoint, 1, NULL, 0 ),
+
+    // GL_VERSION_1_2
+    MGL_LIMIT( 1, 2, GL_ALIASED_LINE_WIDTH_RANGE, FloatArray, fAliasedLineWidthRange, 2, NULL, 0 ),
+    MGL_FIELD( 1, 2, Blend, GL_BLEND_COLOR, FloatArray, fBlendColor, 4, NULL, 0 ),
+    MGL_LIMIT( 1, 2, GL_MAX_3D_TEXTURE_SIZE, Integer, iMax3DTextureSize, 1, NULL, 0 ),
+    MGL_LIMIT( 1, 2, GL_MAX_ELEMENTS_INDICES, Integer, iMaxElementsIndices, 1, NULL, 0 ),
+    MGL_LIMIT( 1, 2, GL_MAX_ELEMENTS_VERTICES, Integer, iMaxElementsVertices, 1, NULL, 0 ),
+    MGL_FIELD( 1, 2, PixelStore, GL_PACK_IMAGE_HEIGHT, Integer, iPackImageHeight, 1, NULL, 0 ),
+    MGL_FIELD( 1, 2, PixelStore, GL_PACK_SKIP_IMAGES, Integer, iPackSkipImages, 1, NULL, 0 ),
+    MGL_LIMIT( 1, 2, GL_SMOOTH_LINE_WIDTH_RANGE, FloatArray, fSmoothLineWidthRange, 2, NULL, 0 ),
+    MGL_LIMIT( 1, 2, GL_SMOOTH_LINE_WIDTH_GRANULARITY, Float, fSmoothLineWidthGranularity, 1, NULL, 0 ),
+    MGL_FIELD( 1, 2, Textures, GL_TEXTURE_BINDING_3D, Integer, iTextureBinding3D, 1, NULL, 0 ),
+    MGL_FIELD( 1, 2, PixelStore, GL_UNPACK_IMAGE_HEIGHT, Integer, iUnpackImageHeight, 1, NULL, 0 ),
+    MGL_FIELD( 1, 2, PixelStore, GL_UNPACK_SKIP_IMAGES, Integer, iUnpackSkipImages, 1, NULL, 0 ),
+
+    // GL_VERSION_1_3
+    MGL_LIMIT( 1, 3, GL_NUM_COMPRESSED_TEXTURE_FORMATS, Integer, iNumCompressedTextureFormats, 1, NULL, 0 ),
+    MGL_LIMIT_DYN( 1, 3, GL_COMPRESSED_TEXTURE_FORMATS, EnumArray, iCompressedTextureFormats, MGL_MAX_COMPRESSED_TEXTURE_FORMATS, iNumCompressedTextureFormats, mglCompressedTextureInternalFormatStr ),
+    MGL_FIELD( 1, 3, Textures, GL_TEXTURE_BINDING_CUBE_MAP, Integer, iTextureBindingCubeMap, 1, NULL, 0 ),
+    MGL_FIELD( 1, 3, Hints, GL_TEXTURE_COMPRESSION_HINT, Enum, iTextureCompressionHint, 1, mglHintModeStr, 0 ),
+    MGL_FIELD( 1, 3, Textures, GL_ACTIVE_TEXTURE, Enum, iActiveTexture, 1, mglTextureStr, 0 ),
+    MGL_LIMIT( 1, 3, GL_MAX_CUBE_MAP_TEXTURE_SIZE, Integer, iMaxCubeMapTextureSize, 1, NULL, 0 ),
+    MGL_FIELD( 1, 3, Framebuffer, GL_SAMPLE_BUFFERS, Integer, iSampleBuffers, 1, NULL, 0 ),
+    MGL_FIELD( 1, 3, Rasterizer, GL_SAMPLE_COVERAGE_VALUE, Float, fSampleCoverageValue, 1, NULL, 0 ),
+    MGL_FIELD( 1, 3, Rasterizer, GL_SAMPLE_COVERAGE_INVERT, Boolean, bSampleCoverageInvert, 1, NULL, 0 ),
+    MGL_FIELD( 1, 3, Framebuffer, GL_SAMPLES, Integer, iSamples, 1, NULL, 0 ),
+
+    // GL_VERSION_1_4
+    MGL_FIELD( 1, 4, Blend, GL_BLEND_DST_ALPHA, Enum, iBlendDstAlpha, 1, mglBlendFuncStr, 0 ),
+    MGL_FIELD( 1, 4, Blend, GL_BLEND_DST_RGB, Enum, iBlendDstRGB, 1, mglBlendFuncStr, 0 ),
+    MGL_FIELD( 1, 4, Blend, GL_BLEND_SRC_ALPHA, Enum, iBlendSrcAlpha, 1, mglBlendFuncStr, 0 ),
+    MGL_FIELD( 1, 4, Blend, GL_BLEND_SRC_RGB, Enum, iBlendSrcRGB, 1, mglBlendFuncStr, 0 ),
+    MGL_LIMIT( 1, 4, GL_MAX_TEXTURE_LOD_BIAS, Float, fMaxTextureLODBias, 1, NULL, 0 ),
+    MGL_FIELD( 1, 4, Rasterizer, GL_POINT_FADE_THRESHOLD_SIZE, Float, fPointFadeThresholdSize, 1, NULL, 0 ),
+
+    // GL_VERSION_1_5
+    MGL_FIELD( 1, 5, BufferBindings, GL_ARRAY_BUFFER_BINDING, Integer, iArrayBufferBinding, 1, NULL, 0 ),
+    MGL_FIELD( 1, 5, VertexBindings, GL_ELEMENT_ARRAY_BUFFER_BINDING, Integer, iElementArrayBufferBinding, 1, NULL, 0 ),
+
+    // GL_VERSION_2_0
+    MGL_FIELD( 2, 0, Blend, GL_BLEND_EQUATION_ALPHA, Enum, iBlendEquationAlpha, 1, mglBlendEquationModeStr, 0 ),
+    MGL_FIELD( 2, 0, Blend, GL_BLEND_EQUATION_RGB, Enum, iBlendEquationRGB, 1, mglBlendEquationModeStr, 0 ),
+    MGL_FIELD( 2, 0, Program, GL_CURRENT_PROGRAM, Integer, iCurrentProgram, 1, NULL, 0 ),
+    MGL_FIELD( 2, 0, Framebuffer, GL_DRAW_BUFFER0, Enum, iDrawBuffer_i[0], 1, mglDrawBufferModeStr, 0 ),
+    MGL_FIELD( 2, 0, Framebuffer, GL_DRAW_BUFFER1, Enum, iDrawBuffer_i[1], 1, mglDrawBufferModeStr, 0 ),
+    MGL_FIELD( 2, 0, Framebuffer, GL_DRAW_BUFFER2, Enum, iDrawBuffer_i[2], 1, mglDrawBufferModeStr, 0 ),
+    MGL_FIELD( 2, 0, Framebuffer, GL_DRAW_BUFFER3, Enum, iDrawBuffer_i[3], 1, mglDrawBufferModeStr, 0 ),
+    MGL_FIELD( 2, 0, Framebuffer, GL_DRAW_BUFFER4, Enum, iDrawBuffer_i[4], 1, mglDrawBufferModeStr, 0 ),
+    MGL_FIELD( 2, 0, Framebuffer, GL_DRAW_BUFFER5, Enum, iDrawBuffer_i[5], 1, mglDrawBufferModeStr, 0 ),
+    MGL_FIELD( 2, 0, Framebuffer, GL_DRAW_BUFFER6, Enum, iDrawBuffer_i[6], 1, mglDrawBufferModeStr, 0 ),
+    MGL_FIELD( 2, 0, Framebuffer, GL_DRAW_BUFFER7, Enum, iDrawBuffer_i[7], 1, mglDrawBufferModeStr, 0 ),
+    MGL_FIELD( 2, 0, Framebuffer, GL_DRAW_BUFFER8, Enum, iDrawBuffer_i[8], 1, mglDrawBufferModeStr, 0 ),
+    MGL_FIELD( 2, 0, Framebuffer, GL_DRAW_BUFFER9, Enum, iDrawBuffer_i[9], 1, mglDrawBufferModeStr, 0 ),
+    MGL_FIELD( 2, 0, Framebuffer, GL_DRAW_BUFFER10, Enum, iDrawBuffer_i[10], 1, mglDrawBufferModeStr, 0 ),
+    MGL_FIELD( 2, 0, Framebuffer, GL_DRAW_BUFFER11, Enum, iDrawBuffer_i[11], 1, mglDrawBufferModeStr, 0 ),
+    MGL_FIELD( 2, 0, Framebuffer, GL_DRAW_BUFFER12, Enum, iDrawBuffer_i[12], 1, mglDrawBufferModeStr, 0 ),
+    MGL_FIELD( 2, 0, Framebuffer, GL_DRAW_BUFFER13, Enum, iDrawBuffer_i[13], 1, mglDrawBufferModeStr, 0 ),
+    MGL_FIELD( 2, 0, Framebuffer, GL_DRAW_BUFFER14, Enum, iDrawBuffer_i[14], 1, mglDrawBufferModeStr, 0 ),
+    MGL_FIELD( 2, 0, Framebuffer, GL_DRAW_BUFFER15, Enum, iDrawBuffer_i[15], 1, mglDrawBufferModeStr, 0 ),
+    MGL_FIELD( 2, 0, Hints, GL_FRAGMENT_SHADER_DERIVATIVE_HINT, Enum, iFragmentShaderDerivativeHint, 1, mglHintModeStr, 0 ),
+    MGL_LIMIT( 2, 0, GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS, Integer, iMaxCombinedTextureImageUnits, 1, NULL, 0 ),
+    MGL_LIMIT( 2, 0, GL_MAX_DRAW_BUFFERS, Integer, iMaxDrawBuffers, 1, NULL, 0 ),
+    MGL_LIMIT( 2, 0, GL_MAX_FRAGMENT_UNIFORM_COMPONENTS, Integer, iMaxFragmentUniformComponents, 1, NULL, 0 ),
+    MGL_LIMIT( 2, 0, GL_MAX_TEXTURE_IMAGE_UNITS, Integer, iMaxTextureImageUnits, 1, NULL, 0 ),
+    MGL_LIMIT( 2, 0, GL_MAX_VARYING_FLOATS, Integer, iMaxVaryingFloats, 1, NULL, 0 ),
+    MGL_LIMIT( 2, 0, GL_MAX_VERTEX_ATTRIBS, Integer, iMaxVertexAttribs, 1, NULL, 0 ),
+    MGL_LIMIT( 2, 0, GL_MAX_VERTEX_TEXTURE_IMAGE_UNITS, Integer, iMaxVertexTextureImageUnits, 1, NULL, 0 ),
+    MGL_LIMIT( 2, 0, GL_MAX_VERTEX_UNIFORM_COMPONENTS, Integer, iMaxVertexUniformComponents, 1, NULL, 0 ),
+    MGL_FIELD( 2, 0, DepthStencil, GL_STENCIL_BACK_FAIL, Enum, iStencilBackFail, 1, mglStencilOpStr, 0 ),
+    MGL_FIELD( 2, 0, DepthStencil, GL_STENCIL_BACK_FUNC, Enum, iStencilBackFunc, 1, mglCompareFuncStr, 0 ),
+    MGL_FIELD( 2, 0, DepthStencil, GL_STENCIL_BACK_PASS_DEPTH_FAIL, Enum, iStencilBackPassDepthFail, 1, mglStencilOpStr, 0 ),
+    MGL_FIELD( 2, 0, DepthStencil, GL_STENCIL_BACK_PASS_DEPTH_PASS, Enum, iStencilBackPassDepthPass, 1, mglStencilOpStr, 0 ),
+    MGL_FIELD( 2, 0, DepthStencil, GL_STENCIL_BACK_REF, Integer, iStencilBackRef, 1, NULL, 0 ),
+    MGL_FIELD( 2, 0, DepthStencil, GL_STENCIL_BACK_VALUE_MASK, IntegerHex, iStencilBackValueMask, 1, NULL, 0 ),
+    MGL_FIELD( 2, 0, DepthStencil, GL_STENCIL_BACK_WRITEMASK, IntegerHex, iStencilBackWriteMask, 1, NULL, 0 ),
+
+    // GL_VERSION_2_1
+    MGL_FIELD( 2, 1, BufferBindings, GL_PIXEL_PACK_BUFFER_BINDING, Integer, iPixelPackBufferBinding, 1, NULL, 0 ),
+    MGL_FIELD( 2, 1, BufferBindings, GL_PIXEL_UNPACK_BUFFER_BINDING, Integer, iPixelUnpackBufferBinding, 1, NULL, 0 ),
+
+    // GL_VERSION_3_0
+    MGL_LIMIT( 3, 0, GL_CONTEXT_FLAGS, Bitfield, iContextFlags, 32, mglContextFlagBitStr, 0 ),
+    MGL_FIELD( 3, 0, Framebuffer, GL_DRAW_FRAMEBUFFER_BINDING, Integer, iDrawFramebufferBinding, 1, NULL, 0 ),
+    MGL_LIMIT( 3, 0, GL_MAX_ARRAY_TEXTURE_LAYERS, Integer, iMaxArrayTextureLayers, 1, NULL, 0 ),
+    MGL_LIMIT( 3, 0, GL_MAX_CLIP_DISTANCES, Integer, iMaxClipDistances, 1, NULL, 0 ),
+    MGL_LIMIT( 3, 0, GL_MAX_RENDERBUFFER_SIZE, Integer, iMaxRenderbufferSize, 1, NULL, 0 ),
+    MGL_LIMIT( 3, 0, GL_MAX_VARYING_COMPONENTS, Integer, iMaxVaryingComponents, 1, NULL, 0 ),
+    MGL_LIMIT( 3, 0, GL_NUM_EXTENSIONS, Integer, iNumExtensions, 1, NULL, 0 ),
+    MGL_LIMIT( 3, 0, GL_MIN_PROGRAM_TEXEL_OFFSET, Integer, iMinProgramTexelOffest, 1, NULL, 0 ),
+    MGL_LIMIT( 3, 0, GL_MAX_PROGRAM_TEXEL_OFFSET, Integer, iMaxProgramTexelOffest, 1, NULL, 0 ),
+    MGL_FIELD( 3, 0, Framebuffer, GL_READ_FRAMEBUFFER_BINDING, Integer, iReadFramebufferBinding, 1, NULL, 0 ),
+    MGL_FIELD( 3, 0, Framebuffer, GL_RENDERBUFFER_BINDING, Integer, iRenderbufferBinding, 1, NULL, 0 ),
+    MGL_FIELD( 3, 0, Textures, GL_TEXTURE_BINDING_1D_ARRAY, Integer, iTextureBinding1DArray, 1, NULL, 0 ),
+    MGL_FIELD( 3, 0, Textures, GL_TEXTURE_BINDING_2D_ARRAY, Integer, iTextureBinding2DArray, 1, NULL, 0 ),
+    MGL_FIELD( 3, 0, BufferBindings, GL_TRANSFORM_FEEDBACK_BUFFER_BINDING, IntegerArray, iTransformFeedbackBufferBinding, MGL_MAX_TRANSFORM_FEEDBACK_BUFFER_BINDINGS, NULL, MGLFieldFlagIndexed ),
+    MGL_FIELD( 3, 0, BufferBindings, GL_TRANSFORM_FEEDBACK_BUFFER_SIZE, Integer64Array, iTransformFeedbackBufferSize, MGL_MAX_TRANSFORM_FEEDBACK_BUFFER_BINDINGS, NULL, MGLFieldFlagIndexed ),
+    MGL_FIELD( 3, 0, BufferBindings, GL_TRANSFORM_FEEDBACK_BUFFER_START, Integer64Array, iTransformFeedbackBufferStart, MGL_MAX_TRANSFORM_FEEDBACK_BUFFER_BINDINGS, NULL, MGLFieldFlagIndexed ),
+    MGL_FIELD( 3, 0, VertexBindings, GL_VERTEX_ARRAY_BINDING, Integer, iVertexArrayBinding, 1, NULL, 0 ),
+
+    // GL_VERSION_3_1
+    MGL_LIMIT( 3, 1, GL_MAX_COMBINED_FRAGMENT_UNIFORM_COMPONENTS, Integer, iMaxCombinedFragmentUniformComponents, 1, NULL, 0 ),
+    MGL_LIMIT( 3, 1, GL_MAX_COMBINED_GEOMETRY_UNIFORM_COMPONENTS, Integer, iMaxCombinedGeometryUniformComponents, 1, NULL, 0 ),
+    MGL_LIMIT( 3, 1, GL_MAX_COMBINED_VERTEX_UNIFORM_COMPONENTS, Integer, iMaxCombinedVertexUniformComponents, 1, NULL, 0 ),
+    MGL_LIMIT( 3, 1, GL_MAX_COMBINED_UNIFORM_BLOCKS, Integer, iMaxCombinedUniformBlocks, 1, NULL, 0 ),
+    MGL_LIMIT( 3, 1, GL_MAX_FRAGMENT_UNIFORM_BLOCKS, Integer, iMaxFragmentUniformBlocks, 1, NULL, 0 ),
+    MGL_LIMIT( 3, 1, GL_MAX_GEOMETRY_UNIFORM_BLOCKS, Integer, iMaxGeometryUniformBlocks, 1, NULL, 0 ),
+    MGL_LIMIT( 3, 1, GL_MAX_VERTEX_UNIFORM_BLOCKS, Integer, iMaxVertexUniformBlocks, 1, NULL, 0 ),
+    MGL_LIMIT( 3, 1, GL_MAX_RECTANGLE_TEXTURE_SIZE, Integer, iMaxRectangleTextureSize, 1, NULL, 0 ),
+    MGL_LIMIT( 3, 1, GL_MAX_TEXTURE_BUFFER_SIZE, Integer, iMaxTextureBufferSize, 1, NULL, 0 ),
+    MGL_LIMIT( 3, 1, GL_MAX_UNIFORM_BUFFER_BINDINGS, Integer, iMaxUniformBufferBindings, 1, NULL, 0 ),
+    MGL_LIMIT( 3, 1, GL_MAX_UNIFORM_BLOCK_SIZE, Integer, iMaxUniformBlockSize, 1, NULL, 0 ),
+    MGL_FIELD( 3, 1, VertexBindings, GL_PRIMITIVE_RESTART_INDEX, Integer, iPrimitiveRestartIndex, 1, NULL, 0 ),
+    MGL_FIELD( 3, 1, Textures, GL_TEXTURE_BINDING_BUFFER, Integer, iTextureBindingBuffer, 1, NULL, 0 ),
+    MGL_FIELD( 3, 1, Textures, GL_TEXTURE_BINDING_RECTANGLE, Integer, iTextureBindingRectangle, 1, NULL, 0 ),
+    MGL_FIELD( 3, 1, BufferBindings, GL_UNIFORM_BUFFER_BINDING, IntegerArray, iUniformBufferBinding, MGL_MAX_UNIFORM_BUFFER_BINDINGS, NULL, MGLFieldFlagIndexed ),
+    MGL_FIELD( 3, 1, BufferBindings, GL_UNIFORM_BUFFER_SIZE, Integer64Array, iUniformBufferSize, MGL_MAX_UNIFORM_BUFFER_BINDINGS, NULL, MGLFieldFlagIndexed ),
+    MGL_FIELD( 3, 1, BufferBindings, GL_UNIFORM_BUFFER_START, Integer64Array, iUniformBufferStart, MGL_MAX_UNIFORM_BUFFER_BINDINGS, NULL, MGLFieldFlagIndexed ),
+    MGL_LIMIT( 3, 1, GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, Integer, iUniformBufferOffsetAlignment, 1, NULL, 0 ),
+
+    // GL_VERSION_3_2
+    MGL_LIMIT( 3, 2, GL_MAX_COLOR_TEXTURE_SAMPLES, Integer, iMaxColorTextureSamples, 1, NULL, 0 ),
+    MGL_LIMIT( 3, 2, GL_MAX_DEPTH_TEXTURE_SAMPLES, Integer, iMaxDepthTextureSamples, 1, NULL, 0 ),
+    MGL_LIMIT( 3, 2, GL_MAX_INTEGER_SAMPLES, Integer, iMaxIntegerSamples, 1, NULL, 0 ),
+    MGL_LIMIT( 3, 2, GL_MAX_GEOMETRY_INPUT_COMPONENTS, Integer, iMaxGeometryInputComponents, 1, NULL, 0 ),
+    MGL_LIMIT( 3, 2, GL_MAX_GEOMETRY_OUTPUT_COMPONENTS, Integer, iMaxGeometryOutputComponents, 1, NULL, 0 ),
+    MGL_LIMIT( 3, 2, GL_MAX_GEOMETRY_TEXTURE_IMAGE_UNITS, Integer, iMaxGeometryTextureImageUnits, 1, NULL, 0 ),
+    MGL_LIMIT( 3, 2, GL_MAX_GEOMETRY_UNIFORM_COMPONENTS, Integer, iMaxGeometryUniformComponents, 1, NULL, 0 ),
+    MGL_LIMIT( 3, 2, GL_MAX_FRAGMENT_INPUT_COMPONENTS, Integer, iMaxFragmentInputComponents, 1, NULL, 0 ),
+    MGL_LIMIT( 3, 2, GL_MAX_VERTEX_OUTPUT_COMPONENTS, Integer, iMaxVertexOutputComponents, 1, NULL, 0 ),
+    MGL_LIMIT( 3, 2, GL_MAX_SAMPLE_MASK_WORDS, Integer, iMaxSampleMaskWords, 1, NULL, 0 ),
+    MGL_LIMIT( 3, 2, GL_MAX_SERVER_WAIT_TIMEOUT, Integer, iMaxServerWaitTimeout, 1, NULL, 0 ),
+    MGL_FIELD( 3, 2, Rasterizer, GL_PROGRAM_POINT_SIZE, Boolean, bProgramPointSize, 1, NULL, 0 ),
+    MGL_FIELD( 3, 2, Rasterizer, GL_PROVOKING_VERTEX, Enum, iProvokingVertex, 1, mglProvokingVertexModeStr, 0 ),
+    MGL_FIELD( 3, 2, Textures, GL_TEXTURE_BINDING_2D_MULTISAMPLE, Integer, iTextureBinding2DMultisample, 1, NULL, 0 ),
+    MGL_FIELD( 3, 2, Textures, GL_TEXTURE_BINDING_2D_MULTISAMPLE_ARRAY, Integer, iTextureBinding2DMultisampleArray, 1, NULL, 0 ),
+
+    // GL_VERSION_3_3
+    MGL_LIMIT( 3, 3, GL_MAX_DUAL_SOURCE_DRAW_BUFFERS, Integer, iMaxDualSourceDrawBuffers, 1, NULL, 0 ),
+    MGL_FIELD( 3, 3, Textures, GL_SAMPLER_BINDING, Integer, iSamplerBinding, 1, NULL, 0 ),
+    MGL_FIELD( 3, 3, Misc, GL_TIMESTAMP, Integer64, iTimestamp, 1, NULL, 0 ),
+
+    // GL_VERSION_4_0
+    MGL_LIMIT( 4, 0, GL_MAX_TRANSFORM_FEEDBACK_BUFFERS, Integer, iMaxTransformFeedbackBuffers, 1, NULL, 0 ),
+    MGL_FIELD( 4, 0, VertexBindings, GL_PATCH_DEFAULT_INNER_LEVEL, Integer, iPatchDefaultInnerLevel, 1, NULL, 0 ),
+    MGL_FIELD( 4, 0, VertexBindings, GL_PATCH_DEFAULT_OUTER_LEVEL, Integer, iPatchDefaultOuterLevel, 1, NULL, 0 ),
+    MGL_FIELD( 4, 0, VertexBindings, GL_PATCH_VERTICES, Integer, iPatchVertices, 1, NULL, 0 ),
+
+    // GL_VERSION_4_1
+    MGL_FIELD( 4, 1, Framebuffer, GL_IMPLEMENTATION_COLOR_READ_FORMAT, Enum, iImplementationColorReadFormat, 1, mglImplementationColorReadFormatStr, 0 ),
+    MGL_FIELD( 4, 1, Framebuffer, GL_IMPLEMENTATION_COLOR_READ_TYPE, Enum, iImplementationColorReadType, 1, mglImplementationColorReadTypeStr, 0 ),
+    MGL_LIMIT( 4, 1, GL_LAYER_PROVOKING_VERTEX, Enum, iLayerProvokingVertex, 1, mglProvokingVertexModeStr, 0 ),
+    MGL_LIMIT( 4, 1, GL_MAX_VARYING_VECTORS, Integer, iMaxVaryingVectors, 1, NULL, 0 ),
+    MGL_LIMIT( 4, 1, GL_MAX_VIEWPORTS, Integer, iMaxViewports, 1, NULL, 0 ),
+    MGL_LIMIT( 4, 1, GL_VIEWPORT_BOUNDS_RANGE, IntegerArray, iViewportBoundsRange, 2, NULL, 0 ),
+    MGL_LIMIT( 4, 1, GL_VIEWPORT_INDEX_PROVOKING_VERTEX, Enum, iViewportIndexProvokingVertex, 1, mglProvokingVertexModeStr, 0 ),
+    MGL_LIMIT( 4, 1, GL_VIEWPORT_SUBPIXEL_BITS, Integer, iViewportSubPixelBits, 1, NULL, 0 ),
+    MGL_LIMIT( 4, 1, GL_MAX_FRAGMENT_UNIFORM_VECTORS, Integer, iMaxFragmentUniformVectors, 1, NULL, 0 ),
+    MGL_LIMIT( 4, 1, GL_MAX_VERTEX_UNIFORM_VECTORS, Integer, iMaxVertexUniformVectors, 1, NULL, 0 ),
+    MGL_LIMIT( 4, 1, GL_NUM_SHADER_BINARY_FORMATS, Integer, iNumShaderBinaryFormats, 1, NULL, 0 ),
+    MGL_LIMIT_DYN( 4, 1, GL_SHADER_BINARY_FORMATS, IntegerArrayHex, iShaderBinaryFormats, MGL_MAX_SHADER_BINARY_FORMATS, iNumShaderBinaryFormats, NULL ),
+    MGL_LIMIT( 4, 1, GL_NUM_PROGRAM_BINARY_FORMATS, Integer, iNumProgramBinaryFormats, 1, NULL, 0 ),
+    MGL_LIMIT_DYN( 4, 1, GL_PROGRAM_BINARY_FORMATS, IntegerArrayHex, iProgramBinaryFormats, MGL_MAX_PROGRAM_BINARY_FORMATS, iNumProgramBinaryFormats, NULL ),
+    MGL_FIELD( 4, 1, Program, GL_PROGRAM_PIPELINE_BINDING, Integer, iProgramPipelineBinding, 1, NULL, 0 ),
+    MGL_LIMIT( 4, 1, GL_SHADER_COMPILER, Boolean, bShaderCompiler, 1, NULL, 0 ),
+
+    // GL_VERSION_4_2
+    MGL_LIMIT( 4, 2, GL_MAX_COMBINED_ATOMIC_COUNTERS, Integer, iMaxCombinedAtomicCounters, 1, NULL, 0 ),
+    MGL_LIMIT( 4, 2, GL_MAX_VERTEX_ATOMIC_COUNTERS, Integer, iMaxVertexAtomicCounters, 1, NULL, 0 ),
+    MGL_LIMIT( 4, 2, GL_MAX_TESS_CONTROL_ATOMIC_COUNTERS, Integer, iMaxTessControlAtomicCounters, 1, NULL, 0 ),
+    MGL_LIMIT( 4, 2, GL_MAX_TESS_EVALUATION_ATOMIC_COUNTERS, Integer, iMaxTessEvaluationAtomicCounters, 1, NULL, 0 ),
+    MGL_LIMIT( 4, 2, GL_MAX_GEOMETRY_ATOMIC_COUNTERS, Integer, iMaxGeometryAtomicCounters, 1, NULL, 0 ),
+    MGL_LIMIT( 4, 2, GL_MAX_FRAGMENT_ATOMIC_COUNTERS, Integer, iMaxFragmentAtomicCounters, 1, NULL, 0 ),
+    MGL_LIMIT( 4, 2, GL_MIN_MAP_BUFFER_ALIGNMENT, Integer, iMinMapBufferAlignment, 1, NULL, 0 ),
+
+    // GL_VERSION_4_3
+    MGL_LIMIT( 4, 3, GL_MAX_ELEMENT_INDEX, UInteger, iMaxElementIndex, 1, NULL, 0 ),
+    MGL_LIMIT( 4, 3, GL_MAX_COMBINED_COMPUTE_UNIFORM_COMPONENTS, Integer, iMaxCombinedComputeUniformComponents, 1, NULL, 0 ),
+    MGL_LIMIT( 4, 3, GL_MAX_COMBINED_SHADER_STORAGE_BLOCKS, Integer, iMaxCombinedShaderStorageBlocks, 1, NULL, 0 ),
+    MGL_LIMIT( 4, 3, GL_MAX_COMPUTE_UNIFORM_BLOCKS, Integer, iMaxComputeUniformBlocks, 1, NULL, 0 ),
+    MGL_LIMIT( 4, 3, GL_MAX_COMPUTE_TEXTURE_IMAGE_UNITS, Integer, iMaxComputeTextureImageUnits, 1, NULL, 0 ),
+    MGL_LIMIT( 4, 3, GL_MAX_COMPUTE_UNIFORM_COMPONENTS, Integer, iMaxComputeUniformComponents, 1, NULL, 0 ),
+    MGL_LIMIT( 4, 3, GL_MAX_COMPUTE_ATOMIC_COUNTERS, Integer, iMaxComputeAtomicCounters, 1, NULL, 0 ),
+    MGL_LIMIT( 4, 3, GL_MAX_COMPUTE_ATOMIC_COUNTER_BUFFERS, Integer, iMaxComputeAtomicCounterBuffers, 1, NULL, 0 ),
+    MGL_LIMIT( 4, 3, GL_MAX_COMPUTE_WORK_GROUP_COUNT, IntegerArray, iMaxComputeWorkGroupCount, 3, NULL, MGLFieldFlagIndexed ),
+    MGL_LIMIT( 4, 3, GL_MAX_COMPUTE_WORK_GROUP_INVOCATIONS, Integer, iMaxComputeWorkGroup, 1, NULL, 0 ),
+    MGL_LIMIT( 4, 3, GL_MAX_COMPUTE_WORK_GROUP_SIZE, IntegerArray, iMaxComputeWorkGroupSize, 3, NULL, MGLFieldFlagIndexed ),
+    MGL_FIELD( 4, 3, BufferBindings, GL_DISPATCH_INDIRECT_BUFFER_BINDING, Integer, iDispatchIndirectBufferBinding, 1, NULL, 0 ),
+    MGL_LIMIT( 4, 3, GL_MAX_DEBUG_GROUP_STACK_DEPTH, Integer, iMaxDebugGroupStackDepth, 1, NULL, 0 ),
+    MGL_FIELD( 4, 3, Misc, GL_DEBUG_GROUP_STACK_DEPTH, Integer, iDebugGroupStackDepth, 1, NULL, 0 ),
+    MGL_LIMIT( 4, 3, GL_MAX_LABEL_LENGTH, Integer, iMaxLabelLength, 1, NULL, 0 ),
+    MGL_LIMIT( 4, 3, GL_MAX_UNIFORM_LOCATIONS, Integer, iMaxUniformLocations, 1, NULL, 0 ),
+    MGL_LIMIT( 4, 3, GL_MAX_FRAMEBUFFER_WIDTH, Integer, iMaxFramebufferWidth, 1, NULL, 0 ),
+    MGL_LIMIT( 4, 3, GL_MAX_FRAMEBUFFER_HEIGHT, Integer, iMaxFramebufferHeight, 1, NULL, 0 ),
+    MGL_LIMIT( 4, 3, GL_MAX_FRAMEBUFFER_LAYERS, Integer, iMaxFramebufferLayers, 1, NULL, 0 ),
+    MGL_LIMIT( 4, 3, GL_MAX_FRAMEBUFFER_SAMPLES, Integer, iMaxFramebufferSamples, 1, NULL, 0 ),
+    MGL_LIMIT( 4, 3, GL_MAX_VERTEX_SHADER_STORAGE_BLOCKS, Integer, iMaxVertexShaderStorageBlocks, 1, NULL, 0 ),
+    MGL_LIMIT( 4, 3, GL_MAX_TESS_CONTROL_SHADER_STORAGE_BLOCKS, Integer, iMaxTessControlShaderStorageBlocks, 1, NULL, 0 ),
+    MGL_LIMIT( 4, 3, GL_MAX_TESS_EVALUATION_SHADER_STORAGE_BLOCKS, Integer, iMaxTessEvaluationShaderStorageBlocks, 1, NULL, 0 ),
+    MGL_LIMIT( 4, 3, GL_MAX_GEOMETRY_SHADER_STORAGE_BLOCKS, Integer, iMaxGeometryShaderStorageBlocks, 1, NULL, 0 ),
+    MGL_LIMIT( 4, 3, GL_MAX_FRAGMENT_SHADER_STORAGE_BLOCKS, Integer, iMaxFragmentShaderStorageBlocks, 1, NULL, 0 ),
+    MGL_LIMIT( 4, 3, GL_MAX_COMPUTE_SHADER_STORAGE_BLOCKS, Integer, iMaxComputeShaderStorageBlocks, 1, NULL, 0 ),
+    MGL_LIMIT( 4, 3, GL_TEXTURE_BUFFER_OFFSET_ALIGNMENT, Integer, iTextureBufferOffsetAlignment, 1, NULL, 0 ),
+    MGL_FIELD( 4, 3, VertexBindings, GL_VERTEX_BINDING_DIVISOR, IntegerArray, iVertexBindingDivisor, MGL_MAX_VERTEX_BUFFER_BINDINGS, NULL, MGLFieldFlagIndexed ),
+    MGL_FIELD( 4, 3, VertexBindings, GL_VERTEX_BINDING_OFFSET, IntegerArray, iVertexBindingOffset, MGL_MAX_VERTEX_BUFFER_BINDINGS, NULL, MGLFieldFlagIndexed ),
+    MGL_FIELD( 4, 3, VertexBindings, GL_VERTEX_BINDING_STRIDE, IntegerArray, iVertexBindingStride, MGL_MAX_VERTEX_BUFFER_BINDINGS, NULL, MGLFieldFlagIndexed ),
+    MGL_LIMIT( 4, 3, GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET, Integer, iMaxVertexAttribRelativeOffset, 1, NULL, 0 ),
+    MGL_LIMIT( 4, 3, GL_MAX_VERTEX_ATTRIB_BINDINGS, Integer, iMaxVertexAttribBindings, 1, NULL, 0 ),
+    MGL_LIMIT( 4, 3, GL_MAX_SHADER_STORAGE_BUFFER_BINDINGS, Integer, iMaxShaderStorageBufferBindings, 1, NULL, 0 ),
+    MGL_FIELD( 4, 3, BufferBindings, GL_SHADER_STORAGE_BUFFER_BINDING, IntegerArray, iShaderStorageBufferBinding, MGL_MAX_SHADER_STORAGE_BUFFER_BINDINGS, NULL, MGLFieldFlagIndexed ),
+    MGL_LIMIT( 4, 3, GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, Integer, iShaderStorageBufferOffsetAlignment, 1, NULL, 0 ),
+    MGL_FIELD( 4, 3, BufferBindings, GL_SHADER_STORAGE_BUFFER_SIZE, Integer64Array, iShaderStorageBufferSize, MGL_MAX_SHADER_STORAGE_BUFFER_BINDINGS, NULL, MGLFieldFlagIndexed ),
+    MGL_FIELD( 4, 3, BufferBindings, GL_SHADER_STORAGE_BUFFER_START, Integer64Array, iShaderStorageBufferStart, MGL_MAX_SHADER_STORAGE_BUFFER_BINDINGS, NULL, MGLFieldFlagIndexed ),
+
+    // GL_VERSION_4_5
+    MGL_FIELD( 4, 5, Rasterizer, GL_CLIP_DEPTH_MODE, Enum, iClipDepthMode, 1, mglClipDepthModeStr, 0 ),
+    MGL_FIELD( 4, 5, Rasterizer, GL_CLIP_ORIGIN, Enum, iClipOrigin, 1, mglClipOriginStr, 0 ),
+};
+
+// All fields of MGLBindingPoints in the same order as they are printed by mglPrintBindingPoints
+static const MGLFieldDescriptor g_MGLBindingPointsFields[] =
+{
+    MGL_FIELD_BP( 1, 1, GL_TEXTURE_BINDING_1D,                     iTextureBinding1D                   ),
+    MGL_FIELD_BP( 3, 0, GL_TEXTURE_BINDING_1D_ARRAY,               iTextureBinding1DArray              ),
+    MGL_FIELD_BP( 1, 1, GL_TEXTURE_BINDING_2D,                     iTextureBinding2D                   ),
+    MGL_FIELD_BP( 3, 0, GL_TEXTURE_BINDING_2D_ARRAY,               iTextureBinding2DArray              ),
+    MGL_FIELD_BP( 3, 2, GL_TEXTURE_BINDING_2D_MULTISAMPLE,         iTextureBinding2DMultisample        ),
+    MGL_FIELD_BP( 3, 2, GL_TEXTURE_BINDING_2D_MULTISAMPLE_ARRAY,   iTextureBinding2DMultisampleArray   ),
+    MGL_FIELD_BP( 1, 2, GL_TEXTURE_BINDING_3D,                     iTextureBinding3D                   ),
+    MGL_FIELD_BP( 3, 1, GL_TEXTURE_BINDING_BUFFER,                 iTextureBindingBuffer               ),
+    MGL_FIELD_BP( 1, 3, GL_TEXTURE_BINDING_CUBE_MAP,               iTextureBindingCubeMap              ),
+    MGL_FIELD_BP( 3, 1, GL_TEXTURE_BINDING_RECTANGLE,              iTextureBindingRectangle            ),
+};
+
+#undef MGL_FIELD_ENTRY
+#undef MGL_FIELD
+#undef MGL_LIMIT
+#undef MGL_LIMIT_DYN
+#undef MGL_FIELD_BP
+
+#define MGL_NUM_RENDER_STATE_FIELDS     (sizeof(g_MGLRenderStateFields) / sizeof(g_MGLRenderStateFields[0]))
+#define MGL_NUM_BINDING_POINTS_FIELDS   (sizeof(g_MGLBindingPointsFields) / sizeof(g_MGLBindingPointsFields[0]))
+
+// Indices into g_MGLRenderStateFields in ascending order of the field names (by strcmp), used for MGLFormattingOrderSorted
+// This order must be updated whenever a field is added to or renamed in g_MGLRenderStateFields
+static const unsigned short g_MGLRenderStateFieldsSorted[] =
+{
+     79,  63,  91,   2,  64,  85,  86,  93,  94,  87,  88, 247, 248,   3,  57,   4,
+     76, 130,   5,   6,  95, 223,   7,   8,   9,  10,  11, 221,  12,  13,  14,  96,
+     97, 106, 107, 108, 109, 110, 111,  98,  99, 100, 101, 102, 103, 104, 105, 131,
+     92, 112,  15, 187, 188, 189,  16,  17,  18,  19,   0,  65, 132, 133, 165, 203,
+    211, 147, 148, 212, 113, 150, 149, 216, 217, 235, 214, 213, 215, 218, 219, 220,
+     80, 222, 166, 114, 180,  66,  67, 210, 208, 172, 234, 151, 115, 195, 227, 228,
+    229, 226, 207, 168, 169, 233, 170, 152, 171, 167, 224, 138, 154, 134, 174, 175,
+    242, 205, 231, 206, 232, 155, 116,  89,  20, 183, 157, 156, 225, 135, 117, 190,
+    204, 118, 241, 240, 173, 230, 119, 153, 120, 196, 191,  21,   1, 209, 137,  75,
+    136, 199, 197,  22,  68,  23,  24,  69,  25,  26,  27, 184, 185, 186, 128, 129,
+     90,  28,  29,  30,  31,  58,  60,  61,  62,  59,  32,  33, 158, 200, 201, 176,
+    177,  34, 139, 140, 181,  84,  81,  83,  82,  35,  36, 198, 202, 243, 244, 245,
+    246,  71,  70, 121, 122, 123, 124, 125, 126, 127,  37,  38,  39,  40,  41,  42,
+     43,  44,  45,  46,  47,  48, 141,  49, 142, 178, 179,  72, 159,  77, 160, 236,
+     78, 182, 143, 144, 145, 161, 164, 162, 163,  50,  73,  51,  52,  74,  53,  54,
+     55, 146, 237, 238, 239,  56, 192, 193, 194
+};
+
+// Indices into g_MGLBindingPointsFields in ascending order of the field names (by strcmp), used for MGLFormattingOrderSorted
+static const unsigned short g_MGLBindingPointsFieldsSorted[] =
+{
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9
+};
+
+// Compile time check that the sorted index tables cover all fields
+typedef char MGLCheckRenderStateFieldsSorted[(sizeof(g_MGLRenderStateFieldsSorted) / sizeof(g_MGLRenderStateFieldsSorted[0]) == MGL_NUM_RENDER_STATE_FIELDS) ? 1 : -1];
+typedef char MGLCheckBindingPointsFieldsSorted[(sizeof(g_MGLBindingPointsFieldsSorted) / sizeof(g_MGLBindingPointsFieldsSorted[0]) == MGL_NUM_BINDING_POINTS_FIELDS) ? 1 : -1];
+
+// Indices into g_MGLRenderStateFields in the order of MGLPackedRenderState: boolean fields, hot fields, and cold fields; implementation dependent limits are omitted
+// The numbers of state words must match MGL_PACKED_RENDER_STATE_FLAG_WORDS, MGL_PACKED_RENDER_STATE_HOT_WORDS, and MGL_PACKED_RENDER_STATE_COLD_WORDS
+static const unsigned short g_MGLPackedRenderStateFields[] =
+{
+    // Boolean fields
+      2,   4,   5,  10,  11,  12,  13,  16,  23,  27,  32,  36,  43,  46,  51,  55,
+     57,  60,  61,  62,  83, 176,
+
+    // Hot fields
+     19,  64,  85,  86,  87,  88,  93,  94,   7,   8,   9,  37,  38,  39,  40,  41,
+     42,  44,  45, 121, 122, 123, 124, 125, 126, 127,   6,  15,  18,  28,  31,  35,
+     56,  58,  59,  82,  90, 177, 247, 248,  91, 128, 129, 221,  95, 201,  92, 146,
+    158, 184, 185, 186,  48,  49,  72,  77,  79, 141, 142, 159, 160, 178, 179, 181,
+      3,  14,  34,  81,  84,  96,  97,  98,  99, 100, 101, 102, 103, 104, 105, 106,
+    107, 108, 109, 110, 111, 131, 139, 140, 187, 188,
+
+    // Cold fields, GL_TIMESTAMP last (see MGL_PACKED_TIMESTAMP_WORDS)
+     17,  22,  24,  25,  26,  33,  50,  52,  53,  54,  68,  69,  73,  74,  78, 112,
+    143, 144, 145, 161, 162, 163, 223, 237, 238, 239, 243, 245, 246, 182
+};
+
+#define MGL_NUM_PACKED_BOOLEAN_FIELDS   22
+#define MGL_NUM_PACKED_HOT_FIELDS       90
+#define MGL_PACKED_TIMESTAMP_WORDS      (sizeof(GLint64) / sizeof(GLuint))
+#define MGL_NUM_PACKED_FIELDS           (sizeof(g_MGLPackedRenderStateFields) / sizeof(g_MGLPackedRenderStateFields[0]))
+
+// Internal object behind MGLFilter with one selection bit per field
+typedef struct MGLFilterInternal
+{
+    GLuint render_state[(MGL_NUM_RENDER_STATE_FIELDS + 31) / 32];
+    GLuint binding_points[(MGL_NUM_BINDING_POINTS_FIELDS + 31) / 32];
+}
+MGLFilterInternal;
+
+// Returns the selection bits of the compiled filter for the specified field table
+static const GLuint* mglFilterBits(const MGLFilterInternal* filter, const MGLFieldDescriptor* fields)
+{
+    return (fields == g_MGLBindingPointsFields ? filter->binding_points : filter->render_state);
+}
+
+// Returns true if the specified field is selected by the filter descriptor
+static int mglFilterSelectsField(const MGLFilterDescriptor* desc, const MGLFieldDescriptor* field)
+{
+    if (desc->categories != 0 && (field->category & desc->categories) == 0)
+        return 0;
+
+    if (desc->num_patterns == 0 && desc->num_pnames == 0)
+        return 1;
+
+    for (size_t i = 0; i < desc->num_patterns; ++i)
+    {
+        if (strstr(field->name, desc->patterns[i]) != NULL)
+            return 1;
+    }
+
+    for (size_t i = 0; i < desc->num_pnames; ++i)
+    {
+        if (field->pname != 0 && field->pname == desc->pnames[i])
+            return 1;
+    }
+
+    return 0;
+}
+
+// Stores the selection bits for all fields of the specified table
+static void mglCompileFilterBits(GLuint* bits, const MGLFieldDescriptor* fields, size_t num_fields, const MGLFilterDescriptor* desc)
+{
+    for (size_t i = 0; i < num_fields; ++i)
+    {
+        if (mglFilterSelectsField(desc, &(fields[i])))
+            bits[i / 32] |= (1u << (i % 32));
+    }
+}
+
+// Returns the size (in bytes) of a single element of the specified field type
+static size_t mglFieldElementSize(unsigned type)
+{
+    switch (type)
+    {
+        case MGLFieldTypeBoolean:
+        case MGLFieldTypeBooleanArray:
+            return sizeof(GLboolean);
+        case MGLFieldTypeFloat:
+        case MGLFieldTypeFloatArray:
+            return sizeof(GLfloat);
+        case MGLFieldTypeDouble:
+        case MGLFieldTypeDoubleArray:
+            return sizeof(GLdouble);
+        case MGLFieldTypeInteger64:
+        case MGLFieldTypeInteger64Array:
+            return sizeof(GLint64);
+        default:
+            return sizeof(GLint);
+    }
+}
+
+// Returns the size (in bytes) the specified field occupies within its state structure
+static size_t mglFieldSize(const MGLFieldDescriptor* field)
+{
+    switch (field->type)
+    {
+        case MGLFieldTypeIntegerArray:
+        case MGLFieldTypeIntegerArrayHex:
+        case MGLFieldTypeEnumArray:
+        case MGLFieldTypeInteger64Array:
+        case MGLFieldTypeFloatArray:
+        case MGLFieldTypeDoubleArray:
+        case MGLFieldTypeBooleanArray:
+            return mglFieldElementSize(field->type) * field->count;
+        default:
+            return mglFieldElementSize(field->type);
+    }
+}
+
+// Appends the specified field of the state structure 'base' to the string pair array
+static void mglNextParamField(MGLStringPairArray* str_array, const MGLFieldDescriptor* field, const void* base, const MGLFormattingOptions* formatting)
+{
+    const char* val = (const char*)base + field->offset;
+    size_t      count = field->count;
+
+    if (field->count_offset != MGL_FIELD_NO_OFFSET)
+        count = (size_t)MGL_MAX(0, *(const GLint*)((const char*)base + field->count_offset));
+
+    switch (field->type)
+    {
+        case MGLFieldTypeInteger:
+            mglNextParamInteger(str_array, field->category, field->name, *(const GLint*)val);
+            break;
+        case MGLFieldTypeUInteger:
+            mglNextParamUInteger(str_array, field->category, field->name, (GLuint)*(const GLint*)val);
+            break;
+        case MGLFieldTypeIntegerHex:
+            mglNextParamIntegerHex(str_array, field->category, field->name, *(const GLint*)val);
+            break;
+        case MGLFieldTypeBoolean:
+            mglNextParamBoolean(str_array, field->category, field->name, *(const GLboolean*)val);
+            break;
+        case MGLFieldTypeEnum:
+            mglNextParamEnum(str_array, field->category, field->name, *(const GLint*)val, field->proc);
+            break;
+        case MGLFieldTypeBitfield:
+            mglNextParamBitfield(str_array, field->category, field->name, (GLbitfield)*(const GLint*)val, field->count, field->proc);
+            break;
+        case MGLFieldTypeInteger64:
+            mglNextParamInteger64(str_array, field->category, field->name, *(const GLint64*)val);
+            break;
+        case MGLFieldTypeFloat:
+            mglNextParamFloat(str_array, field->category, field->name, *(const GLfloat*)val);
+            break;
+        case MGLFieldTypeDouble:
+            mglNextParamDouble(str_array, field->category, field->name, *(const GLdouble*)val);
+            break;
+        case MGLFieldTypeIntegerArray:
+            mglNextParamIntegerArray(str_array, field->category, field->name, (const GLint*)val, count, field->count, 0);
+            break;
+        case MGLFieldTypeIntegerArrayHex:
+            mglNextParamIntegerArray(str_array, field->category, field->name, (const GLint*)val, count, field->count, formatting->enable_hex);
+            break;
+        case MGLFieldTypeEnumArray:
+            mglNextParamEnumArray(str_array, field->category, field->name, (const GLint*)val, count, field->count, field->proc);
+            break;
+        case MGLFieldTypeInteger64Array:
+            mglNextParamInteger64Array(str_array, field->category, field->name, (const GLint64*)val, count, field->count);
+            break;
+        case MGLFieldTypeFloatArray:
+            mglNextParamFloatArray(str_array, field->category, field->name, (const GLfloat*)val, count);
+            break;
+        case MGLFieldTypeDoubleArray:
+            mglNextParamDoubleArray(str_array, field->category, field->name, (const GLdouble*)val, count);
+            break;
+        case MGLFieldTypeBooleanArray:
+            mglNextParamBooleanArray(str_array, field->category, field->name, (const GLboolean*)val, count);
+            break;
+    }
+}
+
+// Appends the specified field of both state structures to the string pair array as a single entry of the form "old -> new"
+static void mglNextParamFieldDiff(MGLStringPairArray* str_array, const MGLFieldDescriptor* field, const void* lhs, const void* rhs, const MGLFormattingOptions* formatting)
+{
+    size_t index = str_array->index;
+
+    mglNextParamField(str_array, field, lhs, formatting);
+
+    // Field might have been filtered out by its category
+    if (str_array->index == index)
+        return;
+
+    mglNextParamField(str_array, field, rhs, formatting);
+
+    // Merge second value into first entry
+    mglStringInternalAppendCStr(&(str_array->second[index]), " -> ");
+    mglStringInternalAppend(&(str_array->second[index]), &(str_array->second[index + 1]));
+
+    if (str_array->second[index + 1].failed)
+        str_array->second[index].failed = 1;
+
+    str_array->index = index + 1;
+}
+
+// Compares all fields of the state structures 'lhs' and 'rhs' and returns the total number of changed fields
+static size_t mglDiffFields(const MGLFieldDescriptor* fields, size_t num_fields, const void* lhs, const void* rhs, MGLStateChange* changes, size_t max_changes)
+{
+    size_t num_changes = 0;
+
+    for (size_t i = 0; i < num_fields; ++i)
+    {
+        const size_t offset = fields[i].offset;
+        const size_t size   = mglFieldSize(&(fields[i]));
+
+        if (memcmp((const char*)lhs + offset, (const char*)rhs + offset, size) != 0)
+        {
+            if (changes != NULL && num_changes < max_changes)
+            {
+                changes[num_changes].name   = fields[i].name;
+                changes[num_changes].offset = offset;
+                changes[num_changes].size   = size;
+            }
+            ++num_changes;
+        }
+    }
+
+    return num_changes;
+}
+
+// Returns non-zero if the specified field can be queried from a GL context with the specified version
+static int mglIsFieldAvailable(const MGLFieldDescriptor* field, unsigned version)
+{
+    #define MGL_VERSION(MAJOR, MINOR)       (((MAJOR) << 16) | (MINOR))
+
+    // Fields above MGL_MAX_VERSION have no pname
+    if (field->pname == 0)
+        return 0;
+
+    #if !defined MENTAL_GL_MIN_VERSION || !defined MENTAL_GL_MAX_VERSION || MENTAL_GL_MIN_VERSION < MENTAL_GL_MAX_VERSION
+    if (!MGL_IS_VERSION_SUPPORTED(version, field->version))
+        return 0;
+    #endif
+
+    // Indexed fields require glGetIntegeri_v (GL 3.0) or glGetInteger64i_v (GL 3.2)
+    if ((field->flags & MGLFieldFlagIndexed) != 0)
+    {
+        if (field->type == MGLFieldTypeInteger64Array)
+        {
+            #ifdef GL_VERSION_3_2
+            return MGL_IS_VERSION_SUPPORTED(version, MGL_VERSION(3, 2));
+            #else
+            return 0;
+            #endif
+        }
+        #ifdef GL_VERSION_3_0
+        return MGL_IS_VERSION_SUPPORTED(version, MGL_VERSION(3, 0));
+        #else
+        return 0;
+        #endif
+    }
+
+    #undef MGL_VERSION
+
+    return 1;
+}
+
+// Returns the implementation limit of the number of elements of the specified indexed field, or 0 if the field has a fixed number of elements.
+// 'offset' receives the byte offset of the limit within MGLRenderState, or MGL_FIELD_NO_OFFSET if the limit is no render state field
+static GLenum mglIndexedFieldLimit(GLenum pname, unsigned version, size_t* offset)
+{
+    #define MGL_VERSION(MAJOR, MINOR)       (((MAJOR) << 16) | (MINOR))
+
+    GLenum limit = 0;
+    *offset = MGL_FIELD_NO_OFFSET;
+
+    switch (pname)
+    {
+        #ifdef GL_VERSION_3_0
+        case GL_TRANSFORM_FEEDBACK_BUFFER_BINDING:
+        case GL_TRANSFORM_FEEDBACK_BUFFER_SIZE:
+        case GL_TRANSFORM_FEEDBACK_BUFFER_START:
+            // Binding points are limited by the number of separate attributes before GL 4.0
+            #ifdef GL_VERSION_4_0
+            if (MGL_IS_VERSION_SUPPORTED(version, MGL_VERSION(4, 0)))
+            {
+                *offset = offsetof(MGLRenderState, iMaxTransformFeedbackBuffers);
+                limit = GL_MAX_TRANSFORM_FEEDBACK_BUFFERS;
+                break;
+            }
+            #endif // /GL_VERSION_4_0
+            limit = GL_MAX_TRANSFORM_FEEDBACK_SEPARATE_ATTRIBS;
+            break;
+        #endif // /GL_VERSION_3_0
+
+        #ifdef GL_VERSION_3_1
+        case GL_UNIFORM_BUFFER_BINDING:
+        case GL_UNIFORM_BUFFER_SIZE:
+        case GL_UNIFORM_BUFFER_START:
+            *offset = offsetof(MGLRenderState, iMaxUniformBufferBindings);
+            limit = GL_MAX_UNIFORM_BUFFER_BINDINGS;
+            break;
+        #endif // /GL_VERSION_3_1
+
+        #ifdef GL_VERSION_4_3
+        case GL_VERTEX_BINDING_DIVISOR:
+        case GL_VERTEX_BINDING_OFFSET:
+        case GL_VERTEX_BINDING_STRIDE:
+            *offset = offsetof(MGLRenderState, iMaxVertexAttribBindings);
+            limit = GL_MAX_VERTEX_ATTRIB_BINDINGS;
+            break;
+        case GL_SHADER_STORAGE_BUFFER_BINDING:
+        case GL_SHADER_STORAGE_BUFFER_SIZE:
+        case GL_SHADER_STORAGE_BUFFER_START:
+            *offset = offsetof(MGLRenderState, iMaxShaderStorageBufferBindings);
+            limit = GL_MAX_SHADER_STORAGE_BUFFER_BINDINGS;
+            break;
+        #endif // /GL_VERSION_4_3
+
+        default:
+            break;
+    }
+
+    (void)version;
+
+    #undef MGL_VERSION
+
+    return limit;
+}
+
+// Returns the number of elements of the specified indexed field within the implementation limits. Limits are taken from the render state 'rs'
+// if they are present (i.e. non-zero), or queried once per cache otherwise; the number of glGet calls is added to 'num_get_calls'
+static GLuint mglIndexedFieldCount(const MGLFieldDescriptor* field, const MGLRenderState* rs, unsigned version, MGLIndexedLimitsCache* cache, GLuint* num_get_calls)
+{
+    size_t          offset  = MGL_FIELD_NO_OFFSET;
+    const GLenum    limit   = mglIndexedFieldLimit(field->pname, version, &offset);
+    GLint           value   = 0;
+
+    if (limit == 0)
+        return field->count;
+
+    if (rs != NULL && offset != MGL_FIELD_NO_OFFSET)
+        value = *(const GLint*)((const char*)rs + offset);
+
+    if (value <= 0)
+    {
+        size_t i = 0;
+        while (i < cache->count && cache->limits[i] != limit)
+            ++i;
+
+        if (i == cache->count)
+        {
+            GLint queried = 0;
+            glGetIntegerv(limit, &queried);
+            ++(*num_get_calls);
+            if (cache->count < MGL_MAX_INDEXED_LIMITS)
+            {
+                cache->limits[cache->count] = limit;
+                cache->values[cache->count] = queried;
+                ++(cache->count);
+            }
+            value = queried;
+        }
+        else
+            value = cache->values[i];
+    }
+
+    return (GLuint)MGL_MIN((GLuint)MGL_MAX(0, value), field->count);
+}
+
+// Queries the specified field, stores it in the state structure 'base', and returns the number of glGet calls.
+// Indexed fields are only queried up to their implementation limits (see mglIndexedFieldCount), where 'base' must be an MGLRenderState
+static GLuint mglQueryField(const MGLFieldDescriptor* field, void* base, unsigned version, MGLIndexedLimitsCache* cache, const MGLAllocator* allocator)
+{
+    char* val = (char*)base + field->offset;
+
+    if ((field->flags & MGLFieldFlagIndexed) != 0)
+    {
+        GLuint num_get_calls = 0;
+        const GLuint count = mglIndexedFieldCount(field, (const MGLRenderState*)base, version, cache, &num_get_calls);
+        if (field->type == MGLFieldTypeInteger64Array)
+            return num_get_calls + mglGetInteger64StaticArray(field->pname, (GLint64*)val, count, field->count);
+        else
+            return num_get_calls + mglGetIntegerStaticArray(field->pname, (GLint*)val, count, field->count);
+    }
+    else if (field->count_offset != MGL_FIELD_NO_OFFSET)
+    {
+        const GLint count = *(const GLint*)((const char*)base + field->count_offset);
+        mglGetIntegerDynamicArray(field->pname, (GLint*)val, (GLuint)MGL_MAX(0, count), field->count, allocator);
+    }
+    else
+    {
+        switch (field->type)
+        {
+            case MGLFieldTypeBoolean:
+            case MGLFieldTypeBooleanArray:
+                glGetBooleanv(field->pname, (GLboolean*)val);
+                break;
+            case MGLFieldTypeFloat:
+            case MGLFieldTypeFloatArray:
+                glGetFloatv(field->pname, (GLfloat*)val);
+                break;
+            case MGLFieldTypeDouble:
+            case MGLFieldTypeDoubleArray:
+                glGetDoublev(field->pname, (GLdouble*)val);
+                break;
+            #ifdef GL_VERSION_3_2
+            case MGLFieldTypeInteger64:
+            case MGLFieldTypeInteger64Array:
+                glGetInteger64v(field->pname, (GLint64*)val);
+                break;
+            #endif // /GL_VERSION_3_2
+            default:
+                glGetIntegerv(field->pname, (GLint*)val);
+                break;
+        }
+    }
+
+    return 1;
+}
+
+// Adds the specified number of glGet calls, which started at wall time 'start', to the version block of the query statistics 'stats'
+static void mglAddQueryStats(MGLQueryStats* stats, unsigned version, GLuint num_get_calls, double start)
+{
+    MGLQueryStatsVersion* block = &(stats->versions[mglQueryStatsVersionIndex(version)]);
+
+    block->time             += mglQueryStatsTime() - start;
+    block->num_get_calls    += num_get_calls;
+    stats->num_get_calls    += num_get_calls;
+}
+
+// Finishes a query, which started at wall time 'start', for the query statistics 'stats' if non-null
+static void mglFinishQueryStats(MGLQueryStats* stats, double start)
+{
+    if (stats != NULL)
+    {
+        ++(stats->num_queries);
+        stats->time += mglQueryStatsTime() - start;
+    }
+}
+
+// Queries all available fields of the specified categories and stores them in the state structure 'base'. Costs are added to 'stats' if non-null
+static void mglQueryFields(const MGLFieldDescriptor* fields, size_t num_fields, void* base, unsigned version, unsigned categories, MGLQueryStats* stats, const MGLAllocator* allocator)
+{
+    MGLIndexedLimitsCache cache;
+    cache.count = 0;
+
+    // Query dynamic arrays in a second pass, once the fields with their number of elements are known
+    for (int dynamic_pass = 0; dynamic_pass < 2; ++dynamic_pass)
+    {
+        for (size_t i = 0; i < num_fields; ++i)
+        {
+            const MGLFieldDescriptor* field = &(fields[i]);
+
+            if ((field->category & categories) != 0 &&
+                (field->count_offset != MGL_FIELD_NO_OFFSET) == dynamic_pass &&
+                mglIsFieldAvailable(field, version))
+            {
+                if (stats != NULL)
+                {
+                    const double start = mglQueryStatsTime();
+                    mglAddQueryStats(stats, field->version, mglQueryField(field, base, version, &cache, allocator), start);
+                }
+                else
+                    mglQueryField(field, base, version, &cache, allocator);
+            }
+        }
+    }
+}
+
+// Copies all fields of the selected categories from the state structure 'src' into 'dst'
+static void mglCopyFields(const MGLFieldDescriptor* fields, size_t num_fields, void* dst, const void* src, unsigned categories)
+{
+    for (size_t i = 0; i < num_fields; ++i)
+    {
+        const MGLFieldDescriptor* field = &(fields[i]);
+        if ((field->category & categories) != 0)
+            memcpy((char*)dst + field->offset, (const char*)src + field->offset, mglFieldSize(field));
+    }
+}
+
+// Copies all implementation dependent limits into the specified render state
+static void mglCopyImplementationLimits(MGLRenderState* rs, const MGLImplementationLimits* limits)
+{
+    for (size_t i = 0; i < MGL_NUM_RENDER_STATE_FIELDS; ++i)
+    {
+        const MGLFieldDescriptor* field = &(g_MGLRenderStateFields[i]);
+        if (field->limits_offset != MGL_FIELD_NO_OFFSET)
+            memcpy((char*)rs + field->offset, (const char*)limits + field->limits_offset, mglFieldSize(field));
+    }
+}
+
+// Copies all implementation dependent limits from the specified render state
+static void mglStoreImplementationLimits(MGLImplementationLimits* limits, const MGLRenderState* rs)
+{
+    for (size_t i = 0; i < MGL_NUM_RENDER_STATE_FIELDS; ++i)
+    {
+        const MGLFieldDescriptor* field = &(g_MGLRenderStateFields[i]);
+        if (field->limits_offset != MGL_FIELD_NO_OFFSET)
+            memcpy((char*)limits + field->limits_offset, (const char*)rs + field->offset, mglFieldSize(field));
+    }
+}
+
+// Snapshot layout of mglSerializeRenderState and mglSerializeBindingPoints, all values in little-endian byte order:
+//  Header: "MGLS", u16 format version, u16 snapshot kind, u16 major version, u16 minor version, u32 number of records, u32 snapshot size
+//  Record: u32 pname, u16 field type (MGLFieldType), u16 number of elements, element data padded to a multiple of 4 bytes
+enum MGLSnapshotKind
+{
+    MGLSnapshotKindRenderState      = 1,
+    MGLSnapshotKindBindingPoints    = 2,
+};
+
+// Returns non-zero if the host uses little-endian byte order
+static int mglIsLittleEndian(void)
+{
+    const GLuint value = 1;
+    return (*(const unsigned char*)&value == 1);
+}
+
+// Writes the lower 'size' bytes of the specified value in little-endian byte order
+static void mglWriteLittleEndian(unsigned char* dst, unsigned long long value, size_t size)
+{
+    for (size_t i = 0; i < size; ++i)
+        dst[i] = (unsigned char)(value >> (i * 8));
+}
+
+// Reads an unsigned integer of 'size' bytes in little-endian byte order
+static unsigned long long mglReadLittleEndian(const unsigned char* src, size_t size)
+{
+    unsigned long long value = 0;
+
+    for (size_t i = 0; i < size; ++i)
+        value |= ((unsigned long long)src[i] << (i * 8));
+
+    return value;
+}
+
+// Copies 'count' elements of 'elem_size' bytes each between host and little-endian byte order
+static void mglCopyLittleEndian(void* dst, const void* src, size_t elem_size, size_t count)
+{
+    if (elem_size == 1 || mglIsLittleEndian())
+        memcpy(dst, src, elem_size * count);
+    else
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            for (size_t j = 0; j < elem_size; ++j)
+                ((unsigned char*)dst)[i * elem_size + j] = ((const unsigned char*)src)[i * elem_size + (elem_size - 1 - j)];
+        }
+    }
+}
+
+// Returns non-zero if the specified field is stored in snapshots of the specified version; version 0 stores all fields
+static int mglIsFieldSerialized(const MGLFieldDescriptor* field, unsigned version)
+{
+    return (field->pname != 0 && (version == 0 || version >= field->version));
+}
+
+// Returns the number of elements of the specified field in the state structure 'base' that are stored in a snapshot.
+// Trailing zero elements of arrays are omitted, since all fields are zero-initialized when a snapshot is read
+static size_t mglSnapshotFieldCount(const MGLFieldDescriptor* field, const void* base)
+{
+    const size_t elem_size  = mglFieldElementSize(field->type);
+    const size_t capacity   = mglFieldSize(field) / elem_size;
+    const char*  val        = (const char*)base + field->offset;
+    size_t       count      = capacity;
+
+    if (capacity == 1)
+        return 1;
+
+    if (field->count_offset != MGL_FIELD_NO_OFFSET)
+    {
+        const GLint num = *(const GLint*)((const char*)base + field->count_offset);
+        count = (num > 0 ? MGL_MIN((size_t)num, capacity) : 0);
+    }
+
+    while (count > 0)
+    {
+        const char* elem = val + (count - 1) * elem_size;
+        size_t j = 0;
+
+        while (j < elem_size && elem[j] == 0)
+            ++j;
+
+        if (j < elem_size)
+            break;
+
+        --count;
+    }
+
+    return count;
+}
+
+// Returns the size (in bytes) of a snapshot record with 'count' elements of the specified field type
+static size_t mglSnapshotRecordSize(unsigned type, size_t count)
+{
+    return MGL_SNAPSHOT_RECORD_SIZE + ((mglFieldElementSize(type) * count + 3) & ~(size_t)3);
+}
+
+// Writes a snapshot of all fields of the state structure 'base' into 'data' if it fits into 'size' bytes, and returns the size of the snapshot
+static size_t mglSerializeFields(const MGLFieldDescriptor* fields, size_t num_fields, const void* base, unsigned kind, GLint major, GLint minor, void* data, size_t size)
+{
+    #define MGL_VERSION(MAJOR, MINOR)       (((MAJOR) << 16) | (MINOR))
+
+    const unsigned version = MGL_VERSION((unsigned)major, (unsigned)minor);
+
+    #undef MGL_VERSION
+
+    // Determine snapshot size first
+    size_t snapshot_size = MGL_SNAPSHOT_HEADER_SIZE, num_records = 0;
+
+    for (size_t i = 0; i < num_fields; ++i)
+    {
+        if (mglIsFieldSerialized(&(fields[i]), version))
+        {
+            snapshot_size += mglSnapshotRecordSize(fields[i].type, mglSnapshotFieldCount(&(fields[i]), base));
+            ++num_records;
+        }
+    }
+
+    if (data == NULL || size < snapshot_size)
+        return snapshot_size;
+
+    // Write snapshot header
+    unsigned char* dst = (unsigned char*)data;
+
+    memcpy(dst, "MGLS", 4);
+    mglWriteLittleEndian(dst +  4, MGL_SNAPSHOT_FORMAT_VERSION, 2);
+    mglWriteLittleEndian(dst +  6, kind, 2);
+    mglWriteLittleEndian(dst +  8, (unsigned)major, 2);
+    mglWriteLittleEndian(dst + 10, (unsigned)minor, 2);
+    mglWriteLittleEndian(dst + 12, num_records, 4);
+    mglWriteLittleEndian(dst + 16, snapshot_size, 4);
+    dst += MGL_SNAPSHOT_HEADER_SIZE;
+
+    // Write one record per field
+    for (size_t i = 0; i < num_fields; ++i)
+    {
+        const MGLFieldDescriptor* field = &(fields[i]);
+        if (mglIsFieldSerialized(field, version))
+        {
+            const size_t count          = mglSnapshotFieldCount(field, base);
+            const size_t elem_size      = mglFieldElementSize(field->type);
+            const size_t record_size    = mglSnapshotRecordSize(field->type, count);
+
+            mglWriteLittleEndian(dst, field->pname, 4);
+            mglWriteLittleEndian(dst + 4, field->type, 2);
+            mglWriteLittleEndian(dst + 6, count, 2);
+            mglCopyLittleEndian(dst + MGL_SNAPSHOT_RECORD_SIZE, (const char*)base + field->offset, elem_size, count);
+            memset(dst + MGL_SNAPSHOT_RECORD_SIZE + elem_size * count, 0, record_size - MGL_SNAPSHOT_RECORD_SIZE - elem_size * count);
+            dst += record_size;
+        }
+    }
+
+    return snapshot_size;
+}
+
+// Returns the index of the next field with the specified pname, starting the search at 'start', or 'num_fields' if there is no such field.
+// Records are written in table order, so fields that share the same pname (e.g. GL_MAX_VARYING_FLOATS and GL_MAX_VARYING_COMPONENTS) are matched in order
+static size_t mglFindSnapshotField(const MGLFieldDescriptor* fields, size_t num_fields, size_t start, GLenum pname)
+{
+    for (size_t i = 0; i < num_fields; ++i)
+    {
+        const size_t index = (start + i) % num_fields;
+        if (fields[index].pname == pname)
+            return index;
+    }
+    return num_fields;
+}
+
+// Reads a snapshot into the state structure 'base' and returns the size of the snapshot, or 0 if the snapshot is invalid.
+// Unknown records and records with a different field type are skipped, so snapshots remain readable if the fields change between library versions
+static size_t mglDeserializeFields(const MGLFieldDescriptor* fields, size_t num_fields, void* base, size_t base_size, unsigned kind, GLint* major, GLint* minor, const void* data, size_t size)
+{
+    const unsigned char* src = (const unsigned char*)data;
+
+    // Validate snapshot header
+    if (src == NULL || size < MGL_SNAPSHOT_HEADER_SIZE || memcmp(src, "MGLS", 4) != 0)
+        return 0;
+    if (mglReadLittleEndian(src + 4, 2) != MGL_SNAPSHOT_FORMAT_VERSION || mglReadLittleEndian(src + 6, 2) != kind)
+        return 0;
+
+    const size_t num_records    = (size_t)mglReadLittleEndian(src + 12, 4);
+    const size_t snapshot_size  = (size_t)mglReadLittleEndian(src + 16, 4);
+
+    if (snapshot_size < MGL_SNAPSHOT_HEADER_SIZE || snapshot_size > size)
+        return 0;
+
+    // Validate all records in the first pass, and only modify the state structure in the second pass
+    for (int read_pass = 0; read_pass < 2; ++read_pass)
+    {
+        size_t pos = MGL_SNAPSHOT_HEADER_SIZE, next_field = 0;
+
+        if (read_pass)
+        {
+            memset(base, 0, base_size);
+            *major = (GLint)mglReadLittleEndian(src +  8, 2);
+            *minor = (GLint)mglReadLittleEndian(src + 10, 2);
+        }
+
+        for (size_t i = 0; i < num_records; ++i)
+        {
+            if (snapshot_size - pos < MGL_SNAPSHOT_RECORD_SIZE)
+                return 0;
+
+            const GLenum    pname       = (GLenum)mglReadLittleEndian(src + pos, 4);
+            const unsigned  type        = (unsigned)mglReadLittleEndian(src + pos + 4, 2);
+            const size_t    count       = (size_t)mglReadLittleEndian(src + pos + 6, 2);
+            const size_t    record_size = mglSnapshotRecordSize(type, count);
+
+            if (snapshot_size - pos < record_size)
+                return 0;
+
+            if (read_pass)
+            {
+                const size_t index = mglFindSnapshotField(fields, num_fields, next_field, pname);
+                if (index < num_fields && fields[index].type == type)
+                {
+                    const MGLFieldDescriptor* field = &(fields[index]);
+                    const size_t elem_size = mglFieldElementSize(type);
+                    mglCopyLittleEndian((char*)base + field->offset, src + pos + MGL_SNAPSHOT_RECORD_SIZE, elem_size, MGL_MIN(count, mglFieldSize(field) / elem_size));
+                    next_field = index + 1;
+                }
+            }
+
+            pos += record_size;
+        }
+    }
+
+    return snapshot_size;
+}
+
+// Initializes the hash state with the specified seed
+static void mglHashInit(MGLHashState* hash, GLuint seed)
+{
+    for (size_t i = 0; i < MGL_HASH_LANES; ++i)
+        hash->lanes[i] = seed + (GLuint)i * 0x9E3779B1u;
+    hash->count = 0;
+}
+
+// Mixes a single word into a hash lane
+static GLuint mglHashRound(GLuint lane, GLuint word)
+{
+    lane += word * 0x85EBCA77u;
+    lane = (lane << 13) | (lane >> 19);
+    return lane * 0x9E3779B1u;
+}
+
+// Mixes the specified words into the hash state; the result only depends on the sequence of words, not on how it is split into calls
+static void mglHashUpdate(MGLHashState* hash, const GLuint* words, size_t num_words)
+{
+    size_t i = 0;
+
+    // Fill up the lanes until the next full block
+    for (; i < num_words && (hash->count % MGL_HASH_LANES) != 0; ++i, ++(hash->count))
+        hash->lanes[hash->count % MGL_HASH_LANES] = mglHashRound(hash->lanes[hash->count % MGL_HASH_LANES], words[i]);
+
+    // Process full blocks with all lanes at once
+    for (; i + MGL_HASH_LANES <= num_words; i += MGL_HASH_LANES, hash->count += MGL_HASH_LANES)
+    {
+        for (size_t j = 0; j < MGL_HASH_LANES; ++j)
+            hash->lanes[j] = mglHashRound(hash->lanes[j], words[i + j]);
+    }
+
+    // Process remaining words
+    for (; i < num_words; ++i, ++(hash->count))
+        hash->lanes[hash->count % MGL_HASH_LANES] = mglHashRound(hash->lanes[hash->count % MGL_HASH_LANES], words[i]);
+}
+
+// Combines all lanes of the hash state into the final 64-bit hash
+static unsigned long long mglHashFinal(const MGLHashState* hash)
+{
+    unsigned long long h = (unsigned long long)hash->count * 0x9E3779B97F4A7C15ull;
+
+    for (size_t i = 0; i < MGL_HASH_LANES; ++i)
+    {
+        h = (h ^ hash->lanes[i]) * 0x100000001B3ull;
+        h ^= (h >> 29);
+    }
+
+    h ^= (h >> 33);
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= (h >> 33);
+    h *= 0xC4CEB9FE1A85EC53ull;
+    h ^= (h >> 33);
+
+    return h;
+}
+
+// Returns non-zero if the packed render states 'lhs' and 'rhs' are identical except for GL_TIMESTAMP
+static int mglIsSamePackedRenderState(const MGLPackedRenderState* lhs, const MGLPackedRenderState* rhs)
+{
+    return
+    (
+        lhs->iMajorVersion == rhs->iMajorVersion &&
+        lhs->iMinorVersion == rhs->iMinorVersion &&
+        memcmp(lhs->flags, rhs->flags, sizeof(lhs->flags)) == 0 &&
+        memcmp(lhs->hot, rhs->hot, sizeof(lhs->hot)) == 0 &&
+        memcmp(lhs->cold, rhs->cold, sizeof(lhs->cold) - MGL_PACKED_TIMESTAMP_WORDS * sizeof(GLuint)) == 0
+    );
+}
+
+// Returns the entry of the state store with the specified ID, or null if the ID is invalid
+static MGLStateStoreEntry* mglStateStoreEntry(const MGLStateStoreInternal* store, GLuint id)
+{
+    if (id == 0 || id > store->num_entries || store->entries[id - 1].ref_count == 0)
+        return NULL;
+    return &(store->entries[id - 1]);
+}
+
+// Inserts the specified ID into the hash table of the state store
+static void mglStateStoreInsert(MGLStateStoreInternal* store, GLuint id)
+{
+    const size_t mask = store->table_size - 1;
+    size_t slot = (size_t)store->entries[id - 1].hash & mask;
+
+    while (store->table[slot] != 0)
+        slot = (slot + 1) & mask;
+
+    store->table[slot] = id;
+}
+
+// Removes the specified ID from the hash table of the state store by shifting back all subsequent IDs of the same probe sequence
+static void mglStateStoreRemove(MGLStateStoreInternal* store, GLuint id)
+{
+    const size_t mask = store->table_size - 1;
+    size_t slot = (size_t)store->entries[id - 1].hash & mask;
+
+    while (store->table[slot] != id)
+        slot = (slot + 1) & mask;
+
+    for (size_t next = (slot + 1) & mask; store->table[next] != 0; next = (next + 1) & mask)
+    {
+        // Move the next ID into the empty slot unless its ideal slot lies cyclically within (slot, next]
+        const size_t ideal = (size_t)store->entries[store->table[next] - 1].hash & mask;
+        if (((next - ideal) & mask) >= ((next - slot) & mask))
+        {
+            store->table[slot] = store->table[next];
+            slot = next;
+        }
+    }
+
+    store->table[slot] = 0;
+}
+
+// Allocates the entries and the hash table of the state store for the specified capacity, and keeps all existing entries.
+// Returns zero and leaves the state store unchanged if the allocation fails
+static int mglStateStoreReserve(MGLStateStoreInternal* store, size_t capacity)
+{
+    size_t table_size = 16;
+    while (table_size < capacity * 2)
+        table_size *= 2;
+
+    // Allocate both blocks before releasing the previous ones
+    MGLStateStoreEntry* entries = (MGLStateStoreEntry*)mglAlloc(NULL, sizeof(MGLStateStoreEntry) * capacity);
+    GLuint*             table   = (GLuint*)mglAlloc(NULL, sizeof(GLuint) * table_size);
+
+    if (entries == NULL || table == NULL)
+    {
+        mglFree(NULL, entries, sizeof(MGLStateStoreEntry) * capacity);
+        mglFree(NULL, table, sizeof(GLuint) * table_size);
+        return 0;
+    }
+
+    if (store->entries != NULL)
+    {
+        memcpy(entries, store->entries, sizeof(MGLStateStoreEntry) * store->num_entries);
+        mglFree(NULL, store->entries, sizeof(MGLStateStoreEntry) * store->capacity);
+    }
+    store->entries  = entries;
+    store->capacity = capacity;
+
+    // Rebuild hash table with all referenced entries
+    mglFree(NULL, store->table, sizeof(GLuint) * store->table_size);
+
+    store->table        = table;
+    store->table_size   = table_size;
+
+    for (size_t i = 0; i < store->num_entries; ++i)
+    {
+        if (store->entries[i].ref_count > 0)
+            mglStateStoreInsert(store, (GLuint)(i + 1));
+    }
+
+    return 1;
+}
+
+// Determines the first and last changed element of the specified field between 'lhs' and 'rhs', and returns the number of elements in this range, or 0 if the field is unchanged
+static size_t mglChangedElementRange(const MGLFieldDescriptor* field, const void* lhs, const void* rhs, size_t* first_elem)
+{
+    const size_t elem_size  = mglFieldElementSize(field->type);
+    const size_t capacity   = mglFieldSize(field) / elem_size;
+    const char*  lhs_val    = (const char*)lhs + field->offset;
+    const char*  rhs_val    = (const char*)rhs + field->offset;
+    size_t       begin      = 0;
+    size_t       end        = capacity;
+
+    while (begin < end && memcmp(lhs_val + begin * elem_size, rhs_val + begin * elem_size, elem_size) == 0)
+        ++begin;
+    while (end > begin && memcmp(lhs_val + (end - 1) * elem_size, rhs_val + (end - 1) * elem_size, elem_size) == 0)
+        --end;
+
+    *first_elem = begin;
+    return (end - begin);
+}
+
+// Returns the size (in bytes) of the capture entry that stores all changes from 'prev' to 'next'
+static size_t mglCaptureEntrySize(const MGLRenderState* prev, const MGLRenderState* next)
+{
+    size_t entry_size = MGL_CAPTURE_ENTRY_SIZE, first_elem = 0;
+
+    for (size_t i = 0; i < MGL_NUM_RENDER_STATE_FIELDS; ++i)
+    {
+        const size_t count = mglChangedElementRange(&(g_MGLRenderStateFields[i]), prev, next, &first_elem);
+        if (count > 0)
+            entry_size += MGL_CAPTURE_RECORD_SIZE + mglFieldElementSize(g_MGLRenderStateFields[i].type) * count;
+    }
+
+    return entry_size;
+}
+
+// Writes the capture entry that stores all changes from 'prev' to 'next' into 'dst'
+static void mglWriteCaptureEntry(unsigned char* dst, size_t entry_size, const MGLRenderState* prev, const MGLRenderState* next)
+{
+    size_t first_elem = 0;
+
+    mglWriteLittleEndian(dst, entry_size, 4);
+    dst += MGL_CAPTURE_ENTRY_SIZE;
+
+    for (size_t i = 0; i < MGL_NUM_RENDER_STATE_FIELDS; ++i)
+    {
+        const MGLFieldDescriptor* field = &(g_MGLRenderStateFields[i]);
+        const size_t count = mglChangedElementRange(field, prev, next, &first_elem);
+        if (count > 0)
+        {
+            const size_t elem_size = mglFieldElementSize(field->type);
+            mglWriteLittleEndian(dst, i, 2);
+            mglWriteLittleEndian(dst + 2, first_elem, 2);
+            mglWriteLittleEndian(dst + 4, count, 2);
+            memcpy(dst + MGL_CAPTURE_RECORD_SIZE, (const char*)next + field->offset + first_elem * elem_size, elem_size * count);
+            dst += MGL_CAPTURE_RECORD_SIZE + elem_size * count;
+        }
+    }
+}
+
+// Applies all changes of the capture entry 'src' to the render state 'rs'
+static void mglApplyCaptureEntry(MGLRenderState* rs, const unsigned char* src)
+{
+    const unsigned char* end = src + mglReadLittleEndian(src, 4);
+
+    for (src += MGL_CAPTURE_ENTRY_SIZE; src < end;)
+    {
+        const MGLFieldDescriptor* field = &(g_MGLRenderStateFields[mglReadLittleEndian(src, 2)]);
+        const size_t elem_size  = mglFieldElementSize(field->type);
+        const size_t first_elem = (size_t)mglReadLittleEndian(src + 2, 2);
+        const size_t count      = (size_t)mglReadLittleEndian(src + 4, 2);
+        memcpy((char*)rs + field->offset + first_elem * elem_size, src + MGL_CAPTURE_RECORD_SIZE, elem_size * count);
+        src += MGL_CAPTURE_RECORD_SIZE + elem_size * count;
+    }
+}
+
+// Returns the byte offset of the capture entry at 'offset', resolving the wrap-around to the beginning of the ring buffer
+static size_t mglCaptureEntryOffset(const MGLCaptureInternal* capture, size_t offset)
+{
+    if (capture->capacity - offset < MGL_CAPTURE_ENTRY_SIZE || mglReadLittleEndian(capture->ring + offset, 4) == 0)
+        return 0;
+    return offset;
+}
+
+// Returns the byte offset of the capture entry following the entry at 'offset'
+static size_t mglNextCaptureEntryOffset(const MGLCaptureInternal* capture, size_t offset)
+{
+    return mglCaptureEntryOffset(capture, offset + (size_t)mglReadLittleEndian(capture->ring + offset, 4));
+}
+
+// Discards the oldest capture entry and moves the base render state forward to the next entry
+static void mglEvictCaptureEntry(MGLCaptureInternal* capture)
+{
+    --(capture->count);
+    ++(capture->first);
+
+    if (capture->count > 0)
+    {
+        capture->head = mglNextCaptureEntryOffset(capture, capture->head);
+        mglApplyCaptureEntry(&(capture->base), capture->ring + capture->head);
+    }
+    else
+        capture->head = capture->tail = 0;
+
+    if (capture->cursor < capture->first)
+        capture->cursor = MGL_STRING_NPOS;
+}
+
+// Reserves 'entry_size' contiguous bytes in the ring buffer by discarding the oldest entries, and returns the byte offset of the reserved space.
+// The entry size must not exceed the capacity of the ring buffer
+static size_t mglReserveCaptureEntry(MGLCaptureInternal* capture, size_t entry_size)
+{
+    for (;;)
+    {
+        if (capture->count == 0)
+            return 0;
+
+        if (capture->tail > capture->head)
+        {
+            // Used space is contiguous: append at the end or wrap around if there is enough space before the oldest entry
+            if (capture->capacity - capture->tail >= entry_size)
+                return capture->tail;
+            if (capture->head >= entry_size)
+            {
+                if (capture->capacity - capture->tail >= MGL_CAPTURE_ENTRY_SIZE)
+                    mglWriteLittleEndian(capture->ring + capture->tail, 0, 4);
+                return 0;
+            }
+        }
+        else if (capture->head - capture->tail >= entry_size)
+        {
+            // Used space wraps around: insert between the newest and the oldest entry
+            return capture->tail;
+        }
+
+        mglEvictCaptureEntry(capture);
+    }
+}
+
+#ifdef MENTAL_GL_PRINT_QUEUE
+
+#ifdef _WIN32
+
+static void mglMutexInit(MGLMutex* mutex)                           { InitializeCriticalSection(mutex); }
+static void mglMutexFree(MGLMutex* mutex)                           { DeleteCriticalSection(mutex); }
+static void mglMutexLock(MGLMutex* mutex)                           { EnterCriticalSection(mutex); }
+static void mglMutexUnlock(MGLMutex* mutex)                         { LeaveCriticalSection(mutex); }
+static void mglConditionInit(MGLCondition* cond)                    { InitializeConditionVariable(cond); }
+static void mglConditionFree(MGLCondition* cond)                    { (void)cond; }
+static void mglConditionWait(MGLCondition* cond, MGLMutex* mutex)   { SleepConditionVariableCS(cond, mutex, INFINITE); }
+static void mglConditionSignal(MGLCondition* cond)                  { WakeAllConditionVariable(cond); }
+
+#else
+
+static void mglMutexInit(MGLMutex* mutex)                           { pthread_mutex_init(mutex, NULL); }
+static void mglMutexFree(MGLMutex* mutex)                           { pthread_mutex_destroy(mutex); }
+static void mglMutexLock(MGLMutex* mutex)                           { pthread_mutex_lock(mutex); }
+static void mglMutexUnlock(MGLMutex* mutex)                         { pthread_mutex_unlock(mutex); }
+static void mglConditionInit(MGLCondition* cond)                    { pthread_cond_init(cond, NULL); }
+static void mglConditionFree(MGLCondition* cond)                    { pthread_cond_destroy(cond); }
+static void mglConditionWait(MGLCondition* cond, MGLMutex* mutex)   { pthread_cond_wait(cond, mutex); }
+static void mglConditionSignal(MGLCondition* cond)                  { pthread_cond_broadcast(cond); }
+
+#endif // /_WIN32
+
+// Prints all queued states until the print queue is stopped and empty
+static void mglRunPrintQueue(MGLPrintQueueInternal* queue)
+{
+    mglMutexLock(&(queue->mutex));
+
+    for (;;)
+    {
+        while (queue->count == 0 && !queue->quit)
+            mglConditionWait(&(queue->queued), &(queue->mutex));
+
+        if (queue->count == 0)
+            break;
+
+        // Print the oldest slot without holding the lock
+        const MGLPrintQueueSlot* slot = &(queue->slots[queue->head]);
+
+        mglMutexUnlock(&(queue->mutex));
+
+        if (slot->is_render_state)
+            mglPrintRenderStateTo(&(slot->data.render_state), &(queue->formatting), queue->proc, queue->user);
+        else
+            mglPrintBindingPointsTo(&(slot->data.binding_points), &(queue->formatting), queue->proc, queue->user);
+
+        mglMutexLock(&(queue->mutex));
+
+        queue->head = (queue->head + 1) % queue->capacity;
+        --(queue->count);
+        mglConditionSignal(&(queue->printed));
+    }
+
+    mglMutexUnlock(&(queue->mutex));
+}
+
+#ifdef _WIN32
+static DWORD WINAPI mglPrintQueueThreadProc(LPVOID queue)
+{
+    mglRunPrintQueue((MGLPrintQueueInternal*)queue);
+    return 0;
+}
+#else
+static void* mglPrintQueueThreadProc(void* queue)
+{
+    mglRunPrintQueue((MGLPrintQueueInternal*)queue);
+    return NULL;
+}
+#endif // /_WIN32
+
+// Returns the next free slot of the print queue and locks the queue, or returns null without lock if the queue is full
+static MGLPrintQueueSlot* mglAcquirePrintQueueSlot(MGLPrintQueueInternal* queue)
+{
+    mglMutexLock(&(queue->mutex));
+
+    if (queue->count == queue->capacity)
+    {
+        mglMutexUnlock(&(queue->mutex));
+        return NULL;
+    }
+
+    return &(queue->slots[(queue->head + queue->count) % queue->capacity]);
+}
+
+// Appends the previously acquired slot to the print queue and unlocks the queue
+static void mglSubmitPrintQueueSlot(MGLPrintQueueInternal* queue)
+{
+    ++(queue->count);
+    mglConditionSignal(&(queue->queued));
+    mglMutexUnlock(&(queue->mutex));
+}
+
+#endif // /MENTAL_GL_PRINT_QUEUE
+
+
+// *****************************************************************
+//      PUBLIC FUNCTION IMPLEMENTATIONS
+// *****************************************************************
+
+// Queries all implementation dependent limits and stores them in 'limits'. Costs are added to 'stats' if non-null
+static void mglQueryImplementationLimitsWithStats(MGLImplementationLimits* limits, MGLQueryStats* stats)
+{
+    #define MGL_VERSION(MAJOR, MINOR)       (((MAJOR) << 16) | (MINOR))
+
+    MGLRenderState rs;
+    memset(&rs, 0, sizeof(MGLRenderState));
+
+    // Query context version first to determine which limits are available
+    glGetIntegerv(GL_MAJOR_VERSION, &(rs.iMajorVersion));
+    glGetIntegerv(GL_MINOR_VERSION, &(rs.iMinorVersion));
+
+    if (stats != NULL)
+        stats->num_get_calls += 2;
+
+    // Query all implementation dependent limits
+    mglQueryFields(g_MGLRenderStateFields, MGL_NUM_RENDER_STATE_FIELDS, &rs, MGL_VERSION(rs.iMajorVersion, rs.iMinorVersion), MGLStateCategoryLimits, stats, NULL);
+
+    memset(limits, 0, sizeof(MGLImplementationLimits));
+    mglStoreImplementationLimits(limits, &rs);
+
+    #undef MGL_VERSION
+}
+
+void mglQueryImplementationLimits(MGLImplementationLimits* limits)
+{
+    mglQueryImplementationLimitsWithStats(limits, NULL);
+}
+
+void mglQueryRenderStateEx(MGLRenderState* rs, const MGLQueryOptions* options)
+{
+    #define MGL_VERSION(MAJOR, MINOR)       (((MAJOR) << 16) | (MINOR))
+
+    MGLImplementationLimits queried_limits;
+
+    // Get query options
+    const unsigned                  categories  = (options != NULL && options->categories != 0 ? options->categories : (unsigned)MGLStateCategoryAll);
+    const MGLImplementationLimits*  limits      = (options != NULL ? options->limits : NULL);
+    MGLQueryStats*                  stats       = (options != NULL ? options->stats : NULL);
+    const MGLAllocator*             allocator   = (options != NULL ? options->allocator : NULL);
+    const double                    start       = (stats != NULL ? mglQueryStatsTime() : 0.0);
+
+    if (options != NULL && options->shadow != NULL)
+    {
+        // Take the states of the selected categories from the shadow copy without querying the GL
+        const MGLShadowState* shadow = options->shadow;
+
+        memset(rs, 0, sizeof(MGLRenderState));
+
+        if (limits == NULL && (categories & MGLStateCategoryLimits) != 0)
+            limits = &(shadow->limits);
+
+        if (limits != NULL)
+            mglCopyImplementationLimits(rs, limits);
+        else
+        {
+            rs->iMajorVersion = shadow->render_state.iMajorVersion;
+            rs->iMinorVersion = shadow->render_state.iMinorVersion;
+        }
+
+        mglCopyFields(g_MGLRenderStateFields, MGL_NUM_RENDER_STATE_FIELDS, rs, &(shadow->render_state), categories & ~MGLStateCategoryLimits);
+
+        mglFinishQueryStats(stats, start);
+        return;
+    }
+
+    // Query all OpenGL states
+    memset(rs, 0, sizeof(MGLRenderState));
+
+    if (limits == NULL && (categories & MGLStateCategoryLimits) != 0)
+    {
+        // Query limits on demand if no cached limits are specified
+        mglQueryImplementationLimitsWithStats(&queried_limits, stats);
+        limits = &queried_limits;
+    }
+
+    if (limits != NULL)
+    {
+        // Take context version and all other limits from the cached values
+        mglCopyImplementationLimits(rs, limits);
+    }
+    else
+    {
+        // Only query context version, all other limits remain zero
+        glGetIntegerv(GL_MAJOR_VERSION, &(rs->iMajorVersion));
+        glGetIntegerv(GL_MINOR_VERSION, &(rs->iMinorVersion));
+        if (stats != NULL)
+            stats->num_get_calls += 2;
+    }
+
+    // Query all remaining states of the selected categories
+    mglQueryFields(g_MGLRenderStateFields, MGL_NUM_RENDER_STATE_FIELDS, rs, MGL_VERSION(rs->iMajorVersion, rs->iMinorVersion), categories & ~MGLStateCategoryLimits, stats, allocator);
+
+    mglFinishQueryStats(stats, start);
+
+    #undef MGL_VERSION
+}
+
+void mglQueryRenderStateWithLimits(MGLRenderState* rs, const MGLImplementationLimits* limits)
+{
+    MGLQueryOptions options = { (MGLStateCategoryAll & ~MGLStateCategoryLimits), limits, NULL, NULL, NULL };
+    mglQueryRenderStateEx(rs, &options);
+}
+
+void mglQueryRenderState(MGLRenderState* rs)
+{
+    mglQueryRenderStateEx(rs, NULL);
+}
+
+void mglQueryBindingPoints(MGLBindingPoints* bp)
+{
+    mglQueryBindingPointsEx(bp, NULL);
+}
+
+void mglQueryBindingPointsEx(MGLBindingPoints* bp, const MGLBindingPointsQueryOptions* options)
+{
+    #define MGL_VERSION(MAJOR, MINOR)       (((MAJOR) << 16) | (MINOR))
+
+    memset(bp, 0, sizeof(MGLBindingPoints));
+
+    // Get query options
+    const unsigned  targets = (options != NULL && options->targets != 0 ? options->targets : (unsigned)MGLTextureTargetAll);
+    const GLuint    units   = (options != NULL && options->units != 0 ? options->units : ~0u);
+    MGLQueryStats*  stats   = (options != NULL ? options->stats : NULL);
+    const double    start   = (stats != NULL ? mglQueryStatsTime() : 0.0);
+
+    GLint iMajorVersion = 0, iMinorVersion = 0;
+    glGetIntegerv(GL_MAJOR_VERSION, &iMajorVersion);
+    glGetIntegerv(GL_MINOR_VERSION, &iMinorVersion);
+
+    if (stats != NULL)
+        stats->num_get_calls += 2;
+
+    const unsigned version = MGL_VERSION(iMajorVersion, iMinorVersion);
+
+    // Only query first layer for texture types supported up to GL 1.2
+    GLint num_layers = 1, iPrevActiveTexture = GL_TEXTURE0;
+
+    #ifdef GL_VERSION_1_3
+    if (MGL_IS_VERSION_SUPPORTED(version, MGL_VERSION(1, 3)))
+        num_layers = MGL_MAX_TEXTURE_LAYERS;
+    #endif // /GL_VERSION_1_3
+
+    #ifdef GL_VERSION_2_0
+    if (MGL_IS_VERSION_SUPPORTED(version, MGL_VERSION(2, 0)))
+    {
+        // Don't query texture units beyond the actual number of units
+        GLint max_units = 0;
+        glGetIntegerv(GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS, &max_units);
+        num_layers = MGL_MAX(1, MGL_MIN(num_layers, max_units));
+        if (stats != NULL)
+            ++(stats->num_get_calls);
+    }
+    #endif // /GL_VERSION_2_0
+
+    #if defined MENTAL_GL_INDEXED_TEXTURE_BINDINGS && defined GL_VERSION_4_5
+    if (MGL_IS_VERSION_SUPPORTED(version, MGL_VERSION(4, 5)))
+    {
+        // Query texture types of all selected layers without changing the active texture unit
+        for (GLint layer = 0; layer < num_layers; ++layer)
+        {
+            if ((units & (1u << layer)) == 0)
+                continue;
+
+            for (size_t i = 0; i < MGL_NUM_BINDING_POINTS_FIELDS; ++i)
+            {
+                const MGLFieldDescriptor* field = &(g_MGLBindingPointsFields[i]);
+                if ((targets & (1u << i)) != 0 && mglIsFieldAvailable(field, version))
+                {
+                    const double field_start = (stats != NULL ? mglQueryStatsTime() : 0.0);
+                    glGetIntegeri_v(field->pname, (GLuint)layer, (GLint*)((char*)bp + field->offset) + layer);
+                    if (stats != NULL)
+                        mglAddQueryStats(stats, field->version, 1, field_start);
+                }
+            }
+        }
+        mglFinishQueryStats(stats, start);
+        return;
+    }
+    #endif // /MENTAL_GL_INDEXED_TEXTURE_BINDINGS && GL_VERSION_4_5
+
+    #ifdef GL_VERSION_1_3
+    if (num_layers > 1)
+    {
+        // Store current active texture layer
+        glGetIntegerv(GL_ACTIVE_TEXTURE, &iPrevActiveTexture);
+        if (stats != NULL)
+            ++(stats->num_get_calls);
+    }
+    #endif // /GL_VERSION_1_3
+
+    GLint iActiveTexture = iPrevActiveTexture;
+
+    // Query texture types for all selected layers [GL_TEXTURE0 .. GL_TEXTURE31]
+    for (GLint layer = 0; layer < num_layers; ++layer)
+    {
+        if ((units & (1u << layer)) == 0)
+            continue;
+
+        #ifdef GL_VERSION_1_3
+        if (num_layers > 1 && iActiveTexture != GL_TEXTURE0 + layer)
+        {
+            iActiveTexture = GL_TEXTURE0 + layer;
+            glActiveTexture((GLenum)iActiveTexture);
+            if (stats != NULL)
+                ++(stats->num_active_texture_calls);
+        }
+        #endif // /GL_VERSION_1_3
+
+        for (size_t i = 0; i < MGL_NUM_BINDING_POINTS_FIELDS; ++i)
+        {
+            const MGLFieldDescriptor* field = &(g_MGLBindingPointsFields[i]);
+            if ((targets & (1u << i)) != 0 && mglIsFieldAvailable(field, version))
+            {
+                const double field_start = (stats != NULL ? mglQueryStatsTime() : 0.0);
+                glGetIntegerv(field->pname, (GLint*)((char*)bp + field->offset) + layer);
+                if (stats != NULL)
+                    mglAddQueryStats(stats, field->version, 1, field_start);
+            }
+        }
+    }
+
+    #ifdef GL_VERSION_1_3
+    if (iActiveTexture != iPrevActiveTexture)
+    {
+        // Restore previous active texture layer
+        glActiveTexture((GLenum)iPrevActiveTexture);
+        if (stats != NULL)
+            ++(stats->num_active_texture_calls);
+    }
+    #endif // /GL_VERSION_1_3
+
+    mglFinishQueryStats(stats, start);
+
+    #undef MGL_VERSION
+}
+
+// Internal constant parameters
+static const MGLFormattingOptions g_MGLFormattingDefault = { ' ', 1, 200, MGLFormattingOrderDefault, 1, NULL, 0, NULL, NULL, MGLFormattingOutputText };
+
+// Returns the output string object 'reuse' with persistent string parts, or allocates a new one with 'allocator' if 'reuse' is null.
+// All string buffers of the output string object use the allocator it was created with, which is referenced by 's->str.allocator'.
+// Returns null if a new object cannot be allocated. If the string parts cannot be allocated, 's->parts' remains null
+static MGLOutputStringInternal* mglOutputStringAcquire(MGLString reuse, const MGLAllocator* allocator)
+{
+    MGLOutputStringInternal* s = (MGLOutputStringInternal*)reuse;
+
+    if (s == NULL)
+    {
+        s = (MGLOutputStringInternal*)mglAlloc(allocator, sizeof(MGLOutputStringInternal));
+        if (s == NULL)
+            return NULL;
+        if (allocator != NULL)
+        {
+            s->allocator        = *allocator;
+            s->str.allocator    = &(s->allocator);
+        }
+        mglStringInternalInit(&(s->str), 0);
+        s->parts = NULL;
+    }
+
+    if (s->parts == NULL)
+    {
+        s->parts = (MGLStringInternal*)mglAlloc(s->str.allocator, sizeof(MGLStringInternal) * MGL_MAX_NUM_RENDER_STATES * 2);
+        if (s->parts != NULL)
+        {
+            for (size_t i = 0; i < MGL_MAX_NUM_RENDER_STATES * 2; ++i)
+                s->parts[i].allocator = s->str.allocator;
+        }
+    }
+    else
+    {
+        // Retry allocations that failed in a previous call
+        for (size_t i = 0; i < MGL_MAX_NUM_RENDER_STATES * 2; ++i)
+            s->parts[i].failed = 0;
+    }
+
+    s->str.failed = 0;
+
+    return s;
+}
+
+// Releases the persistent string parts of the specified output string object
+static void mglOutputStringReleaseParts(MGLOutputStringInternal* s)
+{
+    if (s != NULL && s->parts != NULL)
+    {
+        for (size_t i = 0; i < MGL_MAX_NUM_RENDER_STATES * 2; ++i)
+            mglStringInternalFree(&(s->parts[i]));
+        mglFree(s->str.allocator, s->parts, sizeof(MGLStringInternal) * MGL_MAX_NUM_RENDER_STATES * 2);
+        s->parts = NULL;
+    }
+}
+
+// Returns a string pair array that writes into the persistent string parts of the specified output string object.
+// Without string parts, no category is selected, so nothing is written into the array
+static MGLStringPairArray mglOutputStringPairs(MGLOutputStringInternal* s, const MGLFormattingOptions* formatting)
+{
+    MGLStringPairArray out = { NULL, NULL, 0, 0, NULL };
+
+    if (s != NULL && s->parts != NULL)
+    {
+        out.first       = s->parts;
+        out.second      = s->parts + MGL_MAX_NUM_RENDER_STATES;
+        out.categories  = (formatting->categories != 0 ? formatting->categories : (unsigned)MGLStateCategoryAll);
+    }
+
+    return out;
+}
+
+// Returns the length of the longest parameter name, incl. the distance to the values
+static size_t mglMaxParamLength(const MGLStringPairArray* out, const MGLFormattingOptions* formatting)
+{
+    size_t max_par_len = 0;
+
+    for (size_t i = 0; i < out->index; ++i)
+        max_par_len = MGL_MAX(max_par_len, out->first[i].len);
+
+    return max_par_len + formatting->distance;
+}
+
+// Merges all string parts into the output string 's' and keeps the string parts for subsequent calls
+static void mglPrintStringPairs(MGLStringPairArray out, const MGLFormattingOptions* formatting, MGLStringInternal* s)
+{
+    // Determine longest parameter name
+    size_t max_par_len = mglMaxParamLength(&out, formatting);
+
+    // Determine output string capacity
+    size_t out_cap = 0;
+
+    for (size_t i = 0; i < out.index; ++i)
+    {
+        out_cap += out.first[i].len;
+        out_cap += (max_par_len - out.first[i].len);
+        out_cap += out.second[i].len;
+        out_cap += 1;
+    }
+
+    // Clear output string and reserve enough space (incl. NUL char); leave it empty if the allocation fails
+    mglStringInternalClear(s);
+    if (!mglStringInternalReserve(s, out_cap + 1))
+        return;
+
+    // Merge all strings parts to the output string, up to the first part that is incomplete due to a failed allocation
+    for (size_t i = 0; i < out.index; ++i)
+    {
+        if (out.first[i].failed || out.second[i].failed)
+            break;
+        mglAppendStringPair(s, &(out.first[i]), &(out.second[i]), max_par_len, formatting);
+    }
+}
+
+// Writes the number of redundant calls and the total number of calls in the form "R of N" into 's' (incl. NUL char); 's' must provide space for 46 characters
+static void mglFormatRedundancy(char* s, size_t num_redundant, size_t num_calls)
+{
+    s += mglFormatUInt64(s, (unsigned long long)num_redundant);
+    memcpy(s, " of ", 4);
+    mglFormatUInt64(s + 4, (unsigned long long)num_calls);
+}
+
+// Returns the index of the i-th field in the order specified by the formatting options
+static size_t mglFieldOrderIndex(const unsigned short* sorted, size_t i, const MGLFormattingOptions* formatting)
+{
+    return (formatting->order == MGLFormattingOrderSorted ? sorted[i] : i);
+}
+
+// Returns true if the specified field of 'fields' is selected by the categories, the filter, and the compiled filter; evaluated before any value is formatted
+static int mglIsFieldSelected(const MGLFieldDescriptor* fields, size_t index, unsigned categories, const MGLFormattingOptions* formatting)
+{
+    if ((fields[index].category & categories) == 0)
+        return 0;
+    if (formatting->filter != NULL && strstr(fields[index].name, formatting->filter) == NULL)
+        return 0;
+    if (formatting->compiled_filter != NULL)
+    {
+        const GLuint* bits = mglFilterBits((const MGLFilterInternal*)formatting->compiled_filter, fields);
+        if ((bits[index / 32] & (1u << (index % 32))) == 0)
+            return 0;
+    }
+    return 1;
+}
+
+// Returns true if the specified headline is printed; headlines are only printed when no category or compiled filter is specified
+static int mglIsHeadlineSelected(const char* headline, unsigned categories, const MGLFormattingOptions* formatting)
+{
+    return
+    (
+        categories == MGLStateCategoryAll &&
+        formatting->compiled_filter == NULL &&
+        (formatting->filter == NULL || strstr(headline, formatting->filter) != NULL)
+    );
+}
+
+// Writes the headline for the fields of the specified GL version into 'headline'
+static void mglFormatVersionHeadline(char* headline, unsigned field_version)
+{
+    memcpy(headline, "\nGL_VERSION_", 12);
+    headline += 12;
+    headline += mglFormatUInt64(headline, field_version >> 16);
+    *headline++ = '_';
+    mglFormatUInt64(headline, field_version & 0xFFFF);
+}
+
+// Appends all fields of the state structure 'base' to the string pair array, either in table order or in the order of 'sorted'
+// If 'version' is non-zero, the fields are grouped by headlines for their GL version (only in default order) and fields that are unavailable for 'version' are printed as "n/a"
+static void mglNextFields(MGLStringPairArray* out, const MGLFieldDescriptor* fields, const unsigned short* sorted, size_t num_fields, const void* base, unsigned version, const MGLFormattingOptions* formatting)
+{
+    // Internal constant parameters
+    static const char* g_valNA = "n/a";
+
+    unsigned    field_version   = (1u << 16); // GL 1.0
+    char        headline[32];
+
+    for (size_t i = 0; i < num_fields; ++i)
+    {
+        const size_t                index   = mglFieldOrderIndex(sorted, i, formatting);
+        const MGLFieldDescriptor*   field   = &(fields[index]);
+
+        if (version != 0 && formatting->order == MGLFormattingOrderDefault && field->version != field_version)
+        {
+            // Start next group of fields with a headline for their GL version
+            field_version = field->version;
+            mglFormatVersionHeadline(headline, field_version);
+            if (mglIsHeadlineSelected(headline, out->categories, formatting))
+                mglNextHeadline(out, headline);
+        }
+
+        // Skip filtered out fields before their values are formatted
+        if (!mglIsFieldSelected(fields, index, out->categories, formatting))
+            continue;
+
+        if (version != 0 && !mglIsFieldAvailable(field, version))
+            mglNextParamString(out, field->category, field->name, g_valNA);
+        else
+            mglNextParamField(out, field, base, formatting);
+    }
+}
+
+// Returns the length of the longest parameter name mglNextFields would produce for the specified fields, incl. the distance to the values
+static size_t mglMaxFieldNameLength(const MGLFieldDescriptor* fields, size_t num_fields, unsigned version, unsigned categories, const MGLFormattingOptions* formatting)
+{
+    size_t      max_par_len     = 0;
+    unsigned    field_version   = (1u << 16); // GL 1.0
+    char        headline[32];
+
+    for (size_t i = 0; i < num_fields; ++i)
+    {
+        if (version != 0 && formatting->order == MGLFormattingOrderDefault && fields[i].version != field_version)
+        {
+            field_version = fields[i].version;
+            mglFormatVersionHeadline(headline, field_version);
+            if (mglIsHeadlineSelected(headline, categories, formatting))
+                max_par_len = MGL_MAX(max_par_len, strlen(headline));
+        }
+
+        if (mglIsFieldSelected(fields, i, categories, formatting))
+            max_par_len = MGL_MAX(max_par_len, strlen(fields[i].name));
+    }
+
+    return max_par_len + formatting->distance;
+}
+
+// Appends the numeric value of a single element of the specified field type to 's'. Infinity and NaN are appended as null for JSON output
+static void mglAppendRecordNumber(MGLStringInternal* s, unsigned type, const void* val, int json)
+{
+    char s_val[64];
+
+    switch (type)
+    {
+        case MGLFieldTypeBoolean:
+        case MGLFieldTypeBooleanArray:
+            mglStringInternalAppendCStr(s, (*(const GLboolean*)val != GL_FALSE ? "true" : "false"));
+            return;
+        case MGLFieldTypeFloat:
+        case MGLFieldTypeFloatArray:
+        case MGLFieldTypeDouble:
+        case MGLFieldTypeDoubleArray:
+        {
+            const int       is_float    = (type == MGLFieldTypeFloat || type == MGLFieldTypeFloatArray);
+            const double    d           = (is_float ? (double)*(const GLfloat*)val : *(const GLdouble*)val);
+            if (json && d - d != 0.0)
+            {
+                mglStringInternalAppendCStr(s, "null");
+                return;
+            }
+            mglFormatDouble(s_val, d);
+        }
+        break;
+        case MGLFieldTypeInteger64:
+        case MGLFieldTypeInteger64Array:
+            mglFormatInt64(s_val, (long long)*(const GLint64*)val);
+            break;
+        case MGLFieldTypeInteger:
+        case MGLFieldTypeIntegerArray:
+            mglFormatInt64(s_val, (long long)*(const GLint*)val);
+            break;
+        default:
+            mglFormatUInt64(s_val, (unsigned long long)(GLuint)*(const GLint*)val);
+            break;
+    }
+
+    mglStringInternalAppendCStr(s, s_val);
+}
+
+// Appends the enumeration name 'name' to 's'. Unknown names are appended as null for JSON output and as empty string otherwise
+static void mglAppendRecordName(MGLStringInternal* s, const char* name, int json)
+{
+    if (name != NULL)
+    {
+        if (json)
+            mglStringInternalAppendCStr(s, "\"");
+        mglStringInternalAppendCStr(s, name);
+        if (json)
+            mglStringInternalAppendCStr(s, "\"");
+    }
+    else if (json)
+        mglStringInternalAppendCStr(s, "null");
+}
+
+// Appends the enumeration names of the first 'count' elements of 'val' to 's', or the names of all set bits for bitfields
+static void mglAppendRecordNames(MGLStringInternal* s, const MGLFieldDescriptor* field, const GLint* val, size_t count, int json)
+{
+    const int   is_list     = (field->type != MGLFieldTypeEnum);
+    const char* separator   = (json ? ", " : (field->type == MGLFieldTypeBitfield ? "|" : ","));
+    size_t      num_names   = 0;
+
+    if (json && is_list)
+        mglStringInternalAppendCStr(s, "[");
+
+    if (field->type == MGLFieldTypeBitfield)
+    {
+        for (size_t i = 0; i < field->count; ++i)
+        {
+            const GLenum flag = (1u << i);
+            if (((GLbitfield)val[0] & flag) != 0)
+            {
+                if (num_names++ > 0)
+                    mglStringInternalAppendCStr(s, separator);
+                mglAppendRecordName(s, field->proc(flag), json);
+            }
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (i > 0)
+                mglStringInternalAppendCStr(s, separator);
+            mglAppendRecordName(s, field->proc(val[i]), json);
+        }
+    }
+
+    if (json && is_list)
+        mglStringInternalAppendCStr(s, "]");
+}
+
+// Appends the specified field of the state structure 'base' as machine readable record to 's'; 'base' is null if the field is not available
+static void mglAppendFieldRecord(MGLStringInternal* s, const MGLFieldDescriptor* field, const void* base, int json, int last)
+{
+    const int has_names = (field->type == MGLFieldTypeEnum || field->type == MGLFieldTypeEnumArray || field->type == MGLFieldTypeBitfield);
+    const int is_array  = (field->type >= MGLFieldTypeIntegerArray); // array types follow all scalar types
+
+    if (json)
+    {
+        mglStringInternalAppendCStr(s, "  \"");
+        mglStringInternalAppendCStr(s, field->name);
+        mglStringInternalAppendCStr(s, "\": ");
+    }
+    else
+    {
+        mglStringInternalAppendCStr(s, field->name);
+        mglStringInternalAppendCStr(s, "=");
+    }
+
+    if (base != NULL)
+    {
+        const char*     val         = (const char*)base + field->offset;
+        const size_t    elem_size   = mglFieldElementSize(field->type);
+        size_t          count       = (is_array ? field->count : 1);
+
+        if (field->count_offset != MGL_FIELD_NO_OFFSET)
+            count = MGL_MIN(count, (size_t)MGL_MAX(0, *(const GLint*)((const char*)base + field->count_offset)));
+
+        if (json && has_names)
+            mglStringInternalAppendCStr(s, "{ \"value\": ");
+        if (json && is_array)
+            mglStringInternalAppendCStr(s, "[");
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (i > 0)
+                mglStringInternalAppendCStr(s, (json ? ", " : ","));
+            mglAppendRecordNumber(s, field->type, val + i * elem_size, json);
+        }
+
+        if (json && is_array)
+            mglStringInternalAppendCStr(s, "]");
+
+        if (has_names)
+        {
+            if (json)
+                mglStringInternalAppendCStr(s, ", \"name\": ");
+            else
+            {
+                mglStringInternalAppendCStr(s, "\n");
+                mglStringInternalAppendCStr(s, field->name);
+                mglStringInternalAppendCStr(s, ".name=");
+            }
+
+            mglAppendRecordNames(s, field, (const GLint*)val, count, json);
+
+            if (json)
+                mglStringInternalAppendCStr(s, " }");
+        }
+    }
+    else if (json)
+        mglStringInternalAppendCStr(s, "null");
+
+    mglStringInternalAppendCStr(s, (json && !last ? ",\n" : "\n"));
+}
+
+// Passes the records in 's' to 'proc' and clears 's', if 'proc' is non-null. Records are no longer passed once an allocation failed
+static void mglFlushFieldRecords(MGLStringInternal* s, MGLWriteProc proc, void* user)
+{
+    if (proc != NULL && s->len > 0 && !s->failed)
+    {
+        proc(s->buf, s->len, user);
+        mglStringInternalClear(s);
+    }
+}
+
+// Appends all selected fields of the state structure 'base' as machine readable records (see MGLFormattingOutput) to 's'.
+// If 'proc' is non-null, each record is passed to 'proc' instead, so only a single record is held in memory
+static void mglAppendFieldRecords(MGLStringInternal* s, const MGLFieldDescriptor* fields, const unsigned short* sorted, size_t num_fields, const void* base, unsigned version, const MGLFormattingOptions* formatting, MGLWriteProc proc, void* user)
+{
+    const int       json        = (formatting->output == MGLFormattingOutputJSON);
+    const unsigned  categories  = (formatting->categories != 0 ? formatting->categories : (unsigned)MGLStateCategoryAll);
+
+    // Find last selected field, which has no trailing comma in JSON output
+    size_t last = num_fields;
+
+    for (size_t i = 0; i < num_fields; ++i)
+    {
+        if (mglIsFieldSelected(fields, mglFieldOrderIndex(sorted, i, formatting), categories, formatting))
+            last = i;
+    }
+
+    if (json)
+        mglStringInternalAppendCStr(s, "{\n");
+
+    for (size_t i = 0; i < num_fields; ++i)
+    {
+        const size_t                index   = mglFieldOrderIndex(sorted, i, formatting);
+        const MGLFieldDescriptor*   field   = &(fields[index]);
+
+        if (!mglIsFieldSelected(fields, index, categories, formatting))
+            continue;
+
+        mglFlushFieldRecords(s, proc, user);
+        mglAppendFieldRecord(s, field, (version != 0 && !mglIsFieldAvailable(field, version) ? NULL : base), json, (i == last));
+    }
+
+    if (json)
+        mglStringInternalAppendCStr(s, "}\n");
+
+    mglFlushFieldRecords(s, proc, user);
+}
+
+// Prints all fields of the state structure 'base' and passes each formatted line to 'proc'
+static void mglPrintFieldsTo(const MGLFieldDescriptor* fields, const unsigned short* sorted, size_t num_fields, const void* base, unsigned version, const MGLFormattingOptions* formatting, MGLWriteProc proc, void* user)
+{
+    if (formatting == NULL)
+        formatting = (&g_MGLFormattingDefault);
+
+    const unsigned categories = (formatting->categories != 0 ? formatting->categories : (unsigned)MGLStateCategoryAll);
+
+    // Write each string pair immediately, so only a single pair is held in memory
+    MGLStringStream     stream  = { proc, user, formatting, 0, { 0, 0, NULL, formatting->allocator, 0 } };
+    MGLStringInternal   par     = { 0, 0, NULL, formatting->allocator, 0 }, val = { 0, 0, NULL, formatting->allocator, 0 };
+    MGLStringPairArray  out     = { &par, &val, 0, categories, &stream };
+
+    if (formatting->output != MGLFormattingOutputText)
+    {
+        mglAppendFieldRecords(&(stream.line), fields, sorted, num_fields, base, version, formatting, proc, user);
+        mglStringInternalFree(&(stream.line));
+        return;
+    }
+
+    stream.max_par_len = mglMaxFieldNameLength(fields, num_fields, version, categories, formatting);
+    mglNextFields(&out, fields, sorted, num_fields, base, version, formatting);
+
+    mglStringInternalFree(&par);
+    mglStringInternalFree(&val);
+    mglStringInternalFree(&(stream.line));
+}
+
+// Writes the number of glGet calls and the wall time in the form "N glGet calls, T us" into 's' (incl. NUL char); 's' must provide space for 104 characters.
+// The wall time is written as "n/a" if it is not measured, i.e. if MENTAL_GL_QUERY_STATS is not defined
+static void mglFormatQueryCost(char* s, unsigned long long num_get_calls, double time)
+{
+    s += mglFormatUInt64(s, num_get_calls);
+    memcpy(s, " glGet calls, ", 14);
+    s += 14;
+    #ifdef MENTAL_GL_QUERY_STATS
+    s += mglFormatDouble(s, time * 1.0e6);
+    memcpy(s, " us", 4);
+    #else
+    (void)time;
+    memcpy(s, "n/a", 4);
+    #endif
+}
+
+MGLString mglPrintQueryStats(const MGLQueryStats* stats, const MGLFormattingOptions* formatting)
+{
+    // Internal constant parameters
+    static const unsigned g_numMinorVersions[] = { 6, 2, 4, 7 }; // GL 1.0-1.5, 2.0-2.1, 3.0-3.3, 4.0-4.6
+
+    if (formatting == NULL)
+        formatting = (&g_MGLFormattingDefault);
+
+    // Provide array with all string parts
+    MGLOutputStringInternal* s = mglOutputStringAcquire(NULL, formatting->allocator);
+    if (s == NULL)
+        return NULL;
+
+    MGLStringPairArray out = mglOutputStringPairs(s, formatting);
+
+    char val[104];
+    char headline[32];
+
+    mglFormatUInt64(val, stats->num_queries);
+    mglNextParamString(&out, MGLStateCategoryAll, "queries", val);
+
+    mglFormatUInt64(val, stats->num_active_texture_calls);
+    mglNextParamString(&out, MGLStateCategoryAll, "glActiveTexture calls", val);
+
+    mglFormatQueryCost(val, stats->num_get_calls, stats->time);
+    mglNextParamString(&out, MGLStateCategoryAll, "total", val);
+
+    // Print costs of all GL versions with at least one glGet call
+    size_t index = 0;
+
+    for (unsigned major = 1; major <= 4; ++major)
+    {
+        for (unsigned minor = 0; minor < g_numMinorVersions[major - 1]; ++minor, ++index)
+        {
+            const MGLQueryStatsVersion* block = &(stats->versions[index]);
+            if (block->num_get_calls > 0)
+            {
+                mglFormatVersionHeadline(headline, (major << 16) | minor);
+                mglFormatQueryCost(val, block->num_get_calls, block->time);
+                mglNextParamString(&out, MGLStateCategoryAll, headline + 1, val);
             }
-            new_buf[len] = '\0';
+        }
+    }
+
+    mglPrintStringPairs(out, formatting, &(s->str));
+    mglOutputStringReleaseParts(s);
+
+    return (MGLString)s;
+}
+
+MGLString mglPrintRenderState(const MGLRenderState* rs, const MGLFormattingOptions* formatting)
+{
+    MGLOutputStringInternal* s = (MGLOutputStringInternal*)mglPrintRenderStateInto(NULL, rs, formatting);
+    mglOutputStringReleaseParts(s);
+    return (MGLString)s;
+}
+
+MGLString mglPrintRenderStateInto(MGLString reuse, const MGLRenderState* rs, const MGLFormattingOptions* formatting)
+{
+    if (formatting == NULL)
+        formatting = (&g_MGLFormattingDefault);
+
+    // Provide array with all string parts
+    MGLOutputStringInternal* s = mglOutputStringAcquire(reuse, formatting->allocator);
+    if (s == NULL)
+        return NULL;
+
+    MGLStringPairArray out = mglOutputStringPairs(s, formatting);
+
+    #define MGL_VERSION(MAJOR, MINOR)       (((MAJOR) << 16) | (MINOR))
+
+    if (formatting->output != MGLFormattingOutputText)
+    {
+        // Emit machine readable records directly from the typed values
+        mglStringInternalClear(&(s->str));
+        mglAppendFieldRecords(&(s->str), g_MGLRenderStateFields, g_MGLRenderStateFieldsSorted, MGL_NUM_RENDER_STATE_FIELDS, rs, MGL_VERSION(rs->iMajorVersion, rs->iMinorVersion), formatting, NULL, NULL);
+    }
+    else
+    {
+        mglNextFields(&out, g_MGLRenderStateFields, g_MGLRenderStateFieldsSorted, MGL_NUM_RENDER_STATE_FIELDS, rs, MGL_VERSION(rs->iMajorVersion, rs->iMinorVersion), formatting);
+        mglPrintStringPairs(out, formatting, &(s->str));
+    }
+
+    #undef MGL_VERSION
+
+    return (MGLString)s;
+}
+
+MGLString mglPrintBindingPoints(const MGLBindingPoints* bp, const MGLFormattingOptions* formatting)
+{
+    MGLOutputStringInternal* s = (MGLOutputStringInternal*)mglPrintBindingPointsInto(NULL, bp, formatting);
+    mglOutputStringReleaseParts(s);
+    return (MGLString)s;
+}
+
+MGLString mglPrintBindingPointsInto(MGLString reuse, const MGLBindingPoints* bp, const MGLFormattingOptions* formatting)
+{
+    if (formatting == NULL)
+        formatting = (&g_MGLFormattingDefault);
+
+    // Provide array with all string parts
+    MGLOutputStringInternal* s = mglOutputStringAcquire(reuse, formatting->allocator);
+    if (s == NULL)
+        return NULL;
+
+    MGLStringPairArray out = mglOutputStringPairs(s, formatting);
+
+    if (formatting->output != MGLFormattingOutputText)
+    {
+        // Emit machine readable records directly from the typed values
+        mglStringInternalClear(&(s->str));
+        mglAppendFieldRecords(&(s->str), g_MGLBindingPointsFields, g_MGLBindingPointsFieldsSorted, MGL_NUM_BINDING_POINTS_FIELDS, bp, 0, formatting, NULL, NULL);
+    }
+    else
+    {
+        mglNextFields(&out, g_MGLBindingPointsFields, g_MGLBindingPointsFieldsSorted, MGL_NUM_BINDING_POINTS_FIELDS, bp, 0, formatting);
+        mglPrintStringPairs(out, formatting, &(s->str));
+    }
+
+    return (MGLString)s;
+}
+
+// Prints all changed fields between the state structures 'lhs' and 'rhs' into the output string 'reuse'
+static MGLString mglPrintFieldsDiff(MGLString reuse, const MGLFieldDescriptor* fields, const unsigned short* sorted, size_t num_fields, const void* lhs, const void* rhs, const MGLFormattingOptions* formatting)
+{
+    if (formatting == NULL)
+        formatting = (&g_MGLFormattingDefault);
+
+    // Provide array with all string parts
+    MGLOutputStringInternal* s = mglOutputStringAcquire(reuse, formatting->allocator);
+    if (s == NULL)
+        return NULL;
+
+    MGLStringPairArray out = mglOutputStringPairs(s, formatting);
+
+    for (size_t i = 0; i < num_fields; ++i)
+    {
+        const size_t                index   = mglFieldOrderIndex(sorted, i, formatting);
+        const MGLFieldDescriptor*   field   = &(fields[index]);
+
+        if (memcmp((const char*)lhs + field->offset, (const char*)rhs + field->offset, mglFieldSize(field)) != 0 &&
+            mglIsFieldSelected(fields, index, out.categories, formatting))
+        {
+            mglNextParamFieldDiff(&out, field, lhs, rhs, formatting);
+        }
+    }
+
+    mglPrintStringPairs(out, formatting, &(s->str));
+
+    return (MGLString)s;
+}
+
+size_t mglDiffRenderState(const MGLRenderState* lhs, const MGLRenderState* rhs, MGLStateChange* changes, size_t max_changes)
+{
+    return mglDiffFields(g_MGLRenderStateFields, MGL_NUM_RENDER_STATE_FIELDS, lhs, rhs, changes, max_changes);
+}
+
+size_t mglDiffBindingPoints(const MGLBindingPoints* lhs, const MGLBindingPoints* rhs, MGLStateChange* changes, size_t max_changes)
+{
+    return mglDiffFields(g_MGLBindingPointsFields, MGL_NUM_BINDING_POINTS_FIELDS, lhs, rhs, changes, max_changes);
+}
+
+// Internal constant default weights of mglGetDefaultTransitionWeights in the order of MGLTransitionTier
+static const MGLTransitionWeights g_MGLTransitionWeightsDefault =
+{
+    { 100.0, 20.0, 4.0, 2.0, 1.0, 8.0, 1.0 },
+    {   1.0,  1.0, 1.0, 2.0, 0.5, 0.5, 0.5 },
+};
+
+// Returns the transition cost tier of the specified render state field, or -1 if changes of this field are ignored
+static int mglTransitionTierOfField(const MGLFieldDescriptor* field)
+{
+    switch (field->pname)
+    {
+        case GL_COLOR_CLEAR_VALUE:
+            return MGLTransitionTierOther;
+        #ifdef GL_VERSION_3_1
+        case GL_UNIFORM_BUFFER_BINDING:
+        case GL_UNIFORM_BUFFER_START:
+        case GL_UNIFORM_BUFFER_SIZE:
+            return MGLTransitionTierUniformBuffers;
+        #endif // /GL_VERSION_3_1
+        #ifdef GL_VERSION_3_3
+        case GL_TIMESTAMP:
+            return -1;
+        #endif // /GL_VERSION_3_3
+        #ifdef GL_VERSION_4_3
+        case GL_SHADER_STORAGE_BUFFER_BINDING:
+        case GL_SHADER_STORAGE_BUFFER_START:
+        case GL_SHADER_STORAGE_BUFFER_SIZE:
+            return MGLTransitionTierUniformBuffers;
+        #endif // /GL_VERSION_4_3
+        default:
+            break;
+    }
+
+    switch (field->category)
+    {
+        case MGLStateCategoryLimits:
+            return -1;
+        case MGLStateCategoryFramebuffer:
+            return MGLTransitionTierFramebuffer;
+        case MGLStateCategoryProgram:
+            return MGLTransitionTierProgram;
+        case MGLStateCategoryVertexBindings:
+            return MGLTransitionTierVertexBindings;
+        case MGLStateCategoryTextures:
+            return MGLTransitionTierTextures;
+        case MGLStateCategoryBlend:
+        case MGLStateCategoryDepthStencil:
+        case MGLStateCategoryRasterizer:
+            return MGLTransitionTierFixedFunction;
+        default:
+            return MGLTransitionTierOther;
+    }
+}
+
+// Returns the number of changed elements of the specified field between the state structures 'lhs' and 'rhs'; fields that are no arrays count as a single element
+static size_t mglCountChangedElements(const MGLFieldDescriptor* field, const void* lhs, const void* rhs)
+{
+    const char*  lhs_val = (const char*)lhs + field->offset;
+    const char*  rhs_val = (const char*)rhs + field->offset;
+
+    // Only indexed arrays and binding points are charged per element, since other arrays are set with a single GL call, e.g. GL_VIEWPORT
+    if ((field->flags & MGLFieldFlagIndexed) == 0 && field->category != MGLStateCategoryTextures)
+        return (memcmp(lhs_val, rhs_val, mglFieldSize(field)) != 0 ? 1 : 0);
+
+    const size_t elem_size  = mglFieldElementSize(field->type);
+    const size_t count      = mglFieldSize(field) / elem_size;
+    size_t       changed    = 0;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (memcmp(lhs_val + i * elem_size, rhs_val + i * elem_size, elem_size) != 0)
+            ++changed;
+    }
+
+    return changed;
+}
+
+void mglGetDefaultTransitionWeights(MGLTransitionWeights* weights)
+{
+    *weights = g_MGLTransitionWeightsDefault;
+}
+
+double mglEvaluateTransition(const MGLRenderState* lhs, const MGLRenderState* rhs, const MGLBindingPoints* lhs_bp, const MGLBindingPoints* rhs_bp, const MGLTransitionWeights* weights, MGLTransitionCost* cost)
+{
+    MGLTransitionCost result;
+    memset(&result, 0, sizeof(result));
+
+    if (weights == NULL)
+        weights = (&g_MGLTransitionWeightsDefault);
+
+    // Count changes per tier
+    for (size_t i = 0; i < MGL_NUM_RENDER_STATE_FIELDS; ++i)
+    {
+        const MGLFieldDescriptor*   field   = &(g_MGLRenderStateFields[i]);
+        const int                   tier    = mglTransitionTierOfField(field);
+
+        if (tier >= 0)
+            result.num_changes[tier] += mglCountChangedElements(field, lhs, rhs);
+    }
+
+    if (lhs_bp != NULL && rhs_bp != NULL)
+    {
+        for (size_t i = 0; i < MGL_NUM_BINDING_POINTS_FIELDS; ++i)
+            result.num_changes[MGLTransitionTierTextures] += mglCountChangedElements(&(g_MGLBindingPointsFields[i]), lhs_bp, rhs_bp);
+    }
+
+    // Apply weights
+    for (int tier = 0; tier < MGL_TRANSITION_TIERS; ++tier)
+    {
+        if (result.num_changes[tier] > 0)
+        {
+            result.tier_scores[tier] = weights->base[tier] + weights->per_change[tier] * (double)result.num_changes[tier];
+            result.score += result.tier_scores[tier];
+        }
+    }
+
+    if (cost != NULL)
+        *cost = result;
+
+    return result.score;
+}
+
+// Returns the specified value folded into the specified number of bits; values that fit into the bit range are unchanged
+static unsigned long long mglFoldSortKeyBits(unsigned long long value, unsigned bits)
+{
+    const unsigned long long mask = (1ull << bits) - 1;
+    unsigned long long folded = 0;
+
+    for (; value != 0; value >>= bits)
+        folded ^= (value & mask);
+
+    return folded;
+}
+
+// Returns the specified GL object name as unsigned value
+static unsigned long long mglSortKeyName(GLint name)
+{
+    return (unsigned long long)(GLuint)name;
+}
+
+// Hashes the primary texture bindings, i.e. MGL_SORT_KEY_TEXTURE_UNITS units of all targets
+static unsigned long long mglHashPrimaryTextures(const MGLBindingPoints* bp)
+{
+    MGLHashState hash;
+    mglHashInit(&hash, 0x4D474C54u);
+
+    for (size_t i = 0; i < MGL_NUM_BINDING_POINTS_FIELDS; ++i)
+        mglHashUpdate(&hash, (const GLuint*)((const char*)bp + g_MGLBindingPointsFields[i].offset), MGL_SORT_KEY_TEXTURE_UNITS);
+
+    return mglHashFinal(&hash);
+}
+
+// Returns non-zero if the primary texture bindings of 'lhs' and 'rhs' are different
+static int mglPrimaryTexturesChanged(const MGLBindingPoints* lhs, const MGLBindingPoints* rhs)
+{
+    for (size_t i = 0; i < MGL_NUM_BINDING_POINTS_FIELDS; ++i)
+    {
+        const size_t offset = g_MGLBindingPointsFields[i].offset;
+        if (memcmp((const char*)lhs + offset, (const char*)rhs + offset, sizeof(GLint) * MGL_SORT_KEY_TEXTURE_UNITS) != 0)
+            return 1;
+    }
+    return 0;
+}
+
+// Returns the number of changes of the sort key states between the draw records 'lhs' and 'rhs'
+static size_t mglCountSortKeyTransitions(const MGLDrawRecord* lhs, const MGLDrawRecord* rhs)
+{
+    const MGLRenderState*   lhs_rs      = lhs->render_state;
+    const MGLRenderState*   rhs_rs      = rhs->render_state;
+    size_t                  transitions = 0;
+
+    transitions += (lhs_rs->iDrawFramebufferBinding != rhs_rs->iDrawFramebufferBinding);
+    transitions += (lhs_rs->iCurrentProgram != rhs_rs->iCurrentProgram);
+    transitions += (lhs_rs->iVertexArrayBinding != rhs_rs->iVertexArrayBinding);
+    transitions += (lhs_rs->bBlend != rhs_rs->bBlend);
+
+    if (lhs->binding_points != NULL && rhs->binding_points != NULL)
+        transitions += (size_t)mglPrimaryTexturesChanged(lhs->binding_points, rhs->binding_points);
+
+    return transitions;
+}
+
+// Accumulates the state transitions between all consecutive draw records
+static void mglAccumDrawTransitions(const MGLDrawRecord* records, size_t num_records, const MGLTransitionWeights* weights, size_t* transitions, double* score)
+{
+    for (size_t i = 1; i < num_records; ++i)
+    {
+        const MGLDrawRecord* prev = &(records[i - 1]);
+        const MGLDrawRecord* next = &(records[i]);
+
+        *transitions += mglCountSortKeyTransitions(prev, next);
+        *score += mglEvaluateTransition(prev->render_state, next->render_state, prev->binding_points, next->binding_points, weights, NULL);
+    }
+}
+
+// Compares two draw records by their sort key and original index for qsort
+static int mglCompareDrawRecords(const void* lhs, const void* rhs)
+{
+    const MGLDrawRecord* a = (const MGLDrawRecord*)lhs;
+    const MGLDrawRecord* b = (const MGLDrawRecord*)rhs;
+
+    if (a->key != b->key)
+        return (a->key < b->key ? -1 : 1);
+    if (a->index != b->index)
+        return (a->index < b->index ? -1 : 1);
+    return 0;
+}
+
+unsigned long long mglRenderStateSortKey(const MGLRenderState* rs, const MGLBindingPoints* bp)
+{
+    unsigned long long key = 0;
+
+    key |= mglFoldSortKeyBits(mglSortKeyName(rs->iDrawFramebufferBinding), 8) << 56;
+    key |= mglFoldSortKeyBits(mglSortKeyName(rs->iCurrentProgram), 14) << 42;
+    key |= mglFoldSortKeyBits(mglSortKeyName(rs->iVertexArrayBinding), 14) << 28;
+
+    if (bp != NULL)
+        key |= mglFoldSortKeyBits(mglHashPrimaryTextures(bp), 14) << 14;
+
+    key |= (unsigned long long)(rs->bBlend != GL_FALSE) << 13;
+    key |= mglFoldSortKeyBits(mglHashRenderState(rs), 13);
+
+    return key;
+}
+
+void mglSortDrawRecords(MGLDrawRecord* records, size_t num_records, const MGLTransitionWeights* weights, MGLDrawSortStats* stats)
+{
+    for (size_t i = 0; i < num_records; ++i)
+    {
+        records[i].key      = mglRenderStateSortKey(records[i].render_state, records[i].binding_points);
+        records[i].index    = i;
+    }
+
+    if (stats != NULL)
+    {
+        memset(stats, 0, sizeof(MGLDrawSortStats));
+        mglAccumDrawTransitions(records, num_records, weights, &(stats->transitions_before), &(stats->score_before));
+    }
+
+    if (num_records > 1)
+        qsort(records, num_records, sizeof(MGLDrawRecord), mglCompareDrawRecords);
+
+    if (stats != NULL)
+        mglAccumDrawTransitions(records, num_records, weights, &(stats->transitions_after), &(stats->score_after));
+}
+
+void mglPackRenderState(MGLPackedRenderState* packed, const MGLRenderState* rs)
+{
+    memset(packed, 0, sizeof(MGLPackedRenderState));
+
+    packed->iMajorVersion = rs->iMajorVersion;
+    packed->iMinorVersion = rs->iMinorVersion;
+
+    size_t i = 0, bit = 0;
+
+    // Pack one bit per boolean element
+    for (; i < MGL_NUM_PACKED_BOOLEAN_FIELDS; ++i)
+    {
+        const MGLFieldDescriptor* field = &(g_MGLRenderStateFields[g_MGLPackedRenderStateFields[i]]);
+        const GLboolean* val = (const GLboolean*)((const char*)rs + field->offset);
+
+        for (size_t j = 0, n = mglFieldSize(field); j < n; ++j, ++bit)
+        {
+            if (val[j] != GL_FALSE)
+                packed->flags[bit / 32] |= (1u << (bit % 32));
+        }
+    }
+
+    // Copy all other fields word by word, hot fields first
+    GLuint* word = packed->hot;
+
+    for (; i < MGL_NUM_PACKED_FIELDS; ++i)
+    {
+        const MGLFieldDescriptor* field = &(g_MGLRenderStateFields[g_MGLPackedRenderStateFields[i]]);
+        const size_t size = mglFieldSize(field);
+
+        if (i == MGL_NUM_PACKED_BOOLEAN_FIELDS + MGL_NUM_PACKED_HOT_FIELDS)
+            word = packed->cold;
+
+        memcpy(word, (const char*)rs + field->offset, size);
+        word += size / sizeof(GLuint);
+    }
+}
+
+void mglUnpackRenderState(MGLRenderState* rs, const MGLPackedRenderState* packed, const MGLImplementationLimits* limits)
+{
+    memset(rs, 0, sizeof(MGLRenderState));
+
+    if (limits != NULL)
+        mglCopyImplementationLimits(rs, limits);
+
+    rs->iMajorVersion = packed->iMajorVersion;
+    rs->iMinorVersion = packed->iMinorVersion;
+
+    size_t i = 0, bit = 0;
+
+    // Unpack one bit per boolean element
+    for (; i < MGL_NUM_PACKED_BOOLEAN_FIELDS; ++i)
+    {
+        const MGLFieldDescriptor* field = &(g_MGLRenderStateFields[g_MGLPackedRenderStateFields[i]]);
+        GLboolean* val = (GLboolean*)((char*)rs + field->offset);
+
+        for (size_t j = 0, n = mglFieldSize(field); j < n; ++j, ++bit)
+            val[j] = ((packed->flags[bit / 32] >> (bit % 32)) & 1u ? GL_TRUE : GL_FALSE);
+    }
+
+    // Copy all other fields word by word, hot fields first
+    const GLuint* word = packed->hot;
+
+    for (; i < MGL_NUM_PACKED_FIELDS; ++i)
+    {
+        const MGLFieldDescriptor* field = &(g_MGLRenderStateFields[g_MGLPackedRenderStateFields[i]]);
+        const size_t size = mglFieldSize(field);
+
+        if (i == MGL_NUM_PACKED_BOOLEAN_FIELDS + MGL_NUM_PACKED_HOT_FIELDS)
+            word = packed->cold;
+
+        memcpy((char*)rs + field->offset, word, size);
+        word += size / sizeof(GLuint);
+    }
+}
+
+unsigned long long mglHashRenderState(const MGLRenderState* rs)
+{
+    MGLPackedRenderState packed;
+    mglPackRenderState(&packed, rs);
+    return mglHashPackedRenderState(&packed);
+}
+
+unsigned long long mglHashPackedRenderState(const MGLPackedRenderState* packed)
+{
+    const GLuint version[2] = { (GLuint)packed->iMajorVersion, (GLuint)packed->iMinorVersion };
+
+    MGLHashState hash;
+    mglHashInit(&hash, 0x4D474C52u);
+    mglHashUpdate(&hash, version, 2);
+    mglHashUpdate(&hash, packed->flags, MGL_PACKED_RENDER_STATE_FLAG_WORDS);
+    mglHashUpdate(&hash, packed->hot, MGL_PACKED_RENDER_STATE_HOT_WORDS);
+    mglHashUpdate(&hash, packed->cold, MGL_PACKED_RENDER_STATE_COLD_WORDS - MGL_PACKED_TIMESTAMP_WORDS);
+
+    return mglHashFinal(&hash);
+}
+
+unsigned long long mglHashBindingPoints(const MGLBindingPoints* bp)
+{
+    MGLHashState hash;
+    mglHashInit(&hash, 0x4D474C42u);
+
+    for (size_t i = 0; i < MGL_NUM_BINDING_POINTS_FIELDS; ++i)
+    {
+        const MGLFieldDescriptor* field = &(g_MGLBindingPointsFields[i]);
+        mglHashUpdate(&hash, (const GLuint*)((const char*)bp + field->offset), mglFieldSize(field) / sizeof(GLuint));
+    }
+
+    return mglHashFinal(&hash);
+}
+
+size_t mglSerializeRenderState(const MGLRenderState* rs, void* data, size_t size)
+{
+    return mglSerializeFields(g_MGLRenderStateFields, MGL_NUM_RENDER_STATE_FIELDS, rs, MGLSnapshotKindRenderState, rs->iMajorVersion, rs->iMinorVersion, data, size);
+}
+
+size_t mglDeserializeRenderState(MGLRenderState* rs, const void* data, size_t size)
+{
+    GLint iMajorVersion = 0, iMinorVersion = 0;
+    const size_t snapshot_size = mglDeserializeFields(g_MGLRenderStateFields, MGL_NUM_RENDER_STATE_FIELDS, rs, sizeof(MGLRenderState), MGLSnapshotKindRenderState, &iMajorVersion, &iMinorVersion, data, size);
+
+    if (snapshot_size != 0)
+    {
+        // Context version is also stored in the header for GL versions prior to 3.0
+        rs->iMajorVersion = iMajorVersion;
+        rs->iMinorVersion = iMinorVersion;
+    }
+
+    return snapshot_size;
+}
+
+size_t mglSerializeBindingPoints(const MGLBindingPoints* bp, void* data, size_t size)
+{
+    return mglSerializeFields(g_MGLBindingPointsFields, MGL_NUM_BINDING_POINTS_FIELDS, bp, MGLSnapshotKindBindingPoints, 0, 0, data, size);
+}
+
+size_t mglDeserializeBindingPoints(MGLBindingPoints* bp, const void* data, size_t size)
+{
+    GLint iMajorVersion = 0, iMinorVersion = 0;
+    return mglDeserializeFields(g_MGLBindingPointsFields, MGL_NUM_BINDING_POINTS_FIELDS, bp, sizeof(MGLBindingPoints), MGLSnapshotKindBindingPoints, &iMajorVersion, &iMinorVersion, data, size);
+}
+
+MGLString mglPrintRenderStateDiff(const MGLRenderState* lhs, const MGLRenderState* rhs, const MGLFormattingOptions* formatting)
+{
+    MGLOutputStringInternal* s = (MGLOutputStringInternal*)mglPrintRenderStateDiffInto(NULL, lhs, rhs, formatting);
+    mglOutputStringReleaseParts(s);
+    return (MGLString)s;
+}
+
+MGLString mglPrintBindingPointsDiff(const MGLBindingPoints* lhs, const MGLBindingPoints* rhs, const MGLFormattingOptions* formatting)
+{
+    MGLOutputStringInternal* s = (MGLOutputStringInternal*)mglPrintBindingPointsDiffInto(NULL, lhs, rhs, formatting);
+    mglOutputStringReleaseParts(s);
+    return (MGLString)s;
+}
+
+void mglPrintRenderStateTo(const MGLRenderState* rs, const MGLFormattingOptions* formatting, MGLWriteProc proc, void* user)
+{
+    #define MGL_VERSION(MAJOR, MINOR)       (((MAJOR) << 16) | (MINOR))
+
+    mglPrintFieldsTo(g_MGLRenderStateFields, g_MGLRenderStateFieldsSorted, MGL_NUM_RENDER_STATE_FIELDS, rs, MGL_VERSION(rs->iMajorVersion, rs->iMinorVersion), formatting, proc, user);
+
+    #undef MGL_VERSION
+}
+
+void mglPrintBindingPointsTo(const MGLBindingPoints* bp, const MGLFormattingOptions* formatting, MGLWriteProc proc, void* user)
+{
+    mglPrintFieldsTo(g_MGLBindingPointsFields, g_MGLBindingPointsFieldsSorted, MGL_NUM_BINDING_POINTS_FIELDS, bp, 0, formatting, proc, user);
+}
+
+MGLString mglPrintRenderStateDiffInto(MGLString reuse, const MGLRenderState* lhs, const MGLRenderState* rhs, const MGLFormattingOptions* formatting)
+{
+    return mglPrintFieldsDiff(reuse, g_MGLRenderStateFields, g_MGLRenderStateFieldsSorted, MGL_NUM_RENDER_STATE_FIELDS, lhs, rhs, formatting);
+}
+
+MGLString mglPrintBindingPointsDiffInto(MGLString reuse, const MGLBindingPoints* lhs, const MGLBindingPoints* rhs, const MGLFormattingOptions* formatting)
+{
+    return mglPrintFieldsDiff(reuse, g_MGLBindingPointsFields, g_MGLBindingPointsFieldsSorted, MGL_NUM_BINDING_POINTS_FIELDS, lhs, rhs, formatting);
+}
+
+const MGLFieldDescriptor* mglGetRenderStateFields(size_t* num_fields)
+{
+    if (num_fields != NULL)
+        *num_fields = MGL_NUM_RENDER_STATE_FIELDS;
+    return g_MGLRenderStateFields;
+}
+
+const MGLFieldDescriptor* mglGetBindingPointsFields(size_t* num_fields)
+{
+    if (num_fields != NULL)
+        *num_fields = MGL_NUM_BINDING_POINTS_FIELDS;
+    return g_MGLBindingPointsFields;
+}
+
+GLenum mglGetIndexedFieldLimit(GLenum pname, unsigned version)
+{
+    size_t offset = 0;
+    return mglIndexedFieldLimit(pname, version, &offset);
+}
+
+const char* mglEnumName(GLenum value)
+{
+    const size_t i = mglFindEnumName(value);
+    return (i < MGL_NUM_ENUM_NAMES && g_MGLEnumNames[i].value == value ? g_MGLEnumNames[i].name : NULL);
+}
+
+MGLFilter mglCompileFilter(const MGLFilterDescriptor* desc)
+{
+    MGLFilterInternal* filter = (MGLFilterInternal*)mglAlloc(NULL, sizeof(MGLFilterInternal));
+    if (filter == NULL)
+        return NULL;
+
+    mglCompileFilterBits(filter->render_state, g_MGLRenderStateFields, MGL_NUM_RENDER_STATE_FIELDS, desc);
+    mglCompileFilterBits(filter->binding_points, g_MGLBindingPointsFields, MGL_NUM_BINDING_POINTS_FIELDS, desc);
+
+    return (MGLFilter)filter;
+}
+
+void mglFreeFilter(MGLFilter filter)
+{
+    mglFree(NULL, filter, sizeof(MGLFilterInternal));
+}
+
+const char* mglGetUTF8String(MGLString s)
+{
+    const char* buf = (s != NULL ? ((MGLOutputStringInternal*)s)->str.buf : NULL);
+    return (buf != NULL ? buf : "");
+}
+
+void mglFreeString(MGLString s)
+{
+    if (s)
+    {
+        // Keep a copy of the allocator, since it is stored inside the object that is released last
+        MGLOutputStringInternal*    str         = (MGLOutputStringInternal*)s;
+        MGLAllocator                allocator   = str->allocator;
+
+        mglOutputStringReleaseParts(str);
+        mglStringInternalFree(&(str->str));
+        mglFree((str->str.allocator != NULL ? &allocator : NULL), str, sizeof(MGLOutputStringInternal));
+    }
+}
+
+void mglInitShadowState(MGLShadowState* shadow, unsigned verify_interval)
+{
+    memset(shadow, 0, sizeof(MGLShadowState));
+    mglQueryImplementationLimits(&(shadow->limits));
+    mglSyncShadowState(shadow);
+    shadow->verify_interval = verify_interval;
+}
+
+void mglSyncShadowState(MGLShadowState* shadow)
+{
+    MGLQueryOptions options = { 0, &(shadow->limits), NULL, NULL, NULL };
+    mglQueryRenderStateEx(&(shadow->render_state), &options);
+    mglQueryBindingPoints(&(shadow->binding_points));
+    mglShadowQuerySamplerBindings(shadow);
+    mglShadowQueryStencilBits(shadow);
+}
+
+int mglVerifyShadowState(MGLShadowState* shadow)
+{
+    // Query actual GL state with the cached limits
+    MGLShadowState actual;
+    memcpy(&actual, shadow, sizeof(MGLShadowState));
+    mglSyncShadowState(&actual);
+
+    // Timestamp is never tracked by the shadow state
+    actual.render_state.iTimestamp = shadow->render_state.iTimestamp;
+
+    // Stencil attachments can change without a wrapper function, so always keep the actual number of stencil bits
+    shadow->stencil_bits = actual.stencil_bits;
+
+    if (memcmp(&(actual.render_state), &(shadow->render_state), sizeof(MGLRenderState)) != 0 ||
+        memcmp(&(actual.binding_points), &(shadow->binding_points), sizeof(MGLBindingPoints)) != 0 ||
+        memcmp(actual.sampler_bindings, shadow->sampler_bindings, sizeof(shadow->sampler_bindings)) != 0)
+    {
+        // Re-synchronize shadow state with actual GL state
+        memcpy(&(shadow->render_state), &(actual.render_state), sizeof(MGLRenderState));
+        memcpy(&(shadow->binding_points), &(actual.binding_points), sizeof(MGLBindingPoints));
+        memcpy(shadow->sampler_bindings, actual.sampler_bindings, sizeof(shadow->sampler_bindings));
+        ++(shadow->num_mismatches);
+        return 1;
+    }
+
+    return 0;
+}
+
+int mglShadowNextFrame(MGLShadowState* shadow)
+{
+    ++(shadow->frame);
+    if (shadow->verify_interval > 0 && shadow->frame % shadow->verify_interval == 0)
+        return mglVerifyShadowState(shadow);
+    return 0;
+}
+
+void mglShadowEnable(MGLShadowState* shadow, GLenum cap)
+{
+    glEnable(cap);
+    GLboolean* entry = mglShadowCapability(&(shadow->render_state), cap);
+    if (entry != NULL)
+        mglShadowStoreBoolean(shadow, entry, GL_TRUE);
+    mglShadowEndCall(shadow);
+}
+
+void mglShadowDisable(MGLShadowState* shadow, GLenum cap)
+{
+    glDisable(cap);
+    GLboolean* entry = mglShadowCapability(&(shadow->render_state), cap);
+    if (entry != NULL)
+        mglShadowStoreBoolean(shadow, entry, GL_FALSE);
+    mglShadowEndCall(shadow);
+}
+
+void mglShadowBlendColor(MGLShadowState* shadow, GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    #ifdef GL_VERSION_1_4
+    glBlendColor(red, green, blue, alpha);
+    mglShadowStoreFloat(shadow, &(shadow->render_state.fBlendColor[0]), red);
+    mglShadowStoreFloat(shadow, &(shadow->render_state.fBlendColor[1]), green);
+    mglShadowStoreFloat(shadow, &(shadow->render_state.fBlendColor[2]), blue);
+    mglShadowStoreFloat(shadow, &(shadow->render_state.fBlendColor[3]), alpha);
+    mglShadowEndCall(shadow);
+    #endif // /GL_VERSION_1_4
+}
+
+void mglShadowBlendEquation(MGLShadowState* shadow, GLenum mode)
+{
+    #ifdef GL_VERSION_1_4
+    glBlendEquation(mode);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iBlendEquationRGB), (GLint)mode);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iBlendEquationAlpha), (GLint)mode);
+    mglShadowEndCall(shadow);
+    #endif // /GL_VERSION_1_4
+}
+
+void mglShadowBlendEquationSeparate(MGLShadowState* shadow, GLenum mode_rgb, GLenum mode_alpha)
+{
+    #ifdef GL_VERSION_2_0
+    glBlendEquationSeparate(mode_rgb, mode_alpha);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iBlendEquationRGB), (GLint)mode_rgb);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iBlendEquationAlpha), (GLint)mode_alpha);
+    mglShadowEndCall(shadow);
+    #endif // /GL_VERSION_2_0
+}
+
+void mglShadowBlendFunc(MGLShadowState* shadow, GLenum sfactor, GLenum dfactor)
+{
+    glBlendFunc(sfactor, dfactor);
+    #ifdef GL_VERSION_1_4
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iBlendSrcRGB), (GLint)sfactor);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iBlendSrcAlpha), (GLint)sfactor);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iBlendDstRGB), (GLint)dfactor);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iBlendDstAlpha), (GLint)dfactor);
+    #endif // /GL_VERSION_1_4
+    mglShadowEndCall(shadow);
+}
+
+void mglShadowBlendFuncSeparate(MGLShadowState* shadow, GLenum src_rgb, GLenum dst_rgb, GLenum src_alpha, GLenum dst_alpha)
+{
+    #ifdef GL_VERSION_1_4
+    glBlendFuncSeparate(src_rgb, dst_rgb, src_alpha, dst_alpha);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iBlendSrcRGB), (GLint)src_rgb);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iBlendSrcAlpha), (GLint)src_alpha);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iBlendDstRGB), (GLint)dst_rgb);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iBlendDstAlpha), (GLint)dst_alpha);
+    mglShadowEndCall(shadow);
+    #endif // /GL_VERSION_1_4
+}
+
+void mglShadowColorMask(MGLShadowState* shadow, GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
+{
+    glColorMask(red, green, blue, alpha);
+    mglShadowStoreBoolean(shadow, &(shadow->render_state.bColorWriteMask[0]), (red   != GL_FALSE ? GL_TRUE : GL_FALSE));
+    mglShadowStoreBoolean(shadow, &(shadow->render_state.bColorWriteMask[1]), (green != GL_FALSE ? GL_TRUE : GL_FALSE));
+    mglShadowStoreBoolean(shadow, &(shadow->render_state.bColorWriteMask[2]), (blue  != GL_FALSE ? GL_TRUE : GL_FALSE));
+    mglShadowStoreBoolean(shadow, &(shadow->render_state.bColorWriteMask[3]), (alpha != GL_FALSE ? GL_TRUE : GL_FALSE));
+    mglShadowEndCall(shadow);
+}
+
+void mglShadowLogicOp(MGLShadowState* shadow, GLenum opcode)
+{
+    glLogicOp(opcode);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iLogicOpMode), (GLint)opcode);
+    mglShadowEndCall(shadow);
+}
+
+void mglShadowClearColor(MGLShadowState* shadow, GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    glClearColor(red, green, blue, alpha);
+    mglShadowStoreFloat(shadow, &(shadow->render_state.fColorClearValue[0]), red);
+    mglShadowStoreFloat(shadow, &(shadow->render_state.fColorClearValue[1]), green);
+    mglShadowStoreFloat(shadow, &(shadow->render_state.fColorClearValue[2]), blue);
+    mglShadowStoreFloat(shadow, &(shadow->render_state.fColorClearValue[3]), alpha);
+    mglShadowEndCall(shadow);
+}
+
+void mglShadowClearDepth(MGLShadowState* shadow, GLdouble depth)
+{
+    glClearDepth(depth);
+    mglShadowStoreDouble(shadow, &(shadow->render_state.dDepthClearValue), (GLfloat)MGL_MAX(0.0, MGL_MIN(depth, 1.0)));
+    mglShadowEndCall(shadow);
+}
+
+void mglShadowClearStencil(MGLShadowState* shadow, GLint s)
+{
+    glClearStencil(s);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iStencilClearValue), s);
+    mglShadowEndCall(shadow);
+}
+
+void mglShadowDepthFunc(MGLShadowState* shadow, GLenum func)
+{
+    glDepthFunc(func);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iDepthFunc), (GLint)func);
+    mglShadowEndCall(shadow);
+}
+
+void mglShadowDepthMask(MGLShadowState* shadow, GLboolean flag)
+{
+    glDepthMask(flag);
+    mglShadowStoreBoolean(shadow, &(shadow->render_state.bDepthWriteMask), (flag != GL_FALSE ? GL_TRUE : GL_FALSE));
+    mglShadowEndCall(shadow);
+}
+
+void mglShadowDepthRange(MGLShadowState* shadow, GLdouble near_val, GLdouble far_val)
+{
+    glDepthRange(near_val, far_val);
+
+    // Depth values are clamped to [0, 1] and usually stored with single precision
+    mglShadowStoreDouble(shadow, &(shadow->render_state.dDepthRange[0]), (GLfloat)MGL_MAX(0.0, MGL_MIN(near_val, 1.0)));
+    mglShadowStoreDouble(shadow, &(shadow->render_state.dDepthRange[1]), (GLfloat)MGL_MAX(0.0, MGL_MIN(far_val, 1.0)));
+    mglShadowEndCall(shadow);
+}
+
+void mglShadowStencilFunc(MGLShadowState* shadow, GLenum func, GLint ref, GLuint mask)
+{
+    glStencilFunc(func, ref, mask);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iStencilFunc), (GLint)func);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iStencilRef), mglShadowClampStencilRef(shadow, ref));
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iStencilValueMask), (GLint)mask);
+    #ifdef GL_VERSION_2_0
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iStencilBackFunc), (GLint)func);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iStencilBackRef), mglShadowClampStencilRef(shadow, ref));
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iStencilBackValueMask), (GLint)mask);
+    #endif // /GL_VERSION_2_0
+    mglShadowEndCall(shadow);
+}
+
+void mglShadowStencilFuncSeparate(MGLShadowState* shadow, GLenum face, GLenum func, GLint ref, GLuint mask)
+{
+    #ifdef GL_VERSION_2_0
+    glStencilFuncSeparate(face, func, ref, mask);
+    if (face == GL_FRONT || face == GL_FRONT_AND_BACK)
+    {
+        mglShadowStoreInteger(shadow, &(shadow->render_state.iStencilFunc), (GLint)func);
+        mglShadowStoreInteger(shadow, &(shadow->render_state.iStencilRef), mglShadowClampStencilRef(shadow, ref));
+        mglShadowStoreInteger(shadow, &(shadow->render_state.iStencilValueMask), (GLint)mask);
+    }
+    if (face == GL_BACK || face == GL_FRONT_AND_BACK)
+    {
+        mglShadowStoreInteger(shadow, &(shadow->render_state.iStencilBackFunc), (GLint)func);
+        mglShadowStoreInteger(shadow, &(shadow->render_state.iStencilBackRef), mglShadowClampStencilRef(shadow, ref));
+        mglShadowStoreInteger(shadow, &(shadow->render_state.iStencilBackValueMask), (GLint)mask);
+    }
+    mglShadowEndCall(shadow);
+    #endif // /GL_VERSION_2_0
+}
+
+void mglShadowStencilOp(MGLShadowState* shadow, GLenum sfail, GLenum dpfail, GLenum dppass)
+{
+    glStencilOp(sfail, dpfail, dppass);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iStencilFail), (GLint)sfail);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iStencilPassDepthFail), (GLint)dpfail);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iStencilPassDepthPass), (GLint)dppass);
+    #ifdef GL_VERSION_2_0
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iStencilBackFail), (GLint)sfail);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iStencilBackPassDepthFail), (GLint)dpfail);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iStencilBackPassDepthPass), (GLint)dppass);
+    #endif // /GL_VERSION_2_0
+    mglShadowEndCall(shadow);
+}
+
+void mglShadowStencilOpSeparate(MGLShadowState* shadow, GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass)
+{
+    #ifdef GL_VERSION_2_0
+    glStencilOpSeparate(face, sfail, dpfail, dppass);
+    if (face == GL_FRONT || face == GL_FRONT_AND_BACK)
+    {
+        mglShadowStoreInteger(shadow, &(shadow->render_state.iStencilFail), (GLint)sfail);
+        mglShadowStoreInteger(shadow, &(shadow->render_state.iStencilPassDepthFail), (GLint)dpfail);
+        mglShadowStoreInteger(shadow, &(shadow->render_state.iStencilPassDepthPass), (GLint)dppass);
+    }
+    if (face == GL_BACK || face == GL_FRONT_AND_BACK)
+    {
+        mglShadowStoreInteger(shadow, &(shadow->render_state.iStencilBackFail), (GLint)sfail);
+        mglShadowStoreInteger(shadow, &(shadow->render_state.iStencilBackPassDepthFail), (GLint)dpfail);
+        mglShadowStoreInteger(shadow, &(shadow->render_state.iStencilBackPassDepthPass), (GLint)dppass);
+    }
+    mglShadowEndCall(shadow);
+    #endif // /GL_VERSION_2_0
+}
+
+void mglShadowStencilMask(MGLShadowState* shadow, GLuint mask)
+{
+    glStencilMask(mask);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iStencilWriteMask), (GLint)mask);
+    #ifdef GL_VERSION_2_0
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iStencilBackWriteMask), (GLint)mask);
+    #endif // /GL_VERSION_2_0
+    mglShadowEndCall(shadow);
+}
+
+void mglShadowStencilMaskSeparate(MGLShadowState* shadow, GLenum face, GLuint mask)
+{
+    #ifdef GL_VERSION_2_0
+    glStencilMaskSeparate(face, mask);
+    if (face == GL_FRONT || face == GL_FRONT_AND_BACK)
+        mglShadowStoreInteger(shadow, &(shadow->render_state.iStencilWriteMask), (GLint)mask);
+    if (face == GL_BACK || face == GL_FRONT_AND_BACK)
+        mglShadowStoreInteger(shadow, &(shadow->render_state.iStencilBackWriteMask), (GLint)mask);
+    mglShadowEndCall(shadow);
+    #endif // /GL_VERSION_2_0
+}
+
+void mglShadowCullFace(MGLShadowState* shadow, GLenum mode)
+{
+    glCullFace(mode);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iCullFaceMode), (GLint)mode);
+    mglShadowEndCall(shadow);
+}
+
+void mglShadowFrontFace(MGLShadowState* shadow, GLenum mode)
+{
+    glFrontFace(mode);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iFrontFace), (GLint)mode);
+    mglShadowEndCall(shadow);
+}
+
+void mglShadowPolygonMode(MGLShadowState* shadow, GLenum face, GLenum mode)
+{
+    glPolygonMode(face, mode);
+    if (face == GL_FRONT || face == GL_FRONT_AND_BACK)
+        mglShadowStoreInteger(shadow, &(shadow->render_state.iPolygonMode[0]), (GLint)mode);
+    if (face == GL_BACK || face == GL_FRONT_AND_BACK)
+        mglShadowStoreInteger(shadow, &(shadow->render_state.iPolygonMode[1]), (GLint)mode);
+    mglShadowEndCall(shadow);
+}
+
+void mglShadowPolygonOffset(MGLShadowState* shadow, GLfloat factor, GLfloat units)
+{
+    #ifdef GL_VERSION_1_1
+    glPolygonOffset(factor, units);
+    mglShadowStoreFloat(shadow, &(shadow->render_state.fPolygonOffsetFactor), factor);
+    mglShadowStoreFloat(shadow, &(shadow->render_state.fPolygonOffsetUnits), units);
+    mglShadowEndCall(shadow);
+    #endif // /GL_VERSION_1_1
+}
+
+void mglShadowLineWidth(MGLShadowState* shadow, GLfloat width)
+{
+    glLineWidth(width);
+    mglShadowStoreFloat(shadow, &(shadow->render_state.fLineWidth), width);
+    mglShadowEndCall(shadow);
+}
+
+void mglShadowPointSize(MGLShadowState* shadow, GLfloat size)
+{
+    glPointSize(size);
+    mglShadowStoreFloat(shadow, &(shadow->render_state.fPointSize), size);
+    mglShadowEndCall(shadow);
+}
+
+void mglShadowViewport(MGLShadowState* shadow, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    glViewport(x, y, width, height);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iViewport[0]), x);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iViewport[1]), y);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iViewport[2]), MGL_MIN(width, shadow->limits.iMaxViewportDims[0]));
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iViewport[3]), MGL_MIN(height, shadow->limits.iMaxViewportDims[1]));
+    mglShadowEndCall(shadow);
+}
+
+void mglShadowScissor(MGLShadowState* shadow, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    glScissor(x, y, width, height);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iScissorBox[0]), x);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iScissorBox[1]), y);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iScissorBox[2]), width);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iScissorBox[3]), height);
+    mglShadowEndCall(shadow);
+}
+
+void mglShadowSampleCoverage(MGLShadowState* shadow, GLfloat value, GLboolean invert)
+{
+    #ifdef GL_VERSION_1_3
+    glSampleCoverage(value, invert);
+    mglShadowStoreFloat(shadow, &(shadow->render_state.fSampleCoverageValue), MGL_MAX(0.0f, MGL_MIN(value, 1.0f)));
+    mglShadowStoreBoolean(shadow, &(shadow->render_state.bSampleCoverageInvert), (invert != GL_FALSE ? GL_TRUE : GL_FALSE));
+    mglShadowEndCall(shadow);
+    #endif // /GL_VERSION_1_3
+}
 
-            // Replace previous string
-            MGL_FREE(s->buf);
-            s->cap = new_cap;
-            s->len = len;
-            s->buf = new_buf;
-        }
-        else if (len < s->len)
-        {
-            if (s->cap > MGL_STRING_MIN_CAPACITY && len < s->cap / 2)
-            {
-                // Allocate new string buffer and copy previous partial string into new buffer
-                size_t new_cap  = MGL_MAX(MGL_STRING_MIN_CAPACITY, s->cap / 2);
-                char* new_buf   = MGL_CALLOC(char, new_cap);
-                memcpy(new_buf, s->buf, len);
-                new_buf[len] = '\0';
-
-                // Replace previous string
-                MGL_FREE(s->buf);
-                s->cap = new_cap;
-                s->len = len;
-                s->buf = new_buf;
-            }
-            else
-            {
-                // Set new null terminator
-                s->buf[len] = '\0';
-            }
-        }
-        else if (len > s->len)
-        {
-            // Initialize new characters
-            if (chr != 0)
-            {
-                for (size_t i = s->len; i < len; ++i)
-                    s->buf[i] = chr;
-            }
-            s->buf[len] = '\0';
-            s->len = len;
-        }
-    }
+void mglShadowProvokingVertex(MGLShadowState* shadow, GLenum mode)
+{
+    #ifdef GL_VERSION_3_2
+    glProvokingVertex(mode);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iProvokingVertex), (GLint)mode);
+    mglShadowEndCall(shadow);
+    #endif // /GL_VERSION_3_2
 }
 
-// Appends the specified appendix to the internal string object
-static void mglStringInternalAppend(MGLStringInternal* s, const MGLStringInternal* appendix)
+void mglShadowClipControl(MGLShadowState* shadow, GLenum origin, GLenum depth)
 {
-    if (s && appendix && appendix->len > 0)
-    {
-        // Resize string and copy appendix into new area
-        size_t lhs_len = s->len;
-        mglStringInternalResize(s, lhs_len + appendix->len, 0);
-        memcpy(s->buf + lhs_len, appendix->buf, appendix->len);
-    }
+    #ifdef GL_VERSION_4_5
+    glClipControl(origin, depth);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iClipOrigin), (GLint)origin);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iClipDepthMode), (GLint)depth);
+    mglShadowEndCall(shadow);
+    #endif // /GL_VERSION_4_5
 }
 
-// Appends the specified appendix sub-string (with offset and length) to the internal string object
-static void mglStringInternalAppendSub(MGLStringInternal* s, const MGLStringInternal* appendix, size_t off, size_t len)
+void mglShadowHint(MGLShadowState* shadow, GLenum target, GLenum mode)
 {
-    if (s && appendix && appendix->len > off && len > 0)
+    glHint(target, mode);
+    switch (target)
     {
-        // Resize string and copy appendix into new area
-        size_t lhs_len = s->len;
-        size_t rhs_len = MGL_MIN(len, appendix->len - off);
-        if (rhs_len > 0)
-        {
-            mglStringInternalResize(s, lhs_len + rhs_len, 0);
-            memcpy(s->buf + lhs_len, appendix->buf + off, rhs_len);
-        }
+        case GL_LINE_SMOOTH_HINT:                   mglShadowStoreInteger(shadow, &(shadow->render_state.iLineSmoothHint), (GLint)mode); break;
+        case GL_POLYGON_SMOOTH_HINT:                mglShadowStoreInteger(shadow, &(shadow->render_state.iPolygonSmoothHint), (GLint)mode); break;
+        #ifdef GL_VERSION_1_3
+        case GL_TEXTURE_COMPRESSION_HINT:           mglShadowStoreInteger(shadow, &(shadow->render_state.iTextureCompressionHint), (GLint)mode); break;
+        #endif // /GL_VERSION_1_3
+        #ifdef GL_VERSION_2_0
+        case GL_FRAGMENT_SHADER_DERIVATIVE_HINT:    mglShadowStoreInteger(shadow, &(shadow->render_state.iFragmentShaderDerivativeHint), (GLint)mode); break;
+        #endif // /GL_VERSION_2_0
     }
+    mglShadowEndCall(shadow);
 }
 
-// Appends the specified appendix to the internal string object
-static void mglStringInternalAppendCStr(MGLStringInternal* s, const char* appendix)
+void mglShadowPixelStorei(MGLShadowState* shadow, GLenum pname, GLint param)
 {
-    if (s && appendix && *appendix != '\0')
+    glPixelStorei(pname, param);
+    switch (pname)
     {
-        // Resize string and copy appendix into new area
-        size_t lhs_len = s->len;
-        size_t rhs_len = strlen(appendix);
-        mglStringInternalResize(s, lhs_len + rhs_len, 0);
-        memcpy(s->buf + lhs_len, appendix, rhs_len);
+        case GL_PACK_ALIGNMENT:     mglShadowStoreInteger(shadow, &(shadow->render_state.iPackAlignment), param); break;
+        case GL_PACK_LSB_FIRST:     mglShadowStoreBoolean(shadow, &(shadow->render_state.bPackLSBFirst), (param != 0 ? GL_TRUE : GL_FALSE)); break;
+        case GL_PACK_ROW_LENGTH:    mglShadowStoreInteger(shadow, &(shadow->render_state.iPackRowLength), param); break;
+        case GL_PACK_SKIP_PIXELS:   mglShadowStoreInteger(shadow, &(shadow->render_state.iPackSkipPixels), param); break;
+        case GL_PACK_SKIP_ROWS:     mglShadowStoreInteger(shadow, &(shadow->render_state.iPackSkipRows), param); break;
+        case GL_PACK_SWAP_BYTES:    mglShadowStoreBoolean(shadow, &(shadow->render_state.bPackSwapBytes), (param != 0 ? GL_TRUE : GL_FALSE)); break;
+        case GL_UNPACK_ALIGNMENT:   mglShadowStoreInteger(shadow, &(shadow->render_state.iUnpackAlignment), param); break;
+        case GL_UNPACK_LSB_FIRST:   mglShadowStoreBoolean(shadow, &(shadow->render_state.bUnpackLSBFirst), (param != 0 ? GL_TRUE : GL_FALSE)); break;
+        case GL_UNPACK_ROW_LENGTH:  mglShadowStoreInteger(shadow, &(shadow->render_state.iUnpackRowLength), param); break;
+        case GL_UNPACK_SKIP_PIXELS: mglShadowStoreInteger(shadow, &(shadow->render_state.iUnpackSkipPixels), param); break;
+        case GL_UNPACK_SKIP_ROWS:   mglShadowStoreInteger(shadow, &(shadow->render_state.iUnpackSkipRows), param); break;
+        case GL_UNPACK_SWAP_BYTES:  mglShadowStoreBoolean(shadow, &(shadow->render_state.bUnpackSwapBytes), (param != 0 ? GL_TRUE : GL_FALSE)); break;
+        #ifdef GL_VERSION_1_2
+        case GL_PACK_IMAGE_HEIGHT:  mglShadowStoreInteger(shadow, &(shadow->render_state.iPackImageHeight), param); break;
+        case GL_PACK_SKIP_IMAGES:   mglShadowStoreInteger(shadow, &(shadow->render_state.iPackSkipImages), param); break;
+        case GL_UNPACK_IMAGE_HEIGHT:mglShadowStoreInteger(shadow, &(shadow->render_state.iUnpackImageHeight), param); break;
+        case GL_UNPACK_SKIP_IMAGES: mglShadowStoreInteger(shadow, &(shadow->render_state.iUnpackSkipImages), param); break;
+        #endif // /GL_VERSION_1_2
     }
+    mglShadowEndCall(shadow);
 }
 
-static size_t mglStringInternalFindChar(const MGLStringInternal* s, char search_char, size_t off, size_t len)
+void mglShadowBindBuffer(MGLShadowState* shadow, GLenum target, GLuint buffer)
 {
-    if (s)
+    #ifdef GL_VERSION_1_5
+    glBindBuffer(target, buffer);
+    switch (target)
     {
-        len = MGL_MIN(len, s->len);
-        for (; off < len; ++off)
-        {
-            if (s->buf[off] == search_char)
-                return off;
-        }
+        case GL_ARRAY_BUFFER:               mglShadowStoreInteger(shadow, &(shadow->render_state.iArrayBufferBinding), (GLint)buffer); break;
+        case GL_ELEMENT_ARRAY_BUFFER:       mglShadowStoreInteger(shadow, &(shadow->render_state.iElementArrayBufferBinding), (GLint)buffer); break;
+        #ifdef GL_VERSION_2_1
+        case GL_PIXEL_PACK_BUFFER:          mglShadowStoreInteger(shadow, &(shadow->render_state.iPixelPackBufferBinding), (GLint)buffer); break;
+        case GL_PIXEL_UNPACK_BUFFER:        mglShadowStoreInteger(shadow, &(shadow->render_state.iPixelUnpackBufferBinding), (GLint)buffer); break;
+        #endif // /GL_VERSION_2_1
+        #ifdef GL_VERSION_4_3
+        case GL_DISPATCH_INDIRECT_BUFFER:   mglShadowStoreInteger(shadow, &(shadow->render_state.iDispatchIndirectBufferBinding), (GLint)buffer); break;
+        #endif // /GL_VERSION_4_3
     }
-    return MGL_STRING_NPOS;
+    mglShadowEndCall(shadow);
+    #endif // /GL_VERSION_1_5
 }
 
-static void mglGetIntegers(const GLenum* pnames, GLint* data, GLuint count)
+void mglShadowBindBufferBase(MGLShadowState* shadow, GLenum target, GLuint index, GLuint buffer)
 {
-    for (GLuint i = 0; i < count; ++i)
-        glGetIntegerv(pnames[i], &(data[i]));
+    #ifdef GL_VERSION_3_0
+    glBindBufferBase(target, index, buffer);
+    mglShadowIndexedBufferBinding(shadow, target, index, buffer, 0, 0);
+    mglShadowEndCall(shadow);
+    #endif // /GL_VERSION_3_0
 }
 
-static void mglGetIntegerDynamicArray(GLenum pname, GLint* data, GLuint count, GLuint limit)
+void mglShadowBindBufferRange(MGLShadowState* shadow, GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
 {
-    if (count > limit)
-    {
-        // Allocate temporary container if the array is too small
-        GLint* tmp_data = (GLint*)MGL_CALLOC(GLint, count);
-        glGetIntegerv(pname, tmp_data);
-        memcpy(data, tmp_data, sizeof(GLint)*limit);
-        free(tmp_data);
-    }
-    else
-        glGetIntegerv(pname, data);
+    #ifdef GL_VERSION_3_0
+    glBindBufferRange(target, index, buffer, offset, size);
+    mglShadowIndexedBufferBinding(shadow, target, index, buffer, (GLint64)offset, (GLint64)size);
+    mglShadowEndCall(shadow);
+    #endif // /GL_VERSION_3_0
 }
 
-static void mglGetIntegerStaticArray(GLenum pname, GLint* data, GLuint count)
+void mglShadowUseProgram(MGLShadowState* shadow, GLuint program)
 {
-    #ifdef MENTAL_GL_GETINTEGERI_V
-    for (GLuint i = 0; i < count; ++i)
-        glGetIntegeri_v(pname, i, &(data[i]));
-    #endif
+    #ifdef GL_VERSION_2_0
+    glUseProgram(program);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iCurrentProgram), (GLint)program);
+    mglShadowEndCall(shadow);
+    #endif // /GL_VERSION_2_0
 }
 
-static void mglGetInteger64StaticArray(GLenum pname, GLint64* data, GLuint count)
+void mglShadowBindProgramPipeline(MGLShadowState* shadow, GLuint pipeline)
 {
-    #ifdef MENTAL_GL_GETINTEGER64I_V
-    for (GLuint i = 0; i < count; ++i)
-        glGetInteger64i_v(pname, i, &(data[i]));
-    #endif
+    #ifdef GL_VERSION_4_1
+    glBindProgramPipeline(pipeline);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iProgramPipelineBinding), (GLint)pipeline);
+    mglShadowEndCall(shadow);
+    #endif // /GL_VERSION_4_1
 }
 
-static void mglEnumToHex(char* s, unsigned val)
+void mglShadowBindVertexArray(MGLShadowState* shadow, GLuint array)
 {
-	sprintf(s, "0x%*X", 8, val);
-    for (s += 2; *s == ' '; ++s)
-        *s = '0';
+    #ifdef GL_VERSION_3_0
+    glBindVertexArray(array);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iVertexArrayBinding), (GLint)array);
+    mglShadowQueryVertexArrayStates(shadow);
+    mglShadowEndCall(shadow);
+    #endif // /GL_VERSION_3_0
 }
 
-static void mglNextHeadline(MGLStringPairArray* str_array, const char* headline)
+void mglShadowPrimitiveRestartIndex(MGLShadowState* shadow, GLuint index)
 {
-    mglStringInternalInitWith(&(str_array->first[str_array->index]), headline);
-    mglStringInternalReset(&(str_array->second[str_array->index]));
-    ++(str_array->index);
+    #ifdef GL_VERSION_3_1
+    glPrimitiveRestartIndex(index);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iPrimitiveRestartIndex), (GLint)index);
+    mglShadowEndCall(shadow);
+    #endif // /GL_VERSION_3_1
 }
 
-static void mglNextParamString(MGLStringPairArray* str_array, const char* par, const char* val)
+void mglShadowPatchParameteri(MGLShadowState* shadow, GLenum pname, GLint value)
 {
-    mglStringInternalInitWith(&(str_array->first[str_array->index]), par);
-    mglStringInternalInitWith(&(str_array->second[str_array->index]), val);
-    ++(str_array->index);
+    #ifdef GL_VERSION_4_0
+    glPatchParameteri(pname, value);
+    if (pname == GL_PATCH_VERTICES)
+        mglShadowStoreInteger(shadow, &(shadow->render_state.iPatchVertices), value);
+    mglShadowEndCall(shadow);
+    #endif // /GL_VERSION_4_0
 }
 
-static void mglNextParamInteger(MGLStringPairArray* str_array, const char* par, GLint val)
+void mglShadowBindFramebuffer(MGLShadowState* shadow, GLenum target, GLuint framebuffer)
 {
-    char s_val[16];
-    sprintf(s_val, "%i", val);
-    mglNextParamString(str_array, par, s_val);
+    #ifdef GL_VERSION_3_0
+    glBindFramebuffer(target, framebuffer);
+    if (target == GL_FRAMEBUFFER || target == GL_DRAW_FRAMEBUFFER)
+        mglShadowStoreInteger(shadow, &(shadow->render_state.iDrawFramebufferBinding), (GLint)framebuffer);
+    if (target == GL_FRAMEBUFFER || target == GL_READ_FRAMEBUFFER)
+        mglShadowStoreInteger(shadow, &(shadow->render_state.iReadFramebufferBinding), (GLint)framebuffer);
+    mglShadowQueryFramebufferStates(shadow);
+    mglShadowEndCall(shadow);
+    #endif // /GL_VERSION_3_0
 }
 
-static void mglNextParamUInteger(MGLStringPairArray* str_array, const char* par, GLuint val)
+void mglShadowBindRenderbuffer(MGLShadowState* shadow, GLenum target, GLuint renderbuffer)
 {
-    char s_val[16];
-    sprintf(s_val, "%u", val);
-    mglNextParamString(str_array, par, s_val);
+    #ifdef GL_VERSION_3_0
+    glBindRenderbuffer(target, renderbuffer);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iRenderbufferBinding), (GLint)renderbuffer);
+    mglShadowEndCall(shadow);
+    #endif // /GL_VERSION_3_0
 }
 
-static void mglNextParamIntegerHex(MGLStringPairArray* str_array, const char* par, GLint val)
+void mglShadowDrawBuffer(MGLShadowState* shadow, GLenum buf)
 {
-    char s_hex[11];
-    mglEnumToHex(s_hex, (unsigned)val);
-    mglNextParamString(str_array, par, s_hex);
+    glDrawBuffer(buf);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iDrawBuffer), (GLint)buf);
+    #ifdef GL_VERSION_2_0
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iDrawBuffer_i[0]), (GLint)buf);
+    for (int i = 1; i < 16; ++i)
+        mglShadowStoreInteger(shadow, &(shadow->render_state.iDrawBuffer_i[i]), GL_NONE);
+    #endif // /GL_VERSION_2_0
+    mglShadowEndCall(shadow);
 }
 
-static void mglNextParamBoolean(MGLStringPairArray* str_array, const char* par, GLboolean val)
+void mglShadowDrawBuffers(MGLShadowState* shadow, GLsizei n, const GLenum* bufs)
 {
-    mglNextParamString(str_array, par, (val ? "GL_TRUE" : "GL_FALSE"));
+    #ifdef GL_VERSION_2_0
+    glDrawBuffers(n, bufs);
+    for (GLsizei i = 0; i < 16; ++i)
+        mglShadowStoreInteger(shadow, &(shadow->render_state.iDrawBuffer_i[i]), (i < n ? (GLint)bufs[i] : GL_NONE));
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iDrawBuffer), shadow->render_state.iDrawBuffer_i[0]);
+    mglShadowEndCall(shadow);
+    #endif // /GL_VERSION_2_0
 }
 
-static void mglNextParamEnum(MGLStringPairArray* str_array, const char* par, GLint val, MGLEnumToStringProc proc)
+void mglShadowReadBuffer(MGLShadowState* shadow, GLenum src)
 {
-    const char* s_val = proc(val);
-    if (!s_val)
-    {
-        char s_hex[11];
-        mglEnumToHex(s_hex, (unsigned)val);
-        mglNextParamString(str_array, par, s_hex);
-    }
-    else
-        mglNextParamString(str_array, par, s_val);
+    glReadBuffer(src);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iReadBuffer), (GLint)src);
+    mglShadowEndCall(shadow);
 }
 
-static void mglNextParamInteger64(MGLStringPairArray* str_array, const char* par, GLint64 val)
+void mglShadowActiveTexture(MGLShadowState* shadow, GLenum texture)
 {
-    long long int val_ll = (long long int)val;
-    char s_val[32];
-    sprintf(s_val, "%lli", val_ll);
-    mglNextParamString(str_array, par, s_val);
+    #ifdef GL_VERSION_1_3
+    glActiveTexture(texture);
+    const int changed = (shadow->render_state.iActiveTexture != (GLint)texture);
+    mglShadowStoreInteger(shadow, &(shadow->render_state.iActiveTexture), (GLint)texture);
+    if (changed)
+        mglShadowLoadActiveTextureUnit(shadow);
+    mglShadowEndCall(shadow);
+    #endif // /GL_VERSION_1_3
 }
 
-static void mglNextParamFloat(MGLStringPairArray* str_array, const char* par, GLfloat val)
+void mglShadowBindTexture(MGLShadowState* shadow, GLenum target, GLuint texture)
 {
-    double val_d = (double)val;
-    char s_val[64];
-    sprintf(s_val, "%f", val_d);
-    mglNextParamString(str_array, par, s_val);
+    glBindTexture(target, texture);
+
+    GLint* entry = mglShadowTextureBinding(&(shadow->render_state), target);
+    if (entry != NULL)
+        mglShadowStoreInteger(shadow, entry, (GLint)texture);
+
+    GLint* layers = mglShadowTextureBindingPoints(&(shadow->binding_points), target);
+    const GLint layer = shadow->render_state.iActiveTexture - GL_TEXTURE0;
+    if (layers != NULL && layer >= 0 && layer < MGL_MAX_TEXTURE_LAYERS)
+        layers[layer] = (GLint)texture;
+    mglShadowEndCall(shadow);
 }
 
-static void mglNextParamDouble(MGLStringPairArray* str_array, const char* par, GLdouble val)
+void mglShadowBindSampler(MGLShadowState* shadow, GLuint unit, GLuint sampler)
 {
-    char s_val[64];
-    sprintf(s_val, "%f", val);
-    mglNextParamString(str_array, par, s_val);
+    #ifdef GL_VERSION_3_3
+    glBindSampler(unit, sampler);
+    if (unit < MGL_MAX_TEXTURE_LAYERS)
+        mglShadowStoreInteger(shadow, &(shadow->sampler_bindings[unit]), (GLint)sampler);
+    if ((GLint)unit == shadow->render_state.iActiveTexture - GL_TEXTURE0)
+        mglShadowStoreInteger(shadow, &(shadow->render_state.iSamplerBinding), (GLint)sampler);
+    mglShadowEndCall(shadow);
+    #endif // /GL_VERSION_3_3
 }
 
-static void mglNextParamIntegerArray(MGLStringPairArray* str_array, const char* par, const GLint* val, size_t count, size_t limit, int to_hex)
+MGLRedundancyCounter mglCreateRedundancyCounter(void)
 {
-    char s_val[16];
-
-    MGLStringInternal* out_par = &(str_array->first[str_array->index]);
-    MGLStringInternal* out_val = &(str_array->second[str_array->index]);
+    MGLRedundancyCounterInternal* counter = (MGLRedundancyCounterInternal*)mglAlloc(NULL, sizeof(MGLRedundancyCounterInternal));
+    if (counter == NULL)
+        return NULL;
 
-    mglStringInternalInitWith(out_par, par);
-    mglStringInternalInit(out_val, 0);
-
-    mglStringInternalAppendCStr(out_val, "{ ");
+    // Map each byte of the render state to its field
+    for (size_t i = 0; i < sizeof(MGLRenderState); ++i)
+        counter->fields[i] = MGL_REDUNDANCY_NO_FIELD;
 
-    size_t n = MGL_MIN(count, limit);
+    counter->sampler_binding_field = MGL_REDUNDANCY_NO_FIELD;
 
-    for (size_t i = 0; i < n; ++i)
+    for (size_t i = 0; i < MGL_NUM_RENDER_STATE_FIELDS; ++i)
     {
-        if (to_hex)
-            mglEnumToHex(s_val, (unsigned)val[i]);
-        else
-            sprintf(s_val, "%i", val[i]);
+        const MGLFieldDescriptor* field = &(g_MGLRenderStateFields[i]);
 
-        mglStringInternalAppendCStr(out_val, s_val);
+        for (size_t j = 0; j < mglFieldSize(field); ++j)
+            counter->fields[field->offset + j] = (unsigned short)i;
 
-        if (i + 1 < n)
-            mglStringInternalAppendCStr(out_val, ", ");
+        if (field->offset == offsetof(MGLRenderState, iSamplerBinding))
+            counter->sampler_binding_field = (unsigned short)i;
     }
 
-    if (count > limit)
-        mglStringInternalAppendCStr(out_val, ", ... ");
+    // Start with the unnamed call site
+    counter->sites = (MGLRedundancyCallSite*)mglAlloc(NULL, sizeof(MGLRedundancyCallSite) * 4);
+    if (counter->sites == NULL)
+    {
+        mglFree(NULL, counter, sizeof(MGLRedundancyCounterInternal));
+        return NULL;
+    }
 
-    mglStringInternalAppendCStr(out_val, " }");
+    counter->num_sites  = 1;
+    counter->capacity   = 4;
 
-    ++(str_array->index);
+    return (MGLRedundancyCounter)counter;
 }
 
-static void mglNextParamEnumArray(MGLStringPairArray* str_array, const char* par, const GLint* val, size_t count, size_t limit, MGLEnumToStringProc proc)
+void mglFreeRedundancyCounter(MGLRedundancyCounter counter)
 {
-    MGLStringInternal* out_par = &(str_array->first[str_array->index]);
-    MGLStringInternal* out_val = &(str_array->second[str_array->index]);
+    MGLRedundancyCounterInternal* c = (MGLRedundancyCounterInternal*)counter;
 
-    mglStringInternalInitWith(out_par, par);
-    mglStringInternalInit(out_val, 0);
+    if (c)
+    {
+        mglFree(NULL, c->sites, sizeof(MGLRedundancyCallSite) * c->capacity);
+        mglFree(NULL, c, sizeof(MGLRedundancyCounterInternal));
+    }
+}
 
-    mglStringInternalAppendCStr(out_val, "{ ");
+void mglResetRedundancyCounter(MGLRedundancyCounter counter)
+{
+    MGLRedundancyCounterInternal* c = (MGLRedundancyCounterInternal*)counter;
 
-    size_t n = MGL_MIN(count, limit);
+    memset(c->num_calls, 0, sizeof(c->num_calls));
+    memset(c->num_redundant, 0, sizeof(c->num_redundant));
 
-    for (size_t i = 0; i < n; ++i)
+    for (size_t i = 0; i < c->num_sites; ++i)
     {
-        const char* s_val = proc(val[i]);
-        if (!s_val)
-        {
-            char s_hex[11];
-            mglEnumToHex(s_hex, (unsigned)val[i]);
-            mglStringInternalAppendCStr(out_val, s_hex);
-        }
-        else
-            mglStringInternalAppendCStr(out_val, s_val);
-
-        if (i + 1 < n)
-            mglStringInternalAppendCStr(out_val, ", ");
+        c->sites[i].num_calls       = 0;
+        c->sites[i].num_redundant   = 0;
     }
 
-    if (count > limit)
-        mglStringInternalAppendCStr(out_val, ", ... ");
-
-    mglStringInternalAppendCStr(out_val, " }");
-
-    ++(str_array->index);
+    c->num_call_fields = 0;
 }
 
-static void mglNextParamInteger64Array(MGLStringPairArray* str_array, const char* par, const GLint64* val, size_t count, size_t limit)
+void mglSetRedundancyCallSite(MGLRedundancyCounter counter, const char* site)
 {
-    char s_val[32];
-
-    MGLStringInternal* out_par = &(str_array->first[str_array->index]);
-    MGLStringInternal* out_val = &(str_array->second[str_array->index]);
+    MGLRedundancyCounterInternal* c = (MGLRedundancyCounterInternal*)counter;
 
-    mglStringInternalInitWith(out_par, par);
-    mglStringInternalInit(out_val, 0);
+    // Find call site by its name
+    for (size_t i = 0; i < c->num_sites; ++i)
+    {
+        const char* name = c->sites[i].name;
+        if (name == site || (name != NULL && site != NULL && strcmp(name, site) == 0))
+        {
+            c->site = i;
+            return;
+        }
+    }
 
-    mglStringInternalAppendCStr(out_val, "{ ");
+    // Append new call site; calls are counted for the unnamed call site if the allocation fails
+    if (c->num_sites == c->capacity)
+    {
+        MGLRedundancyCallSite* sites = (MGLRedundancyCallSite*)mglRealloc(NULL, c->sites, sizeof(MGLRedundancyCallSite) * c->capacity, sizeof(MGLRedundancyCallSite) * c->capacity * 2);
+        if (sites == NULL)
+        {
+            c->site = 0;
+            return;
+        }
+        c->sites    = sites;
+        c->capacity = c->capacity * 2;
+    }
 
-    size_t n = MGL_MIN(count, limit);
+    // Reallocated call sites are not initialized
+    memset(&(c->sites[c->num_sites]), 0, sizeof(MGLRedundancyCallSite));
+    c->sites[c->num_sites].name = site;
+    c->site = (c->num_sites)++;
+}
 
-    for (size_t i = 0; i < n; ++i)
-    {
-        sprintf(s_val, "%lli", val[i]);
+size_t mglGetNumRedundantCalls(MGLRedundancyCounter counter, size_t* num_calls)
+{
+    const MGLRedundancyCounterInternal* c = (const MGLRedundancyCounterInternal*)counter;
 
-        mglStringInternalAppendCStr(out_val, s_val);
+    size_t num_redundant = 0, num_total = 0;
 
-        if (i + 1 < n)
-            mglStringInternalAppendCStr(out_val, ", ");
+    for (size_t i = 0; i < c->num_sites; ++i)
+    {
+        num_redundant   += c->sites[i].num_redundant;
+        num_total       += c->sites[i].num_calls;
     }
 
-    if (count > limit)
-        mglStringInternalAppendCStr(out_val, ", ... ");
-
-    mglStringInternalAppendCStr(out_val, " }");
+    if (num_calls != NULL)
+        *num_calls = num_total;
 
-    ++(str_array->index);
+    return num_redundant;
 }
 
-static void mglNextParamBitfield(MGLStringPairArray* str_array, const char* par, GLbitfield val, size_t count, MGLEnumToStringProc proc)
+MGLString mglPrintRedundancyCounter(MGLRedundancyCounter counter, const MGLFormattingOptions* formatting)
 {
-    size_t num_fields = 0;
+    // Internal constant parameters
+    static const char* g_headline       = "\nCALL SITES";
+    static const char* g_unnamedSite    = "<unnamed>";
 
-    MGLStringInternal* out_par = &(str_array->first[str_array->index]);
-    MGLStringInternal* out_val = &(str_array->second[str_array->index]);
+    const MGLRedundancyCounterInternal* c = (const MGLRedundancyCounterInternal*)counter;
 
-    mglStringInternalInitWith(out_par, par);
-    mglStringInternalInit(out_val, 0);
+    if (formatting == NULL)
+        formatting = (&g_MGLFormattingDefault);
 
-    for (size_t i = 0; i < count; ++i)
+    // Provide array with all string parts
+    MGLOutputStringInternal* s = mglOutputStringAcquire(NULL, formatting->allocator);
+    if (s == NULL)
+        return NULL;
+
+    MGLStringPairArray out = mglOutputStringPairs(s, formatting);
+
+    char val[48];
+
+    // Print counts of all selected states with at least one call
+    for (size_t i = 0; i < MGL_NUM_RENDER_STATE_FIELDS; ++i)
     {
-        GLenum flag = (1 << i);
-        if ((val & flag) != 0)
+        const size_t index = mglFieldOrderIndex(g_MGLRenderStateFieldsSorted, i, formatting);
+
+        if (c->num_calls[index] > 0 && mglIsFieldSelected(g_MGLRenderStateFields, index, out.categories, formatting))
         {
-            if (num_fields > 0)
-                mglStringInternalAppendCStr(out_val, " | ");
-            ++num_fields;
+            mglFormatRedundancy(val, c->num_redundant[index], c->num_calls[index]);
+            mglNextParamString(&out, g_MGLRenderStateFields[index].category, g_MGLRenderStateFields[index].name, val);
+        }
+    }
 
-            const char* s_val = proc(flag);
-            if (!s_val)
+    // Print counts of all call sites with at least one call, as long as there are string parts left
+    if (mglIsHeadlineSelected(g_headline, out.categories, formatting))
+    {
+        mglNextHeadline(&out, g_headline);
+
+        for (size_t i = 0; i < c->num_sites && out.index < MGL_MAX_NUM_RENDER_STATES; ++i)
+        {
+            if (c->sites[i].num_calls > 0)
             {
-                char s_hex[11];
-                mglEnumToHex(s_hex, (unsigned)val);
-                mglStringInternalAppendCStr(out_val, s_hex);
+                mglFormatRedundancy(val, c->sites[i].num_redundant, c->sites[i].num_calls);
+                mglNextParamString(&out, MGLStateCategoryAll, (c->sites[i].name != NULL ? c->sites[i].name : g_unnamedSite), val);
             }
-            else
-                mglStringInternalAppendCStr(out_val, s_val);
         }
     }
 
-    if (num_fields == 0)
-        mglStringInternalAppendCStr(out_val, "0");
+    mglPrintStringPairs(out, formatting, &(s->str));
+    mglOutputStringReleaseParts(s);
 
-    ++(str_array->index);
+    return (MGLString)s;
 }
 
-static void mglNextParamFloatArray(MGLStringPairArray* str_array, const char* par, const GLfloat* val, size_t count)
+MGLCapture mglCreateCapture(size_t budget)
 {
-    double val_d;
-    char s_val[64];
-
-    MGLStringInternal* out_par = &(str_array->first[str_array->index]);
-    MGLStringInternal* out_val = &(str_array->second[str_array->index]);
-
-    mglStringInternalInitWith(out_par, par);
-    mglStringInternalInit(out_val, 0);
-
-    mglStringInternalAppendCStr(out_val, "{ ");
+    MGLCaptureInternal* capture = (MGLCaptureInternal*)mglAlloc(NULL, sizeof(MGLCaptureInternal));
+    if (capture == NULL)
+        return NULL;
 
-    for (size_t i = 0; i < count; ++i)
+    capture->ring = (unsigned char*)mglAlloc(NULL, MGL_MAX(budget, MGL_CAPTURE_ENTRY_SIZE));
+    if (capture->ring == NULL)
     {
-        val_d = (double)val[i];
-        sprintf(s_val, "%f", val_d);
-        mglStringInternalAppendCStr(out_val, s_val);
-
-        if (i + 1 < count)
-            mglStringInternalAppendCStr(out_val, ", ");
+        mglFree(NULL, capture, sizeof(MGLCaptureInternal));
+        return NULL;
     }
 
-    mglStringInternalAppendCStr(out_val, " }");
+    capture->capacity   = MGL_MAX(budget, MGL_CAPTURE_ENTRY_SIZE);
+    capture->cursor     = MGL_STRING_NPOS;
 
-    ++(str_array->index);
+    return (MGLCapture)capture;
 }
 
-static void mglNextParamDoubleArray(MGLStringPairArray* str_array, const char* par, const GLdouble* val, size_t count)
+void mglFreeCapture(MGLCapture capture)
 {
-    char s_val[64];
+    MGLCaptureInternal* c = (MGLCaptureInternal*)capture;
 
-    MGLStringInternal* out_par = &(str_array->first[str_array->index]);
-    MGLStringInternal* out_val = &(str_array->second[str_array->index]);
-
-    mglStringInternalInitWith(out_par, par);
-    mglStringInternalInit(out_val, 0);
-
-    mglStringInternalAppendCStr(out_val, "{ ");
-
-    for (size_t i = 0; i < count; ++i)
+    if (c)
     {
-        sprintf(s_val, "%f", val[i]);
-        mglStringInternalAppendCStr(out_val, s_val);
-
-        if (i + 1 < count)
-            mglStringInternalAppendCStr(out_val, ", ");
+        mglFree(NULL, c->ring, c->capacity);
+        mglFree(NULL, c, sizeof(MGLCaptureInternal));
     }
+}
 
-    mglStringInternalAppendCStr(out_val, " }");
-
-    ++(str_array->index);
+void mglBeginCaptureFrame(MGLCapture capture)
+{
+    MGLCaptureInternal* c = (MGLCaptureInternal*)capture;
+
+    c->head         = 0;
+    c->tail         = 0;
+    c->first        = 0;
+    c->count        = 0;
+    c->recording    = 1;
+    c->cursor       = MGL_STRING_NPOS;
 }
 
-static void mglNextParamBooleanArray(MGLStringPairArray* str_array, const char* par, const GLboolean* val, size_t count)
+int mglCaptureRenderState(MGLCapture capture, const MGLRenderState* rs)
 {
-    MGLStringInternal* out_par = &(str_array->first[str_array->index]);
-    MGLStringInternal* out_val = &(str_array->second[str_array->index]);
+    MGLCaptureInternal* c = (MGLCaptureInternal*)capture;
 
-    mglStringInternalInitWith(out_par, par);
-    mglStringInternalInit(out_val, 0);
+    if (!c->recording)
+        return 0;
 
-    mglStringInternalAppendCStr(out_val, "{ ");
+    size_t entry_size = MGL_CAPTURE_ENTRY_SIZE, offset = 0;
 
-    for (size_t i = 0; i < count; ++i)
+    if (c->count > 0)
     {
-        mglStringInternalAppendCStr(out_val, (val[i] != GL_FALSE ? "GL_TRUE" : "GL_FALSE"));
-        if (i + 1 < count)
-            mglStringInternalAppendCStr(out_val, ", ");
+        entry_size = mglCaptureEntrySize(&(c->last), rs);
+        if (entry_size > c->capacity)
+        {
+            // Changes exceed the entire budget, so discard all previous draw calls
+            c->first    += c->count;
+            c->count    = 0;
+            c->head     = 0;
+            c->tail     = 0;
+            c->cursor   = MGL_STRING_NPOS;
+        }
+        else
+            offset = mglReserveCaptureEntry(c, entry_size);
     }
 
-    mglStringInternalAppendCStr(out_val, " }");
+    if (c->count == 0)
+    {
+        // The oldest entry is always represented by the base render state (i.e. the keyframe), so it does not store any changes
+        entry_size  = MGL_CAPTURE_ENTRY_SIZE;
+        c->base     = *rs;
+        c->last     = *rs;
+        c->head     = offset;
+    }
+
+    mglWriteCaptureEntry(c->ring + offset, entry_size, &(c->last), rs);
+    c->last = *rs;
+    c->tail = offset + entry_size;
+    ++(c->count);
+
+    return 1;
+}
 
-    ++(str_array->index);
+void mglEndCaptureFrame(MGLCapture capture)
+{
+    ((MGLCaptureInternal*)capture)->recording = 0;
 }
 
+size_t mglGetCaptureRange(MGLCapture capture, size_t* first)
+{
+    const MGLCaptureInternal* c = (const MGLCaptureInternal*)capture;
 
-// *****************************************************************
-//      CONVERSION FUNCTIONS
-// *****************************************************************
+    if (first != NULL)
+        *first = c->first;
 
-static const char* mglHintModeStr(GLenum param)
-{
-    switch (param)
-    {
-        MGL_CASE2STR( GL_FASTEST );
-        MGL_CASE2STR( GL_NICEST );
-        MGL_CASE2STR( GL_DONT_CARE );
-    }
-    return NULL;
+    return c->count;
 }
 
-static const char* mglCullFaceModeStr(GLenum param)
+int mglGetCapturedRenderState(MGLCapture capture, size_t index, MGLRenderState* rs)
 {
-    switch (param)
+    MGLCaptureInternal* c = (MGLCaptureInternal*)capture;
+
+    if (index < c->first || index - c->first >= c->count)
+        return 0;
+
+    // Continue from the previously reconstructed draw call if possible, otherwise start at the oldest entry
+    if (c->cursor == MGL_STRING_NPOS || c->cursor > index)
     {
-        MGL_CASE2STR( GL_FRONT );
-        MGL_CASE2STR( GL_BACK );
-        MGL_CASE2STR( GL_FRONT_AND_BACK );
+        c->cursor           = c->first;
+        c->cursor_offset    = c->head;
+        c->cursor_state     = c->base;
     }
-    return NULL;
-}
 
-static const char* mglPolygonModeStr(GLenum param)
-{
-    switch (param)
+    while (c->cursor < index)
     {
-        MGL_CASE2STR( GL_POINT );
-        MGL_CASE2STR( GL_LINE );
-        MGL_CASE2STR( GL_FILL );
+        c->cursor_offset = mglNextCaptureEntryOffset(c, c->cursor_offset);
+        mglApplyCaptureEntry(&(c->cursor_state), c->ring + c->cursor_offset);
+        ++(c->cursor);
     }
-    return NULL;
+
+    *rs = c->cursor_state;
+
+    return 1;
 }
 
-static const char* mglFrontFaceStr(GLenum param)
+MGLStateStore mglCreateStateStore(size_t capacity)
 {
-    switch (param)
+    MGLStateStoreInternal* store = (MGLStateStoreInternal*)mglAlloc(NULL, sizeof(MGLStateStoreInternal));
+    if (store == NULL)
+        return NULL;
+
+    if (!mglStateStoreReserve(store, MGL_MAX(capacity, 1)))
     {
-        MGL_CASE2STR( GL_CW );
-        MGL_CASE2STR( GL_CCW );
+        mglFree(NULL, store, sizeof(MGLStateStoreInternal));
+        return NULL;
     }
-    return NULL;
+
+    return (MGLStateStore)store;
 }
 
-static const char* mglLogicOpModeStr(GLenum param)
+void mglFreeStateStore(MGLStateStore store)
 {
-    switch (param)
+    MGLStateStoreInternal* s = (MGLStateStoreInternal*)store;
+
+    if (s)
     {
-        MGL_CASE2STR( GL_CLEAR );
-        MGL_CASE2STR( GL_SET );
-        MGL_CASE2STR( GL_COPY );
-        MGL_CASE2STR( GL_COPY_INVERTED );
-        MGL_CASE2STR( GL_NOOP );
-        MGL_CASE2STR( GL_INVERT );
-        MGL_CASE2STR( GL_AND );
-        MGL_CASE2STR( GL_NAND );
-        MGL_CASE2STR( GL_OR );
-        MGL_CASE2STR( GL_NOR );
-        MGL_CASE2STR( GL_XOR );
-        MGL_CASE2STR( GL_EQUIV );
-        MGL_CASE2STR( GL_AND_REVERSE );
-        MGL_CASE2STR( GL_AND_INVERTED );
-        MGL_CASE2STR( GL_OR_REVERSE );
-        MGL_CASE2STR( GL_OR_INVERTED );
+        mglFree(NULL, s->entries, sizeof(MGLStateStoreEntry) * s->capacity);
+        mglFree(NULL, s->table, sizeof(GLuint) * s->table_size);
+        mglFree(NULL, s, sizeof(MGLStateStoreInternal));
     }
-    return NULL;
 }
 
-static const char* mglCompressedTextureInternalFormatStr(GLenum param)
+GLuint mglInternRenderState(MGLStateStore store, const MGLRenderState* rs)
 {
-    switch (param)
-    {
-        #if defined GL_VERSION_1_3
-        MGL_CASE2STR( GL_COMPRESSED_RED );
-        MGL_CASE2STR( GL_COMPRESSED_RG );
-        MGL_CASE2STR( GL_COMPRESSED_RGB );
-        MGL_CASE2STR( GL_COMPRESSED_RGBA );
-        #elif defined GL_ARB_texture_compression
-        MGL_CASE2STR( GL_COMPRESSED_ALPHA_ARB );
-        MGL_CASE2STR( GL_COMPRESSED_LUMINANCE_ARB );
-        MGL_CASE2STR( GL_COMPRESSED_LUMINANCE_ALPHA_ARB );
-        MGL_CASE2STR( GL_COMPRESSED_INTENSITY_ARB );
-        MGL_CASE2STR( GL_COMPRESSED_RGB_ARB );
-        MGL_CASE2STR( GL_COMPRESSED_RGBA_ARB );
-        #endif
+    MGLStateStoreInternal* s = (MGLStateStoreInternal*)store;
 
-        #if defined GL_VERSION_2_1
-        MGL_CASE2STR( GL_COMPRESSED_SRGB );
-        MGL_CASE2STR( GL_COMPRESSED_SRGB_ALPHA );
-        #elif defined GL_EXT_texture_sRGB
-        MGL_CASE2STR( GL_COMPRESSED_SRGB_EXT );
-        MGL_CASE2STR( GL_COMPRESSED_SRGB_ALPHA_EXT );
-        #endif
+    MGLPackedRenderState packed;
+    mglPackRenderState(&packed, rs);
 
-        #if defined GL_EXT_texture_sRGB
-        MGL_CASE2STR( GL_COMPRESSED_SLUMINANCE_EXT );
-        MGL_CASE2STR( GL_COMPRESSED_SLUMINANCE_ALPHA_EXT );
-        MGL_CASE2STR( GL_COMPRESSED_SRGB_S3TC_DXT1_EXT );
-        MGL_CASE2STR( GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT );
-        MGL_CASE2STR( GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT );
-        MGL_CASE2STR( GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT );
-        #endif
+    const unsigned long long hash = mglHashPackedRenderState(&packed);
 
-        #if defined GL_VERSION_3_0
-        MGL_CASE2STR( GL_COMPRESSED_RED_RGTC1 );
-        MGL_CASE2STR( GL_COMPRESSED_SIGNED_RED_RGTC1 );
-        MGL_CASE2STR( GL_COMPRESSED_RG_RGTC2 );
-        MGL_CASE2STR( GL_COMPRESSED_SIGNED_RG_RGTC2 );
-        #elif defined GL_EXT_texture_compression_rgtc
-        MGL_CASE2STR( GL_COMPRESSED_RED_RGTC1_EXT );
-        MGL_CASE2STR( GL_COMPRESSED_SIGNED_RED_RGTC1_EXT );
-        MGL_CASE2STR( GL_COMPRESSED_RED_GREEN_RGTC2_EXT );
-        MGL_CASE2STR( GL_COMPRESSED_SIGNED_RED_GREEN_RGTC2_EXT );
-        #endif
+    // Find identical render state in hash table
+    const size_t mask = s->table_size - 1;
 
-        #if defined GL_VERSION_4_2
-        MGL_CASE2STR( GL_COMPRESSED_RGBA_BPTC_UNORM );
-        MGL_CASE2STR( GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM );
-        MGL_CASE2STR( GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT );
-        MGL_CASE2STR( GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT );
-        #elif defined GL_ARB_texture_compression_bptc
-        MGL_CASE2STR( GL_COMPRESSED_RGBA_BPTC_UNORM_ARB );
-        MGL_CASE2STR( GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM_ARB );
-        MGL_CASE2STR( GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT_ARB );
-        MGL_CASE2STR( GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT_ARB );
-        #endif
+    for (size_t slot = (size_t)hash & mask; s->table[slot] != 0; slot = (slot + 1) & mask)
+    {
+        MGLStateStoreEntry* entry = &(s->entries[s->table[slot] - 1]);
+        if (entry->hash == hash && mglIsSamePackedRenderState(&(entry->state), &packed))
+        {
+            ++(entry->ref_count);
+            return s->table[slot];
+        }
+    }
 
-        #if defined GL_VERSION_4_3
-        MGL_CASE2STR( GL_COMPRESSED_RGB8_ETC2 );
-        MGL_CASE2STR( GL_COMPRESSED_SRGB8_ETC2 );
-        MGL_CASE2STR( GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2 );
-        MGL_CASE2STR( GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2 );
-        MGL_CASE2STR( GL_COMPRESSED_RGBA8_ETC2_EAC );
-        MGL_CASE2STR( GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC );
-        MGL_CASE2STR( GL_COMPRESSED_R11_EAC );
-        MGL_CASE2STR( GL_COMPRESSED_SIGNED_R11_EAC );
-        MGL_CASE2STR( GL_COMPRESSED_RG11_EAC );
-        MGL_CASE2STR( GL_COMPRESSED_SIGNED_RG11_EAC );
-        #endif
+    // Take entry from the free list or append a new one
+    GLuint id = s->first_free;
 
-        #if defined GL_KHR_texture_compression_astc_hdr
-        MGL_CASE2STR( GL_COMPRESSED_RGBA_ASTC_4x4_KHR );
-        MGL_CASE2STR( GL_COMPRESSED_RGBA_ASTC_5x4_KHR );
-        MGL_CASE2STR( GL_COMPRESSED_RGBA_ASTC_5x5_KHR );
-        MGL_CASE2STR( GL_COMPRESSED_RGBA_ASTC_6x5_KHR );
-        MGL_CASE2STR( GL_COMPRESSED_RGBA_ASTC_6x6_KHR );
-        MGL_CASE2STR( GL_COMPRESSED_RGBA_ASTC_8x5_KHR );
-        MGL_CASE2STR( GL_COMPRESSED_RGBA_ASTC_8x6_KHR );
-        MGL_CASE2STR( GL_COMPRESSED_RGBA_ASTC_8x8_KHR );
-        MGL_CASE2STR( GL_COMPRESSED_RGBA_ASTC_10x5_KHR );
-        MGL_CASE2STR( GL_COMPRESSED_RGBA_ASTC_10x6_KHR );
-        MGL_CASE2STR( GL_COMPRESSED_RGBA_ASTC_10x8_KHR );
-        MGL_CASE2STR( GL_COMPRESSED_RGBA_ASTC_10x10_KHR );
-        MGL_CASE2STR( GL_COMPRESSED_RGBA_ASTC_12x10_KHR );
-        MGL_CASE2STR( GL_COMPRESSED_RGBA_ASTC_12x12_KHR );
-        MGL_CASE2STR( GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR );
-        MGL_CASE2STR( GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x4_KHR );
-        MGL_CASE2STR( GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x5_KHR );
-        MGL_CASE2STR( GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x5_KHR );
-        MGL_CASE2STR( GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x6_KHR );
-        MGL_CASE2STR( GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x5_KHR );
-        MGL_CASE2STR( GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x6_KHR );
-        MGL_CASE2STR( GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x8_KHR );
-        MGL_CASE2STR( GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x5_KHR );
-        MGL_CASE2STR( GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x6_KHR );
-        MGL_CASE2STR( GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x8_KHR );
-        MGL_CASE2STR( GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x10_KHR );
-        MGL_CASE2STR( GL_COMPRESSED_SRGB8_ALPHA8_ASTC_12x10_KHR );
-        MGL_CASE2STR( GL_COMPRESSED_SRGB8_ALPHA8_ASTC_12x12_KHR );
-        #endif
+    if (id != 0)
+        s->first_free = s->entries[id - 1].next_free;
+    else
+    {
+        if (s->num_entries == s->capacity && !mglStateStoreReserve(s, s->capacity * 2))
+            return 0;
+        id = (GLuint)(++(s->num_entries));
+    }
 
-        #if defined GL_3DFX_texture_compression_FXT1
-        MGL_CASE2STR( GL_COMPRESSED_RGB_FXT1_3DFX );
-        MGL_CASE2STR( GL_COMPRESSED_RGBA_FXT1_3DFX );
-        #endif
+    MGLStateStoreEntry* entry = &(s->entries[id - 1]);
+    entry->state        = packed;
+    entry->hash         = hash;
+    entry->ref_count    = 1;
+    entry->next_free    = 0;
 
-        #if defined GL_EXT_texture_compression_latc
-        MGL_CASE2STR( GL_COMPRESSED_LUMINANCE_LATC1_EXT );
-        MGL_CASE2STR( GL_COMPRESSED_SIGNED_LUMINANCE_LATC1_EXT );
-        MGL_CASE2STR( GL_COMPRESSED_LUMINANCE_ALPHA_LATC2_EXT );
-        MGL_CASE2STR( GL_COMPRESSED_SIGNED_LUMINANCE_ALPHA_LATC2_EXT );
-        #endif
+    mglStateStoreInsert(s, id);
+    ++(s->num_states);
 
-        #if defined GL_EXT_texture_compression_s3tc
-        MGL_CASE2STR( GL_COMPRESSED_RGB_S3TC_DXT1_EXT );
-        MGL_CASE2STR( GL_COMPRESSED_RGBA_S3TC_DXT1_EXT );
-        MGL_CASE2STR( GL_COMPRESSED_RGBA_S3TC_DXT3_EXT );
-        MGL_CASE2STR( GL_COMPRESSED_RGBA_S3TC_DXT5_EXT );
-        #endif
+    return id;
+}
 
-        #if defined GL_OES_compressed_paletted_texture
-        MGL_CASE2STR( GL_PALETTE4_RGB8_OES );
-        MGL_CASE2STR( GL_PALETTE4_RGBA8_OES );
-        MGL_CASE2STR( GL_PALETTE4_R5_G6_B5_OES );
-        MGL_CASE2STR( GL_PALETTE4_RGBA4_OES );
-        MGL_CASE2STR( GL_PALETTE4_RGB5_A1_OES );
-        MGL_CASE2STR( GL_PALETTE8_RGB8_OES );
-        MGL_CASE2STR( GL_PALETTE8_RGBA8_OES );
-        MGL_CASE2STR( GL_PALETTE8_R5_G6_B5_OES );
-        MGL_CASE2STR( GL_PALETTE8_RGBA4_OES );
-        MGL_CASE2STR( GL_PALETTE8_RGB5_A1_OES );
-        #endif
-    }
-    return NULL;
+void mglRetainRenderState(MGLStateStore store, GLuint id)
+{
+    MGLStateStoreEntry* entry = mglStateStoreEntry((MGLStateStoreInternal*)store, id);
+    if (entry != NULL)
+        ++(entry->ref_count);
 }
 
-#ifdef GL_VERSION_1_3
+void mglReleaseRenderState(MGLStateStore store, GLuint id)
+{
+    MGLStateStoreInternal* s = (MGLStateStoreInternal*)store;
+    MGLStateStoreEntry* entry = mglStateStoreEntry(s, id);
 
-static const char* mglTextureStr(GLenum param)
-{
-    switch (param)
-    {
-        MGL_CASE2STR( GL_TEXTURE0 );
-        MGL_CASE2STR( GL_TEXTURE1 );
-        MGL_CASE2STR( GL_TEXTURE2 );
-        MGL_CASE2STR( GL_TEXTURE3 );
-        MGL_CASE2STR( GL_TEXTURE4 );
-        MGL_CASE2STR( GL_TEXTURE5 );
-        MGL_CASE2STR( GL_TEXTURE6 );
-        MGL_CASE2STR( GL_TEXTURE7 );
-        MGL_CASE2STR( GL_TEXTURE8 );
-        MGL_CASE2STR( GL_TEXTURE9 );
-        MGL_CASE2STR( GL_TEXTURE10 );
-        MGL_CASE2STR( GL_TEXTURE11 );
-        MGL_CASE2STR( GL_TEXTURE12 );
-        MGL_CASE2STR( GL_TEXTURE13 );
-        MGL_CASE2STR( GL_TEXTURE14 );
-        MGL_CASE2STR( GL_TEXTURE15 );
-        MGL_CASE2STR( GL_TEXTURE16 );
-        MGL_CASE2STR( GL_TEXTURE17 );
-        MGL_CASE2STR( GL_TEXTURE18 );
-        MGL_CASE2STR( GL_TEXTURE19 );
-        MGL_CASE2STR( GL_TEXTURE20 );
-        MGL_CASE2STR( GL_TEXTURE21 );
-        MGL_CASE2STR( GL_TEXTURE22 );
-        MGL_CASE2STR( GL_TEXTURE23 );
-        MGL_CASE2STR( GL_TEXTURE24 );
-        MGL_CASE2STR( GL_TEXTURE25 );
-        MGL_CASE2STR( GL_TEXTURE26 );
-        MGL_CASE2STR( GL_TEXTURE27 );
-        MGL_CASE2STR( GL_TEXTURE28 );
-        MGL_CASE2STR( GL_TEXTURE29 );
-        MGL_CASE2STR( GL_TEXTURE30 );
-        MGL_CASE2STR( GL_TEXTURE31 );
+    if (entry != NULL && --(entry->ref_count) == 0)
+    {
+        // Move entry into the free list
+        mglStateStoreRemove(s, id);
+        entry->next_free = s->first_free;
+        s->first_free = id;
+        --(s->num_states);
     }
-    return NULL;
 }
 
-#endif // /GL_VERSION_1_3
+int mglGetInternedRenderState(MGLStateStore store, GLuint id, MGLRenderState* rs, const MGLImplementationLimits* limits)
+{
+    const MGLStateStoreEntry* entry = mglStateStoreEntry((MGLStateStoreInternal*)store, id);
 
-#ifdef GL_VERSION_1_4
+    if (entry == NULL)
+        return 0;
 
-static const char* mglBlendFuncStr(GLenum param)
-{
-    switch (param)
-    {
-        MGL_CASE2STR( GL_ZERO );
-        MGL_CASE2STR( GL_ONE );
-        MGL_CASE2STR( GL_SRC_COLOR );
-        MGL_CASE2STR( GL_ONE_MINUS_SRC_COLOR );
-        MGL_CASE2STR( GL_DST_COLOR );
-        MGL_CASE2STR( GL_ONE_MINUS_DST_COLOR );
-        MGL_CASE2STR( GL_SRC_ALPHA );
-        MGL_CASE2STR( GL_ONE_MINUS_SRC_ALPHA );
-        MGL_CASE2STR( GL_DST_ALPHA );
-        MGL_CASE2STR( GL_ONE_MINUS_DST_ALPHA );
-        MGL_CASE2STR( GL_CONSTANT_COLOR );
-        MGL_CASE2STR( GL_ONE_MINUS_CONSTANT_COLOR );
-        MGL_CASE2STR( GL_CONSTANT_ALPHA );
-        MGL_CASE2STR( GL_ONE_MINUS_CONSTANT_ALPHA );
-        MGL_CASE2STR( GL_SRC_ALPHA_SATURATE );
-        MGL_CASE2STR( GL_SRC1_COLOR );
-        MGL_CASE2STR( GL_ONE_MINUS_SRC1_COLOR );
-        MGL_CASE2STR( GL_SRC1_ALPHA );
-        MGL_CASE2STR( GL_ONE_MINUS_SRC1_ALPHA );
-    }
-    return NULL;
+    mglUnpackRenderState(rs, &(entry->state), limits);
+    return 1;
 }
 
-#endif // /GL_VERSION_1_4
-
-#ifdef GL_VERSION_2_0
-
-static const char* mglBlendEquationModeStr(GLenum param)
+const MGLPackedRenderState* mglGetInternedPackedRenderState(MGLStateStore store, GLuint id)
 {
-    switch (param)
-    {
-        MGL_CASE2STR( GL_FUNC_ADD );
-        MGL_CASE2STR( GL_FUNC_SUBTRACT );
-        MGL_CASE2STR( GL_FUNC_REVERSE_SUBTRACT );
-        MGL_CASE2STR( GL_MIN );
-        MGL_CASE2STR( GL_MAX );
-    }
-    return NULL;
+    const MGLStateStoreEntry* entry = mglStateStoreEntry((MGLStateStoreInternal*)store, id);
+    return (entry != NULL ? &(entry->state) : NULL);
 }
 
-static const char* mglDrawBufferModeStr(GLenum param)
-{
-    switch (param)
-    {
-        MGL_CASE2STR( GL_NONE );
-        MGL_CASE2STR( GL_FRONT_LEFT );
-        MGL_CASE2STR( GL_FRONT_RIGHT );
-        MGL_CASE2STR( GL_BACK_LEFT );
-        MGL_CASE2STR( GL_BACK_RIGHT );
-        MGL_CASE2STR( GL_FRONT );
-        MGL_CASE2STR( GL_BACK );
-        MGL_CASE2STR( GL_LEFT );
-        MGL_CASE2STR( GL_RIGHT );
-        MGL_CASE2STR( GL_FRONT_AND_BACK );
-        MGL_CASE2STR( GL_COLOR_ATTACHMENT0 );
-        MGL_CASE2STR( GL_COLOR_ATTACHMENT1 );
-        MGL_CASE2STR( GL_COLOR_ATTACHMENT2 );
-        MGL_CASE2STR( GL_COLOR_ATTACHMENT3 );
-        MGL_CASE2STR( GL_COLOR_ATTACHMENT4 );
-        MGL_CASE2STR( GL_COLOR_ATTACHMENT5 );
-        MGL_CASE2STR( GL_COLOR_ATTACHMENT6 );
-        MGL_CASE2STR( GL_COLOR_ATTACHMENT7 );
-        MGL_CASE2STR( GL_COLOR_ATTACHMENT8 );
-        MGL_CASE2STR( GL_COLOR_ATTACHMENT9 );
-        MGL_CASE2STR( GL_COLOR_ATTACHMENT10 );
-        MGL_CASE2STR( GL_COLOR_ATTACHMENT11 );
-        MGL_CASE2STR( GL_COLOR_ATTACHMENT12 );
-        MGL_CASE2STR( GL_COLOR_ATTACHMENT13 );
-        MGL_CASE2STR( GL_COLOR_ATTACHMENT14 );
-        MGL_CASE2STR( GL_COLOR_ATTACHMENT15 );
-        #if defined GL_COLOR_ATTACHMENT16 && defined GL_COLOR_ATTACHMENT31
-        MGL_CASE2STR( GL_COLOR_ATTACHMENT16 );
-        MGL_CASE2STR( GL_COLOR_ATTACHMENT17 );
-        MGL_CASE2STR( GL_COLOR_ATTACHMENT18 );
-        MGL_CASE2STR( GL_COLOR_ATTACHMENT19 );
-        MGL_CASE2STR( GL_COLOR_ATTACHMENT20 );
-        MGL_CASE2STR( GL_COLOR_ATTACHMENT21 );
-        MGL_CASE2STR( GL_COLOR_ATTACHMENT22 );
-        MGL_CASE2STR( GL_COLOR_ATTACHMENT23 );
-        MGL_CASE2STR( GL_COLOR_ATTACHMENT24 );
-        MGL_CASE2STR( GL_COLOR_ATTACHMENT25 );
-        MGL_CASE2STR( GL_COLOR_ATTACHMENT26 );
-        MGL_CASE2STR( GL_COLOR_ATTACHMENT27 );
-        MGL_CASE2STR( GL_COLOR_ATTACHMENT28 );
-        MGL_CASE2STR( GL_COLOR_ATTACHMENT29 );
-        MGL_CASE2STR( GL_COLOR_ATTACHMENT30 );
-        MGL_CASE2STR( GL_COLOR_ATTACHMENT31 );
-        #endif
-    }
-    return NULL;
+size_t mglGetNumInternedRenderStates(MGLStateStore store)
+{
+    return ((MGLStateStoreInternal*)store)->num_states;
 }
 
-static const char* mglStencilOpStr(GLenum param)
+MGLContext mglCreateContext(const MGLContextDescriptor* desc)
 {
-    switch (param)
+    const MGLAllocator* allocator = (desc != NULL ? desc->allocator : NULL);
+
+    // Align object to a cache line and pad it to whole cache lines, so it never shares a cache line with other memory
+    const size_t    size    = ((sizeof(MGLContextInternal) + MGL_CACHE_LINE_SIZE - 1) & ~(size_t)(MGL_CACHE_LINE_SIZE - 1)) + MGL_CACHE_LINE_SIZE - 1;
+    char*           memory  = (char*)mglAlloc(allocator, size);
+
+    if (memory == NULL)
+        return NULL;
+
+    const size_t    offset  = (MGL_CACHE_LINE_SIZE - ((size_t)memory & (MGL_CACHE_LINE_SIZE - 1))) & (MGL_CACHE_LINE_SIZE - 1);
+
+    MGLContextInternal* ctx = (MGLContextInternal*)(memory + offset);
+
+    ctx->flags  = (desc != NULL ? desc->flags : 0);
+    ctx->memory = memory;
+    ctx->size   = size;
+
+    if (allocator != NULL)
+        ctx->allocator = *allocator;
+
+    if ((ctx->flags & MGLContextFlagShadowState) != 0)
     {
-        MGL_CASE2STR( GL_KEEP );
-        MGL_CASE2STR( GL_ZERO );
-        MGL_CASE2STR( GL_REPLACE );
-        MGL_CASE2STR( GL_INCR );
-        MGL_CASE2STR( GL_INCR_WRAP );
-        MGL_CASE2STR( GL_DECR );
-        MGL_CASE2STR( GL_DECR_WRAP );
-        MGL_CASE2STR( GL_INVERT );
+        // Shadow state queries the implementation limits itself
+        mglInitShadowState(&(ctx->shadow), desc->verify_interval);
+        ctx->limits = ctx->shadow.limits;
     }
-    return NULL;
+    else
+        mglQueryImplementationLimits(&(ctx->limits));
+
+    return (MGLContext)ctx;
 }
 
-static const char* mglCompareFuncStr(GLenum param)
+void mglFreeContext(MGLContext context)
 {
-    switch (param)
+    MGLContextInternal* ctx = (MGLContextInternal*)context;
+
+    if (ctx)
     {
-        MGL_CASE2STR( GL_NEVER );
-        MGL_CASE2STR( GL_LESS );
-        MGL_CASE2STR( GL_LEQUAL );
-        MGL_CASE2STR( GL_GREATER );
-        MGL_CASE2STR( GL_GEQUAL );
-        MGL_CASE2STR( GL_EQUAL );
-        MGL_CASE2STR( GL_NOTEQUAL );
-        MGL_CASE2STR( GL_ALWAYS );
+        // Keep a copy of the allocator, since it is stored inside the memory block that is released
+        MGLAllocator allocator = ctx->allocator;
+        mglFree((allocator.allocate != NULL ? &allocator : NULL), ctx->memory, ctx->size);
     }
-    return NULL;
 }
 
-static const char* mglProvokingVertexModeStr(GLenum param)
+const MGLImplementationLimits* mglGetContextLimits(MGLContext context)
 {
-    switch (param)
-    {
-        MGL_CASE2STR( GL_UNDEFINED_VERTEX );
-        MGL_CASE2STR( GL_FIRST_VERTEX_CONVENTION );
-        MGL_CASE2STR( GL_LAST_VERTEX_CONVENTION );
-        MGL_CASE2STR( GL_PROVOKING_VERTEX );
-    }
-    return NULL;
+    return &(((MGLContextInternal*)context)->limits);
 }
 
-#endif // /GL_VERSION_2_0
-
-#ifdef GL_VERSION_3_0
-
-static const char* mglContextFlagBitStr(GLenum param)
+MGLShadowState* mglGetContextShadowState(MGLContext context)
 {
-    switch (param)
-    {
-        MGL_CASE2STR( GL_CONTEXT_FLAG_FORWARD_COMPATIBLE_BIT );
-        #ifdef GL_VERSION_4_3
-        MGL_CASE2STR( GL_CONTEXT_FLAG_DEBUG_BIT );
-        #endif
-        #ifdef GL_VERSION_4_5
-        MGL_CASE2STR( GL_CONTEXT_FLAG_ROBUST_ACCESS_BIT );
-        #endif
-    }
-    return NULL;
+    MGLContextInternal* ctx = (MGLContextInternal*)context;
+    return ((ctx->flags & MGLContextFlagShadowState) != 0 ? &(ctx->shadow) : NULL);
 }
 
-#endif
-
-#ifdef GL_VERSION_4_1
-
-static const char* mglImplementationColorReadFormatStr(GLenum param)
+MGLQueryStats* mglGetContextQueryStats(MGLContext context)
 {
-    switch (param)
-    {
-        MGL_CASE2STR( GL_STENCIL_INDEX );
-        MGL_CASE2STR( GL_DEPTH_COMPONENT );
-        MGL_CASE2STR( GL_DEPTH_STENCIL );
-        MGL_CASE2STR( GL_RED );
-        MGL_CASE2STR( GL_GREEN );
-        MGL_CASE2STR( GL_BLUE );
-        MGL_CASE2STR( GL_RGB );
-        MGL_CASE2STR( GL_BGR );
-        MGL_CASE2STR( GL_RGBA );
-        MGL_CASE2STR( GL_BGRA );
-    }
-    return NULL;
+    MGLContextInternal* ctx = (MGLContextInternal*)context;
+    return ((ctx->flags & MGLContextFlagQueryStats) != 0 ? &(ctx->stats) : NULL);
 }
 
-static const char* mglImplementationColorReadTypeStr(GLenum param)
-{
-    switch (param)
-    {
-        MGL_CASE2STR( GL_UNSIGNED_BYTE );
-        MGL_CASE2STR( GL_BYTE );
-        MGL_CASE2STR( GL_UNSIGNED_SHORT );
-        MGL_CASE2STR( GL_SHORT );
-        MGL_CASE2STR( GL_UNSIGNED_INT );
-        MGL_CASE2STR( GL_INT );
-        MGL_CASE2STR( GL_HALF_FLOAT );
-        MGL_CASE2STR( GL_FLOAT );
-        MGL_CASE2STR( GL_UNSIGNED_BYTE_3_3_2 );
-        MGL_CASE2STR( GL_UNSIGNED_BYTE_2_3_3_REV );
-        MGL_CASE2STR( GL_UNSIGNED_SHORT_5_6_5 );
-        MGL_CASE2STR( GL_UNSIGNED_SHORT_5_6_5_REV );
-        MGL_CASE2STR( GL_UNSIGNED_SHORT_4_4_4_4 );
-        MGL_CASE2STR( GL_UNSIGNED_SHORT_4_4_4_4_REV );
-        MGL_CASE2STR( GL_UNSIGNED_SHORT_5_5_5_1 );
-        MGL_CASE2STR( GL_UNSIGNED_SHORT_1_5_5_5_REV );
-        MGL_CASE2STR( GL_UNSIGNED_INT_8_8_8_8 );
-        MGL_CASE2STR( GL_UNSIGNED_INT_8_8_8_8_REV );
-        MGL_CASE2STR( GL_UNSIGNED_INT_10_10_10_2 );
-        MGL_CASE2STR( GL_UNSIGNED_INT_2_10_10_10_REV );
-        MGL_CASE2STR( GL_UNSIGNED_INT_24_8 );
-        MGL_CASE2STR( GL_UNSIGNED_INT_10F_11F_11F_REV );
-        MGL_CASE2STR( GL_UNSIGNED_INT_5_9_9_9_REV );
-        MGL_CASE2STR( GL_FLOAT_32_UNSIGNED_INT_24_8_REV );
-    }
-    return NULL;
+void mglQueryRenderStateWithContext(MGLContext context, MGLRenderState* rs, unsigned categories)
+{
+    MGLContextInternal* ctx = (MGLContextInternal*)context;
+
+    MGLQueryOptions options =
+    {
+        categories,
+        &(ctx->limits),
+        mglGetContextShadowState(context),
+        mglGetContextQueryStats(context),
+        (ctx->allocator.allocate != NULL ? &(ctx->allocator) : NULL)
+    };
+
+    mglQueryRenderStateEx(rs, &options);
 }
 
-#endif // /GL_VERSION_4_1
+// Internal constant tables: texture targets in the same order as g_MGLBindingPointsFields, and all buffer and renderbuffer bindings of MGLRenderState
+static const GLenum g_MGLObjectTextureTargets[] =
+{
+    GL_TEXTURE_1D,
+    GL_TEXTURE_1D_ARRAY,
+    GL_TEXTURE_2D,
+    GL_TEXTURE_2D_ARRAY,
+    GL_TEXTURE_2D_MULTISAMPLE,
+    GL_TEXTURE_2D_MULTISAMPLE_ARRAY,
+    GL_TEXTURE_3D,
+    GL_TEXTURE_BUFFER,
+    GL_TEXTURE_CUBE_MAP,
+    GL_TEXTURE_RECTANGLE,
+};
 
-#ifdef GL_VERSION_4_5
+static const MGLObjectBindingInternal g_MGLObjectBindings[] =
+{
+    { GL_ARRAY_BUFFER,              offsetof(MGLRenderState, iArrayBufferBinding),              1                                           },
+    { GL_ELEMENT_ARRAY_BUFFER,      offsetof(MGLRenderState, iElementArrayBufferBinding),       1                                           },
+    { GL_PIXEL_PACK_BUFFER,         offsetof(MGLRenderState, iPixelPackBufferBinding),          1                                           },
+    { GL_PIXEL_UNPACK_BUFFER,       offsetof(MGLRenderState, iPixelUnpackBufferBinding),        1                                           },
+    { GL_DISPATCH_INDIRECT_BUFFER,  offsetof(MGLRenderState, iDispatchIndirectBufferBinding),   1                                           },
+    { GL_UNIFORM_BUFFER,            offsetof(MGLRenderState, iUniformBufferBinding),            MGL_MAX_UNIFORM_BUFFER_BINDINGS             },
+    { GL_TRANSFORM_FEEDBACK_BUFFER, offsetof(MGLRenderState, iTransformFeedbackBufferBinding),  MGL_MAX_TRANSFORM_FEEDBACK_BUFFER_BINDINGS  },
+    { GL_SHADER_STORAGE_BUFFER,     offsetof(MGLRenderState, iShaderStorageBufferBinding),      MGL_MAX_SHADER_STORAGE_BUFFER_BINDINGS      },
+    { GL_RENDERBUFFER,              offsetof(MGLRenderState, iRenderbufferBinding),             1                                           },
+};
 
-static const char* mglClipOriginStr(GLenum param)
+// Returns the binding pname of the specified texture target
+static GLenum mglTextureBindingName(GLenum target)
 {
-    switch (param)
+    for (size_t i = 0; i < MGL_NUM_BINDING_POINTS_FIELDS; ++i)
     {
-        MGL_CASE2STR( GL_LOWER_LEFT );
-        MGL_CASE2STR( GL_UPPER_LEFT );
+        if (g_MGLObjectTextureTargets[i] == target)
+            return g_MGLBindingPointsFields[i].pname;
     }
-    return NULL;
+    return 0;
 }
 
-static const char* mglClipDepthModeStr(GLenum param)
+// Returns the specified texture level parameter; the texture must be bound to its target unless 'dsa' is non-zero
+static GLint mglGetObjectTextureLevel(const MGLObjectInfo* info, GLint level, GLenum pname, int dsa)
 {
-    switch (param)
+    GLint value = 0;
+
+    #ifdef GL_VERSION_4_5
+    if (dsa)
     {
-        MGL_CASE2STR( GL_NEGATIVE_ONE_TO_ONE );
-        MGL_CASE2STR( GL_ZERO_TO_ONE );
+        glGetTextureLevelParameteriv(info->name, level, pname, &value);
+        return value;
     }
-    return NULL;
+    #else
+    (void)dsa;
+    #endif // /GL_VERSION_4_5
+
+    glGetTexLevelParameteriv((info->target == GL_TEXTURE_CUBE_MAP ? GL_TEXTURE_CUBE_MAP_POSITIVE_X : info->target), level, pname, &value);
+    return value;
 }
 
-#endif // /GL_VERSION_4_5
+// Returns the number of bits per texel of the specified texture level from the sizes of its components
+static GLint mglGetObjectTextureBits(const MGLObjectInfo* info, GLint level, unsigned version, int dsa)
+{
+    #define MGL_VERSION(MAJOR, MINOR)       (((MAJOR) << 16) | (MINOR))
 
-static const MGLStringInternal* g_MGLOutputParamas = NULL;
+    GLint bits = 0;
 
-static int mglCompareOutputPair(const void* lhs, const void* rhs)
-{
-    int lhs_i = *(const int*)lhs;
-    int rhs_i = *(const int*)rhs;
+    bits += mglGetObjectTextureLevel(info, level, GL_TEXTURE_RED_SIZE, dsa);
+    bits += mglGetObjectTextureLevel(info, level, GL_TEXTURE_GREEN_SIZE, dsa);
+    bits += mglGetObjectTextureLevel(info, level, GL_TEXTURE_BLUE_SIZE, dsa);
+    bits += mglGetObjectTextureLevel(info, level, GL_TEXTURE_ALPHA_SIZE, dsa);
 
-    const char* lhs_s = g_MGLOutputParamas[lhs_i].buf;
-    const char* rhs_s = g_MGLOutputParamas[rhs_i].buf;
+    #ifdef GL_VERSION_1_4
+    if (MGL_IS_VERSION_SUPPORTED(version, MGL_VERSION(1, 4)))
+        bits += mglGetObjectTextureLevel(info, level, GL_TEXTURE_DEPTH_SIZE, dsa);
+    #endif // /GL_VERSION_1_4
 
-    if (lhs_s != NULL)
+    #ifdef GL_VERSION_3_0
+    if (MGL_IS_VERSION_SUPPORTED(version, MGL_VERSION(3, 0)))
     {
-        if (rhs_s != NULL)
-            return strcmp(lhs_s, rhs_s);
-        else
-            return -1;
+        bits += mglGetObjectTextureLevel(info, level, GL_TEXTURE_STENCIL_SIZE, dsa);
+        bits += mglGetObjectTextureLevel(info, level, GL_TEXTURE_SHARED_SIZE, dsa);
     }
-    return 1;
-}
+    #endif // /GL_VERSION_3_0
 
+    #undef MGL_VERSION
 
-// *****************************************************************
-//      PUBLIC FUNCTION IMPLEMENTATIONS
-// *****************************************************************
+    return bits;
+}
 
-void mglQueryRenderState(MGLRenderState* rs)
+// Queries dimensions, format, and the estimated size of all levels of the specified texture
+static void mglQueryObjectTexture(MGLObjectInfo* info, unsigned version, int dsa)
 {
-    static const GLenum g_drawBufferPnames[16] = { GL_DRAW_BUFFER0,  GL_DRAW_BUFFER1,  GL_DRAW_BUFFER2,  GL_DRAW_BUFFER3,
-                                                   GL_DRAW_BUFFER4,  GL_DRAW_BUFFER5,  GL_DRAW_BUFFER6,  GL_DRAW_BUFFER7,
-                                                   GL_DRAW_BUFFER8,  GL_DRAW_BUFFER9,  GL_DRAW_BUFFER10, GL_DRAW_BUFFER11,
-                                                   GL_DRAW_BUFFER12, GL_DRAW_BUFFER13, GL_DRAW_BUFFER14, GL_DRAW_BUFFER15 };
-
-    // Get last GL error
-    //GLenum last_err = glGetError();
-
-    // Query all OpenGL states
-    memset(rs, 0, sizeof(MGLRenderState));
-
-    // *****************************************************************
-    //      GL_VERSION_1_0
-    // *****************************************************************
-
-    glGetIntegerv(GL_MAJOR_VERSION, &(rs->iMajorVersion));
-    glGetIntegerv(GL_MINOR_VERSION, &(rs->iMinorVersion));
-
-    glGetBooleanv(GL_BLEND, &(rs->bBlend));
-    glGetFloatv(GL_COLOR_CLEAR_VALUE, &(rs->fColorClearValue[0]));
-    glGetBooleanv(GL_COLOR_WRITEMASK, &(rs->bColorWriteMask[0]));
-    glGetBooleanv(GL_CULL_FACE, &(rs->bCullFace));
-    glGetIntegerv(GL_CULL_FACE_MODE, &(rs->iCullFaceMode));
-    glGetDoublev(GL_DEPTH_CLEAR_VALUE, &(rs->dDepthClearValue));
-    glGetIntegerv(GL_DEPTH_FUNC, &(rs->iDepthFunc));
-    glGetDoublev(GL_DEPTH_RANGE, &(rs->dDepthRange[0]));
-    glGetBooleanv(GL_DEPTH_TEST, &(rs->bDepthTest));
-    glGetBooleanv(GL_DEPTH_WRITEMASK, &(rs->bDepthWriteMask));
-    glGetBooleanv(GL_DITHER, &(rs->bDither));
-    glGetBooleanv(GL_DOUBLEBUFFER, &(rs->bDoubleBuffer));
-    glGetIntegerv(GL_DRAW_BUFFER, &(rs->iDrawBuffer));
-    glGetIntegerv(GL_FRONT_FACE, &(rs->iFrontFace));
-    glGetBooleanv(GL_LINE_SMOOTH, &(rs->bLineSmooth));
-    glGetIntegerv(GL_LINE_SMOOTH_HINT, &(rs->iLineSmoothHint));
-    glGetFloatv(GL_LINE_WIDTH, &(rs->fLineWidth));
-    glGetIntegerv(GL_LOGIC_OP_MODE, &(rs->iLogicOpMode));
-    glGetIntegerv(GL_MAX_TEXTURE_SIZE, &(rs->iMaxTextureSize));
-    glGetIntegerv(GL_MAX_VIEWPORT_DIMS, &(rs->iMaxViewportDims[0]));
-    glGetIntegerv(GL_PACK_ALIGNMENT, &(rs->iPackAlignment));
-    glGetBooleanv(GL_PACK_LSB_FIRST, &(rs->bPackLSBFirst));
-    glGetIntegerv(GL_PACK_ROW_LENGTH, &(rs->iPackRowLength));
-    glGetIntegerv(GL_PACK_SKIP_PIXELS, &(rs->iPackSkipPixels));
-    glGetIntegerv(GL_PACK_SKIP_ROWS, &(rs->iPackSkipRows));
-    glGetBooleanv(GL_PACK_SWAP_BYTES, &(rs->bPackSwapBytes));
-    glGetFloatv(GL_POINT_SIZE, &(rs->fPointSize));
-    glGetFloatv(GL_POINT_SIZE_GRANULARITY, &(rs->fPointSizeGranularity));
-    glGetFloatv(GL_POINT_SIZE_RANGE, &(rs->fPointSizeRange[0]));
-    glGetIntegerv(GL_POLYGON_MODE, &(rs->iPolygonMode[0]));
-    glGetBooleanv(GL_POLYGON_SMOOTH, &(rs->bPolygonSmooth));
-    glGetIntegerv(GL_POLYGON_SMOOTH_HINT, &(rs->iPolygonSmoothHint));
-    glGetIntegerv(GL_READ_BUFFER, &(rs->iReadBuffer));
-    glGetIntegerv(GL_SCISSOR_BOX, &(rs->iScissorBox[0]));
-    glGetBooleanv(GL_SCISSOR_TEST, &(rs->bScissorTest));
-    glGetIntegerv(GL_STENCIL_CLEAR_VALUE, &(rs->iStencilClearValue));
-    glGetIntegerv(GL_STENCIL_FAIL, &(rs->iStencilFail));
-    glGetIntegerv(GL_STENCIL_FUNC, &(rs->iStencilFunc));
-    glGetIntegerv(GL_STENCIL_PASS_DEPTH_FAIL, &(rs->iStencilPassDepthFail));
-    glGetIntegerv(GL_STENCIL_PASS_DEPTH_PASS, &(rs->iStencilPassDepthPass));
-    glGetIntegerv(GL_STENCIL_REF, &(rs->iStencilRef));
-    glGetBooleanv(GL_STENCIL_TEST, &(rs->bStencilTest));
-    glGetIntegerv(GL_STENCIL_VALUE_MASK, &(rs->iStencilValueMask));
-    glGetIntegerv(GL_STENCIL_WRITEMASK, &(rs->iStencilWriteMask));
-    glGetBooleanv(GL_STEREO, &(rs->bStereo));
-    glGetIntegerv(GL_SUBPIXEL_BITS, &(rs->iSubPixelBits));
-    glGetIntegerv(GL_TEXTURE_BINDING_1D, &(rs->iTextureBinding1D));
-    glGetIntegerv(GL_TEXTURE_BINDING_2D, &(rs->iTextureBinding2D));
-    glGetIntegerv(GL_UNPACK_ALIGNMENT, &(rs->iUnpackAlignment));
-    glGetBooleanv(GL_UNPACK_LSB_FIRST, &(rs->bUnpackLSBFirst));
-    glGetIntegerv(GL_UNPACK_ROW_LENGTH, &(rs->iUnpackRowLength));
-    glGetIntegerv(GL_UNPACK_SKIP_PIXELS, &(rs->iUnpackSkipPixels));
-    glGetIntegerv(GL_UNPACK_SKIP_ROWS, &(rs->iUnpackSkipRows));
-    glGetBooleanv(GL_UNPACK_SWAP_BYTES, &(rs->bUnpackSwapBytes));
-    glGetIntegerv(GL_VIEWPORT, &(rs->iViewport[0]));
-
     #define MGL_VERSION(MAJOR, MINOR)       (((MAJOR) << 16) | (MINOR))
-    #define MGL_VERSION_MIN(MAJOR, MINOR)   (MGL_VERSION(rs->iMajorVersion, rs->iMinorVersion) >= MGL_VERSION(MAJOR, MINOR))
-
-    // *****************************************************************
-    //      GL_VERSION_1_1
-    // *****************************************************************
-
-    #ifdef GL_VERSION_1_1
-    if (MGL_VERSION_MIN(1, 1))
-    {
-        glGetBooleanv(GL_COLOR_LOGIC_OP, &(rs->bColorLogicOp));
-        glGetFloatv(GL_POLYGON_OFFSET_FACTOR, &(rs->fPolygonOffsetFactor));
-        glGetFloatv(GL_POLYGON_OFFSET_UNITS, &(rs->fPolygonOffsetUnits));
-        glGetBooleanv(GL_POLYGON_OFFSET_FILL, &(rs->bPolygonOffsetFill));
-        glGetBooleanv(GL_POLYGON_OFFSET_LINE, &(rs->bPolygonOffsetLine));
-        glGetBooleanv(GL_POLYGON_OFFSET_POINT, &(rs->bPolygonOffsetPoint));
-    }
-    #endif // /GL_VERSION_1_1
 
-    // *****************************************************************
-    //      GL_VERSION_1_2
-    // *****************************************************************
+    info->width             = mglGetObjectTextureLevel(info, 0, GL_TEXTURE_WIDTH, dsa);
+    info->height            = mglGetObjectTextureLevel(info, 0, GL_TEXTURE_HEIGHT, dsa);
+    info->depth             = 1;
+    info->internal_format   = mglGetObjectTextureLevel(info, 0, GL_TEXTURE_INTERNAL_FORMAT, dsa);
 
     #ifdef GL_VERSION_1_2
-    if (MGL_VERSION_MIN(1, 2))
-    {
-        glGetFloatv(GL_ALIASED_LINE_WIDTH_RANGE, &(rs->fAliasedLineWidthRange[0]));
-        glGetFloatv(GL_BLEND_COLOR, &(rs->fBlendColor[0]));
-        glGetIntegerv(GL_MAX_3D_TEXTURE_SIZE, &(rs->iMax3DTextureSize));
-        glGetIntegerv(GL_MAX_ELEMENTS_INDICES, &(rs->iMaxElementsIndices));
-        glGetIntegerv(GL_MAX_ELEMENTS_VERTICES, &(rs->iMaxElementsVertices));
-        glGetIntegerv(GL_PACK_IMAGE_HEIGHT, &(rs->iPackImageHeight));
-        glGetIntegerv(GL_PACK_SKIP_IMAGES, &(rs->iPackSkipImages));
-        glGetFloatv(GL_SMOOTH_LINE_WIDTH_RANGE, &(rs->fSmoothLineWidthRange[0]));
-        glGetFloatv(GL_SMOOTH_LINE_WIDTH_GRANULARITY, &(rs->fSmoothLineWidthGranularity));
-        glGetIntegerv(GL_TEXTURE_BINDING_3D, &(rs->iTextureBinding3D));
-        glGetIntegerv(GL_UNPACK_IMAGE_HEIGHT, &(rs->iUnpackImageHeight));
-        glGetIntegerv(GL_UNPACK_SKIP_IMAGES, &(rs->iUnpackSkipImages));
-    }
+    if (MGL_IS_VERSION_SUPPORTED(version, MGL_VERSION(1, 2)))
+        info->depth = mglGetObjectTextureLevel(info, 0, GL_TEXTURE_DEPTH, dsa);
     #endif // /GL_VERSION_1_2
 
-    // *****************************************************************
-    //      GL_VERSION_1_3
-    // *****************************************************************
+    #ifdef GL_VERSION_3_2
+    if (MGL_IS_VERSION_SUPPORTED(version, MGL_VERSION(3, 2)))
+        info->samples = mglGetObjectTextureLevel(info, 0, GL_TEXTURE_SAMPLES, dsa);
+    #endif // /GL_VERSION_3_2
 
-    #ifdef GL_VERSION_1_3
-    if (MGL_VERSION_MIN(1, 3))
+    // Memory of buffer textures is owned by their buffer
+    if (info->target == GL_TEXTURE_BUFFER || info->width <= 0)
     {
-        glGetIntegerv(GL_NUM_COMPRESSED_TEXTURE_FORMATS, &(rs->iNumCompressedTextureFormats));
-        mglGetIntegerDynamicArray(GL_COMPRESSED_TEXTURE_FORMATS, &(rs->iCompressedTextureFormats[0]), rs->iNumCompressedTextureFormats, MGL_MAX_COMPRESSED_TEXTURE_FORMATS);
-        glGetIntegerv(GL_TEXTURE_BINDING_CUBE_MAP, &(rs->iTextureBindingCubeMap));
-        glGetIntegerv(GL_TEXTURE_COMPRESSION_HINT, &(rs->iTextureCompressionHint));
-        glGetIntegerv(GL_ACTIVE_TEXTURE, &(rs->iActiveTexture));
-        glGetIntegerv(GL_MAX_CUBE_MAP_TEXTURE_SIZE, &(rs->iMaxCubeMapTextureSize));
-        glGetIntegerv(GL_SAMPLE_BUFFERS, &(rs->iSampleBuffers));
-        glGetFloatv(GL_SAMPLE_COVERAGE_VALUE, &(rs->fSampleCoverageValue));
-        glGetBooleanv(GL_SAMPLE_COVERAGE_INVERT, &(rs->bSampleCoverageInvert));
-        glGetIntegerv(GL_SAMPLES, &(rs->iSamples));
+        info->num_levels = (info->width > 0 ? 1 : 0);
+        return;
     }
-    #endif // /GL_VERSION_1_3
 
-    // *****************************************************************
-    //      GL_VERSION_1_4
-    // *****************************************************************
+    // Only query the levels of a full MIP-map chain, since higher levels are invalid
+    GLint max_levels = 1;
 
-    #ifdef GL_VERSION_1_4
-    if (MGL_VERSION_MIN(1, 4))
+    if (info->target != GL_TEXTURE_RECTANGLE && info->target != GL_TEXTURE_2D_MULTISAMPLE && info->target != GL_TEXTURE_2D_MULTISAMPLE_ARRAY)
     {
-        glGetIntegerv(GL_BLEND_DST_ALPHA, &(rs->iBlendDstAlpha));
-        glGetIntegerv(GL_BLEND_DST_RGB, &(rs->iBlendDstRGB));
-        glGetIntegerv(GL_BLEND_SRC_ALPHA, &(rs->iBlendSrcAlpha));
-        glGetIntegerv(GL_BLEND_SRC_RGB, &(rs->iBlendSrcRGB));
-        glGetFloatv(GL_MAX_TEXTURE_LOD_BIAS, &(rs->fMaxTextureLODBias));
-        glGetFloatv(GL_POINT_FADE_THRESHOLD_SIZE, &(rs->fPointFadeThresholdSize));
+        const int   is_array    = (info->target == GL_TEXTURE_1D_ARRAY || info->target == GL_TEXTURE_2D_ARRAY || info->target == GL_TEXTURE_CUBE_MAP_ARRAY);
+        GLint       extent      = MGL_MAX(info->width, (info->target != GL_TEXTURE_1D_ARRAY ? info->height : 1));
+
+        if (!is_array)
+            extent = MGL_MAX(extent, info->depth);
+        while ((extent >>= 1) > 0 && max_levels < MGL_MAX_OBJECT_LEVELS)
+            ++max_levels;
     }
-    #endif // /GL_VERSION_1_4
 
-    // *****************************************************************
-    //      GL_VERSION_1_5
-    // *****************************************************************
+    const unsigned long long faces = (info->target == GL_TEXTURE_CUBE_MAP ? 6 : 1);
 
-    #ifdef GL_VERSION_1_5
-    if (MGL_VERSION_MIN(1, 5))
+    for (GLint level = 0; level < max_levels; ++level)
     {
-        glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &(rs->iArrayBufferBinding));
-        glGetIntegerv(GL_ELEMENT_ARRAY_BUFFER_BINDING, &(rs->iElementArrayBufferBinding));
-    }
-    #endif // /GL_VERSION_1_5
+        const GLint width   = (level == 0 ? info->width : mglGetObjectTextureLevel(info, level, GL_TEXTURE_WIDTH, dsa));
+        const GLint height  = (level == 0 ? info->height : mglGetObjectTextureLevel(info, level, GL_TEXTURE_HEIGHT, dsa));
+        GLint       depth   = 1;
 
-    // *****************************************************************
-    //      GL_VERSION_1_5
-    // *****************************************************************
+        if (width <= 0)
+            break;
 
-    #ifdef GL_VERSION_2_0
-    if (MGL_VERSION_MIN(2, 0))
-    {
-        glGetIntegerv(GL_BLEND_EQUATION_ALPHA, &(rs->iBlendEquationAlpha));
-        glGetIntegerv(GL_BLEND_EQUATION_RGB, &(rs->iBlendEquationRGB));
-        glGetIntegerv(GL_CURRENT_PROGRAM, &(rs->iCurrentProgram));
-        mglGetIntegers(g_drawBufferPnames, &(rs->iDrawBuffer_i[0]), 16);
-        glGetIntegerv(GL_FRAGMENT_SHADER_DERIVATIVE_HINT, &(rs->iFragmentShaderDerivativeHint));
-        glGetIntegerv(GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS, &(rs->iMaxCombinedTextureImageUnits));
-        glGetIntegerv(GL_MAX_DRAW_BUFFERS, &(rs->iMaxDrawBuffers));
-        glGetIntegerv(GL_MAX_FRAGMENT_UNIFORM_COMPONENTS, &(rs->iMaxFragmentUniformComponents));
-        glGetIntegerv(GL_MAX_TEXTURE_IMAGE_UNITS, &(rs->iMaxTextureImageUnits));
-        glGetIntegerv(GL_MAX_VARYING_FLOATS, &(rs->iMaxVaryingFloats));
-        glGetIntegerv(GL_MAX_VERTEX_ATTRIBS, &(rs->iMaxVertexAttribs));
-        glGetIntegerv(GL_MAX_VERTEX_TEXTURE_IMAGE_UNITS, &(rs->iMaxVertexTextureImageUnits));
-        glGetIntegerv(GL_MAX_VERTEX_UNIFORM_COMPONENTS, &(rs->iMaxVertexUniformComponents));
-        glGetIntegerv(GL_STENCIL_BACK_FAIL, &(rs->iStencilBackFail));
-        glGetIntegerv(GL_STENCIL_BACK_FUNC, &(rs->iStencilBackFunc));
-        glGetIntegerv(GL_STENCIL_BACK_PASS_DEPTH_FAIL, &(rs->iStencilBackPassDepthFail));
-        glGetIntegerv(GL_STENCIL_BACK_PASS_DEPTH_PASS, &(rs->iStencilBackPassDepthPass));
-        glGetIntegerv(GL_STENCIL_BACK_REF, &(rs->iStencilBackRef));
-        glGetIntegerv(GL_STENCIL_BACK_VALUE_MASK, &(rs->iStencilBackValueMask));
-        glGetIntegerv(GL_STENCIL_BACK_WRITEMASK, &(rs->iStencilBackWriteMask));
-    }
-    #endif // /GL_VERSION_2_0
+        #ifdef GL_VERSION_1_2
+        if (MGL_IS_VERSION_SUPPORTED(version, MGL_VERSION(1, 2)))
+            depth = (level == 0 ? info->depth : mglGetObjectTextureLevel(info, level, GL_TEXTURE_DEPTH, dsa));
+        #endif // /GL_VERSION_1_2
 
-    // *****************************************************************
-    //      GL_VERSION_2_1
-    // *****************************************************************
+        unsigned long long bytes = 0;
 
-    #ifdef GL_VERSION_2_1
-    if (MGL_VERSION_MIN(2, 1))
-    {
-        glGetIntegerv(GL_PIXEL_PACK_BUFFER_BINDING, &(rs->iPixelPackBufferBinding));
-        glGetIntegerv(GL_PIXEL_UNPACK_BUFFER_BINDING, &(rs->iPixelUnpackBufferBinding));
+        #ifdef GL_VERSION_1_3
+        if (MGL_IS_VERSION_SUPPORTED(version, MGL_VERSION(1, 3)) && mglGetObjectTextureLevel(info, level, GL_TEXTURE_COMPRESSED, dsa) != GL_FALSE)
+            bytes = (unsigned long long)mglGetObjectTextureLevel(info, level, GL_TEXTURE_COMPRESSED_IMAGE_SIZE, dsa);
+        else
+        #endif // /GL_VERSION_1_3
+        {
+            const unsigned long long texels = (unsigned long long)width * (unsigned long long)MGL_MAX(height, 1) * (unsigned long long)MGL_MAX(depth, 1);
+            bytes = (texels * (unsigned long long)mglGetObjectTextureBits(info, level, version, dsa) + 7) / 8;
+        }
+
+        info->bytes += bytes * faces * (unsigned long long)MGL_MAX(info->samples, 1);
+        ++(info->num_levels);
     }
-    #endif // /GL_VERSION_2_1
 
-    // *****************************************************************
-    //      GL_VERSION_3_0
-    // *****************************************************************
+    #undef MGL_VERSION
+}
 
-    #ifdef GL_VERSION_3_0
-    if (MGL_VERSION_MIN(3, 0))
-    {
-        glGetIntegerv(GL_NUM_EXTENSIONS, &(rs->iNumExtensions));
-
-        glGetIntegerv(GL_CONTEXT_FLAGS, &(rs->iContextFlags));
-        glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &(rs->iDrawFramebufferBinding));
-        glGetIntegerv(GL_MAX_ARRAY_TEXTURE_LAYERS, &(rs->iMaxArrayTextureLayers));
-        glGetIntegerv(GL_MAX_CLIP_DISTANCES, &(rs->iMaxClipDistances));
-        glGetIntegerv(GL_MAX_RENDERBUFFER_SIZE, &(rs->iMaxRenderbufferSize));
-        glGetIntegerv(GL_MAX_VARYING_COMPONENTS, &(rs->iMaxVaryingComponents));
-        glGetIntegerv(GL_MIN_PROGRAM_TEXEL_OFFSET, &(rs->iMinProgramTexelOffest));
-        glGetIntegerv(GL_MAX_PROGRAM_TEXEL_OFFSET, &(rs->iMaxProgramTexelOffest));
-        glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &(rs->iReadFramebufferBinding));
-        glGetIntegerv(GL_RENDERBUFFER_BINDING, &(rs->iRenderbufferBinding));
-        glGetIntegerv(GL_TEXTURE_BINDING_1D_ARRAY, &(rs->iTextureBinding1DArray));
-        glGetIntegerv(GL_TEXTURE_BINDING_2D_ARRAY, &(rs->iTextureBinding2DArray));
-        mglGetIntegerStaticArray(GL_TRANSFORM_FEEDBACK_BUFFER_BINDING, &(rs->iTransformFeedbackBufferBinding[0]), MGL_MAX_TRANSFORM_FEEDBACK_BUFFER_BINDINGS);
-        mglGetInteger64StaticArray(GL_TRANSFORM_FEEDBACK_BUFFER_SIZE, &(rs->iTransformFeedbackBufferSize[0]), MGL_MAX_TRANSFORM_FEEDBACK_BUFFER_BINDINGS);
-        mglGetInteger64StaticArray(GL_TRANSFORM_FEEDBACK_BUFFER_START, &(rs->iTransformFeedbackBufferStart[0]), MGL_MAX_TRANSFORM_FEEDBACK_BUFFER_BINDINGS);
-        glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &(rs->iVertexArrayBinding));
-    }
-    #endif // /GL_VERSION_3_0
+// Queries the size of the specified buffer; the buffer must be bound to GL_ARRAY_BUFFER unless 'dsa' is non-zero
+static void mglQueryObjectBuffer(MGLObjectInfo* info, unsigned version, int dsa)
+{
+    #define MGL_VERSION(MAJOR, MINOR)       (((MAJOR) << 16) | (MINOR))
 
-    // *****************************************************************
-    //      GL_VERSION_3_1
-    // *****************************************************************
+    info->num_levels = 1;
 
-    #ifdef GL_VERSION_3_1
-    if (MGL_VERSION_MIN(3, 1))
-    {
-        glGetIntegerv(GL_MAX_COMBINED_FRAGMENT_UNIFORM_COMPONENTS, &(rs->iMaxCombinedFragmentUniformComponents));
-        glGetIntegerv(GL_MAX_COMBINED_GEOMETRY_UNIFORM_COMPONENTS, &(rs->iMaxCombinedGeometryUniformComponents));
-        glGetIntegerv(GL_MAX_COMBINED_VERTEX_UNIFORM_COMPONENTS, &(rs->iMaxCombinedVertexUniformComponents));
-        glGetIntegerv(GL_MAX_COMBINED_UNIFORM_BLOCKS, &(rs->iMaxCombinedUniformBlocks));
-        glGetIntegerv(GL_MAX_FRAGMENT_UNIFORM_BLOCKS, &(rs->iMaxFragmentUniformBlocks));
-        glGetIntegerv(GL_MAX_GEOMETRY_UNIFORM_BLOCKS, &(rs->iMaxGeometryUniformBlocks));
-        glGetIntegerv(GL_MAX_VERTEX_UNIFORM_BLOCKS, &(rs->iMaxVertexUniformBlocks));
-        glGetIntegerv(GL_MAX_RECTANGLE_TEXTURE_SIZE, &(rs->iMaxRectangleTextureSize));
-        glGetIntegerv(GL_MAX_TEXTURE_BUFFER_SIZE, &(rs->iMaxTextureBufferSize));
-        glGetIntegerv(GL_MAX_UNIFORM_BUFFER_BINDINGS, &(rs->iMaxUniformBufferBindings));
-        glGetIntegerv(GL_MAX_UNIFORM_BLOCK_SIZE, &(rs->iMaxUniformBlockSize));
-        glGetIntegerv(GL_PRIMITIVE_RESTART_INDEX, &(rs->iPrimitiveRestartIndex));
-        glGetIntegerv(GL_TEXTURE_BINDING_BUFFER, &(rs->iTextureBindingBuffer));
-        glGetIntegerv(GL_TEXTURE_BINDING_RECTANGLE, &(rs->iTextureBindingRectangle));
-        mglGetIntegerStaticArray(GL_UNIFORM_BUFFER_BINDING, &(rs->iUniformBufferBinding[0]), MGL_MAX_UNIFORM_BUFFER_BINDINGS);
-        mglGetInteger64StaticArray(GL_UNIFORM_BUFFER_SIZE, &(rs->iUniformBufferSize[0]), MGL_MAX_UNIFORM_BUFFER_BINDINGS);
-        mglGetInteger64StaticArray(GL_UNIFORM_BUFFER_START, &(rs->iUniformBufferStart[0]), MGL_MAX_UNIFORM_BUFFER_BINDINGS);
-        glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &(rs->iUniformBufferOffsetAlignment));
+    #ifdef GL_VERSION_4_5
+    if (dsa)
+    {
+        GLint64 size = 0;
+        glGetNamedBufferParameteri64v(info->name, GL_BUFFER_SIZE, &size);
+        info->bytes = (unsigned long long)size;
+        return;
     }
-    #endif // /GL_VERSION_3_1
-
-    // *****************************************************************
-    //      GL_VERSION_3_2
-    // *****************************************************************
+    #else
+    (void)dsa;
+    #endif // /GL_VERSION_4_5
 
     #ifdef GL_VERSION_3_2
-    if (MGL_VERSION_MIN(3, 2))
-    {
-        glGetIntegerv(GL_MAX_COLOR_TEXTURE_SAMPLES, &(rs->iMaxColorTextureSamples));
-        glGetIntegerv(GL_MAX_DEPTH_TEXTURE_SAMPLES, &(rs->iMaxDepthTextureSamples));
-        glGetIntegerv(GL_MAX_INTEGER_SAMPLES, &(rs->iMaxIntegerSamples));
-        glGetIntegerv(GL_MAX_GEOMETRY_INPUT_COMPONENTS, &(rs->iMaxGeometryInputComponents));
-        glGetIntegerv(GL_MAX_GEOMETRY_OUTPUT_COMPONENTS, &(rs->iMaxGeometryOutputComponents));
-        glGetIntegerv(GL_MAX_GEOMETRY_TEXTURE_IMAGE_UNITS, &(rs->iMaxGeometryTextureImageUnits));
-        glGetIntegerv(GL_MAX_GEOMETRY_UNIFORM_COMPONENTS, &(rs->iMaxGeometryUniformComponents));
-        glGetIntegerv(GL_MAX_FRAGMENT_INPUT_COMPONENTS, &(rs->iMaxFragmentInputComponents));
-        glGetIntegerv(GL_MAX_VERTEX_OUTPUT_COMPONENTS, &(rs->iMaxVertexOutputComponents));
-        glGetIntegerv(GL_MAX_SAMPLE_MASK_WORDS, &(rs->iMaxSampleMaskWords));
-        glGetIntegerv(GL_MAX_SERVER_WAIT_TIMEOUT, &(rs->iMaxServerWaitTimeout));
-        glGetBooleanv(GL_PROGRAM_POINT_SIZE, &(rs->bProgramPointSize));
-        glGetIntegerv(GL_PROVOKING_VERTEX, &(rs->iProvokingVertex));
-        glGetIntegerv(GL_TEXTURE_BINDING_2D_MULTISAMPLE, &(rs->iTextureBinding2DMultisample));
-        glGetIntegerv(GL_TEXTURE_BINDING_2D_MULTISAMPLE_ARRAY, &(rs->iTextureBinding2DMultisampleArray));
+    if (MGL_IS_VERSION_SUPPORTED(version, MGL_VERSION(3, 2)))
+    {
+        GLint64 size = 0;
+        glGetBufferParameteri64v(GL_ARRAY_BUFFER, GL_BUFFER_SIZE, &size);
+        info->bytes = (unsigned long long)size;
+        return;
     }
+    #else
+    (void)version;
     #endif // /GL_VERSION_3_2
 
-    // *****************************************************************
-    //      GL_VERSION_3_3
-    // *****************************************************************
+    #ifdef GL_VERSION_1_5
+    GLint size = 0;
+    glGetBufferParameteriv(GL_ARRAY_BUFFER, GL_BUFFER_SIZE, &size);
+    info->bytes = (unsigned long long)MGL_MAX(size, 0);
+    #endif // /GL_VERSION_1_5
 
-    #ifdef GL_VERSION_3_3
-    if (MGL_VERSION_MIN(3, 3))
+    #undef MGL_VERSION
+}
+
+#ifdef GL_VERSION_3_0
+
+// Returns the specified renderbuffer parameter; the renderbuffer must be bound to GL_RENDERBUFFER unless 'dsa' is non-zero
+static GLint mglGetObjectRenderbuffer(const MGLObjectInfo* info, GLenum pname, int dsa)
+{
+    GLint value = 0;
+
+    #ifdef GL_VERSION_4_5
+    if (dsa)
     {
-        glGetIntegerv(GL_MAX_DUAL_SOURCE_DRAW_BUFFERS, &(rs->iMaxDualSourceDrawBuffers));
-        glGetIntegerv(GL_SAMPLER_BINDING, &(rs->iSamplerBinding));
-        glGetInteger64v(GL_TIMESTAMP, &(rs->iTimestamp));
+        glGetNamedRenderbufferParameteriv(info->name, pname, &value);
+        return value;
     }
-    #endif // /GL_VERSION_3_3
+    #else
+    (void)dsa;
+    #endif // /GL_VERSION_4_5
 
-    // *****************************************************************
-    //      GL_VERSION_4_0
-    // *****************************************************************
+    glGetRenderbufferParameteriv(GL_RENDERBUFFER, pname, &value);
+    return value;
+}
 
-    #ifdef GL_VERSION_4_0
-    if (MGL_VERSION_MIN(4, 0))
+// Queries dimensions, format, and the estimated size of the specified renderbuffer
+static void mglQueryObjectRenderbuffer(MGLObjectInfo* info, int dsa)
+{
+    static const GLenum g_sizeNames[] =
     {
-        glGetIntegerv(GL_MAX_TRANSFORM_FEEDBACK_BUFFERS, &(rs->iMaxTransformFeedbackBuffers));
-        glGetIntegerv(GL_PATCH_DEFAULT_INNER_LEVEL, &(rs->iPatchDefaultInnerLevel));
-        glGetIntegerv(GL_PATCH_DEFAULT_OUTER_LEVEL, &(rs->iPatchDefaultOuterLevel));
-        glGetIntegerv(GL_PATCH_VERTICES, &(rs->iPatchVertices));
-    }
-    #endif // /GL_VERSION_4_0
+        GL_RENDERBUFFER_RED_SIZE,
+        GL_RENDERBUFFER_GREEN_SIZE,
+        GL_RENDERBUFFER_BLUE_SIZE,
+        GL_RENDERBUFFER_ALPHA_SIZE,
+        GL_RENDERBUFFER_DEPTH_SIZE,
+        GL_RENDERBUFFER_STENCIL_SIZE,
+    };
+
+    info->width             = mglGetObjectRenderbuffer(info, GL_RENDERBUFFER_WIDTH, dsa);
+    info->height            = mglGetObjectRenderbuffer(info, GL_RENDERBUFFER_HEIGHT, dsa);
+    info->depth             = 1;
+    info->internal_format   = mglGetObjectRenderbuffer(info, GL_RENDERBUFFER_INTERNAL_FORMAT, dsa);
+    info->samples           = mglGetObjectRenderbuffer(info, GL_RENDERBUFFER_SAMPLES, dsa);
+    info->num_levels        = (info->width > 0 ? 1 : 0);
+
+    GLint bits = 0;
+    for (size_t i = 0; i < sizeof(g_sizeNames)/sizeof(g_sizeNames[0]); ++i)
+        bits += mglGetObjectRenderbuffer(info, g_sizeNames[i], dsa);
+
+    const unsigned long long texels = (unsigned long long)MGL_MAX(info->width, 0) * (unsigned long long)MGL_MAX(info->height, 0);
+    info->bytes = (texels * (unsigned long long)bits + 7) / 8 * (unsigned long long)MGL_MAX(info->samples, 1);
+}
 
-    // *****************************************************************
-    //      GL_VERSION_4_1
-    // *****************************************************************
+#endif // /GL_VERSION_3_0
 
-    #ifdef GL_VERSION_4_1
-    if (MGL_VERSION_MIN(4, 1))
+// Queries the specified object with direct state access if 'dsa' is non-zero, or by temporarily binding it to its target
+static void mglQueryObject(MGLObjectInfo* info, unsigned version, int dsa)
+{
+    GLint prev = 0;
+
+    switch (info->type)
     {
-        glGetIntegerv(GL_IMPLEMENTATION_COLOR_READ_FORMAT, &(rs->iImplementationColorReadFormat));
-        glGetIntegerv(GL_IMPLEMENTATION_COLOR_READ_TYPE, &(rs->iImplementationColorReadType));
-        glGetIntegerv(GL_LAYER_PROVOKING_VERTEX, &(rs->iLayerProvokingVertex));
-        glGetIntegerv(GL_MAX_VARYING_VECTORS, &(rs->iMaxVaryingVectors));
-        glGetIntegerv(GL_MAX_VIEWPORTS, &(rs->iMaxViewports));
-        glGetIntegerv(GL_VIEWPORT_BOUNDS_RANGE, &(rs->iViewportBoundsRange[0]));
-        glGetIntegerv(GL_VIEWPORT_INDEX_PROVOKING_VERTEX, &(rs->iViewportIndexProvokingVertex));
-        glGetIntegerv(GL_VIEWPORT_SUBPIXEL_BITS, &(rs->iViewportSubPixelBits));
-        glGetIntegerv(GL_MAX_FRAGMENT_UNIFORM_VECTORS, &(rs->iMaxFragmentUniformVectors));
-        glGetIntegerv(GL_MAX_VERTEX_UNIFORM_VECTORS, &(rs->iMaxVertexUniformVectors));
-        glGetIntegerv(GL_NUM_SHADER_BINARY_FORMATS, &(rs->iNumShaderBinaryFormats));
-        mglGetIntegerDynamicArray(GL_SHADER_BINARY_FORMATS, &(rs->iShaderBinaryFormats[0]), rs->iNumShaderBinaryFormats, MGL_MAX_SHADER_BINARY_FORMATS);
-        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &(rs->iNumProgramBinaryFormats));
-        mglGetIntegerDynamicArray(GL_PROGRAM_BINARY_FORMATS, &(rs->iProgramBinaryFormats[0]), rs->iNumProgramBinaryFormats, MGL_MAX_PROGRAM_BINARY_FORMATS);
-        glGetIntegerv(GL_PROGRAM_PIPELINE_BINDING, &(rs->iProgramPipelineBinding));
-        glGetBooleanv(GL_SHADER_COMPILER, &(rs->bShaderCompiler));
-    }
-    #endif // /GL_VERSION_4_1
+        case MGLObjectTypeTexture:
+            if (!dsa)
+            {
+                const GLenum binding = mglTextureBindingName(info->target);
+                glGetIntegerv(binding, &prev);
+                glBindTexture(info->target, info->name);
+            }
+            mglQueryObjectTexture(info, version, dsa);
+            if (!dsa)
+                glBindTexture(info->target, (GLuint)prev);
+            break;
+
+        case MGLObjectTypeBuffer:
+            #ifdef GL_VERSION_1_5
+            if (!dsa)
+            {
+                glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &prev);
+                glBindBuffer(GL_ARRAY_BUFFER, info->name);
+            }
+            mglQueryObjectBuffer(info, version, dsa);
+            if (!dsa)
+                glBindBuffer(GL_ARRAY_BUFFER, (GLuint)prev);
+            #endif // /GL_VERSION_1_5
+            break;
 
-    // *****************************************************************
-    //      GL_VERSION_4_2
-    // *****************************************************************
+        case MGLObjectTypeRenderbuffer:
+            #ifdef GL_VERSION_3_0
+            if (!dsa)
+            {
+                glGetIntegerv(GL_RENDERBUFFER_BINDING, &prev);
+                glBindRenderbuffer(GL_RENDERBUFFER, info->name);
+            }
+            mglQueryObjectRenderbuffer(info, dsa);
+            if (!dsa)
+                glBindRenderbuffer(GL_RENDERBUFFER, (GLuint)prev);
+            #endif // /GL_VERSION_3_0
+            break;
+    }
+}
 
-    #ifdef GL_VERSION_4_2
-    if (MGL_VERSION_MIN(4, 2))
+// Returns non-zero if the object with the specified type and name is already in the list 'found'
+static int mglIsObjectFound(const MGLObjectInfo* found, size_t num_found, enum MGLObjectType type, GLuint name)
+{
+    for (size_t i = 0; i < num_found; ++i)
     {
-        glGetIntegerv(GL_MAX_COMBINED_ATOMIC_COUNTERS, &(rs->iMaxCombinedAtomicCounters));
-        glGetIntegerv(GL_MAX_VERTEX_ATOMIC_COUNTERS, &(rs->iMaxVertexAtomicCounters));
-        glGetIntegerv(GL_MAX_TESS_CONTROL_ATOMIC_COUNTERS, &(rs->iMaxTessControlAtomicCounters));
-        glGetIntegerv(GL_MAX_TESS_EVALUATION_ATOMIC_COUNTERS, &(rs->iMaxTessEvaluationAtomicCounters));
-        glGetIntegerv(GL_MAX_GEOMETRY_ATOMIC_COUNTERS, &(rs->iMaxGeometryAtomicCounters));
-        glGetIntegerv(GL_MAX_FRAGMENT_ATOMIC_COUNTERS, &(rs->iMaxFragmentAtomicCounters));
-        glGetIntegerv(GL_MIN_MAP_BUFFER_ALIGNMENT, &(rs->iMinMapBufferAlignment));
+        if (found[i].type == type && found[i].name == name)
+            return 1;
     }
-    #endif // /GL_VERSION_4_2
+    return 0;
+}
 
-    // *****************************************************************
-    //      GL_VERSION_4_3
-    // *****************************************************************
+// Queries the specified object and inserts it into 'objects', which keeps the 'max_objects' largest objects sorted by their estimated size
+static void mglInsertObject(MGLObjectInfo* objects, size_t num_objects, size_t max_objects, enum MGLObjectType type, GLenum target, GLuint name, unsigned version, int dsa)
+{
+    MGLObjectInfo info;
+    memset(&info, 0, sizeof(info));
 
-    #ifdef GL_VERSION_4_3
-    if (MGL_VERSION_MIN(4, 3))
+    info.type   = type;
+    info.target = target;
+    info.name   = name;
+
+    mglQueryObject(&info, version, dsa);
+
+    // Find insert position after all objects of at least the same size
+    size_t pos = MGL_MIN(num_objects, max_objects);
+    while (pos > 0 && objects[pos - 1].bytes < info.bytes)
+        --pos;
+
+    if (pos < max_objects)
     {
-        glGetIntegerv(GL_MAX_ELEMENT_INDEX, &(rs->iMaxElementIndex));
-        glGetIntegerv(GL_MAX_COMBINED_COMPUTE_UNIFORM_COMPONENTS, &(rs->iMaxCombinedComputeUniformComponents));
-        glGetIntegerv(GL_MAX_COMBINED_SHADER_STORAGE_BLOCKS, &(rs->iMaxCombinedShaderStorageBlocks));
-        glGetIntegerv(GL_MAX_COMPUTE_UNIFORM_BLOCKS, &(rs->iMaxComputeUniformBlocks));
-        glGetIntegerv(GL_MAX_COMPUTE_TEXTURE_IMAGE_UNITS, &(rs->iMaxComputeTextureImageUnits));
-        glGetIntegerv(GL_MAX_COMPUTE_UNIFORM_COMPONENTS, &(rs->iMaxComputeUniformComponents));
-        glGetIntegerv(GL_MAX_COMPUTE_ATOMIC_COUNTERS, &(rs->iMaxComputeAtomicCounters));
-        glGetIntegerv(GL_MAX_COMPUTE_ATOMIC_COUNTER_BUFFERS, &(rs->iMaxComputeAtomicCounterBuffers));
-        mglGetIntegerStaticArray(GL_MAX_COMPUTE_WORK_GROUP_COUNT, &(rs->iMaxComputeWorkGroupCount[0]), 3);
-        glGetIntegerv(GL_MAX_COMPUTE_WORK_GROUP_INVOCATIONS, &(rs->iMaxComputeWorkGroup));
-        mglGetIntegerStaticArray(GL_MAX_COMPUTE_WORK_GROUP_SIZE, &(rs->iMaxComputeWorkGroupSize[0]), 3);
-        glGetIntegerv(GL_DISPATCH_INDIRECT_BUFFER_BINDING, &(rs->iDispatchIndirectBufferBinding));
-        glGetIntegerv(GL_MAX_DEBUG_GROUP_STACK_DEPTH, &(rs->iMaxDebugGroupStackDepth));
-        glGetIntegerv(GL_DEBUG_GROUP_STACK_DEPTH, &(rs->iDebugGroupStackDepth));
-        glGetIntegerv(GL_MAX_LABEL_LENGTH, &(rs->iMaxLabelLength));
-        glGetIntegerv(GL_MAX_UNIFORM_LOCATIONS, &(rs->iMaxUniformLocations));
-        glGetIntegerv(GL_MAX_FRAMEBUFFER_WIDTH, &(rs->iMaxFramebufferWidth));
-        glGetIntegerv(GL_MAX_FRAMEBUFFER_HEIGHT, &(rs->iMaxFramebufferHeight));
-        glGetIntegerv(GL_MAX_FRAMEBUFFER_LAYERS, &(rs->iMaxFramebufferLayers));
-        glGetIntegerv(GL_MAX_FRAMEBUFFER_SAMPLES, &(rs->iMaxFramebufferSamples));
-        glGetIntegerv(GL_MAX_VERTEX_SHADER_STORAGE_BLOCKS, &(rs->iMaxVertexShaderStorageBlocks));
-        glGetIntegerv(GL_MAX_TESS_CONTROL_SHADER_STORAGE_BLOCKS, &(rs->iMaxTessControlShaderStorageBlocks));
-        glGetIntegerv(GL_MAX_TESS_EVALUATION_SHADER_STORAGE_BLOCKS, &(rs->iMaxTessEvaluationShaderStorageBlocks));
-        glGetIntegerv(GL_MAX_GEOMETRY_SHADER_STORAGE_BLOCKS, &(rs->iMaxGeometryShaderStorageBlocks));
-        glGetIntegerv(GL_MAX_FRAGMENT_SHADER_STORAGE_BLOCKS, &(rs->iMaxFragmentShaderStorageBlocks));
-        glGetIntegerv(GL_MAX_COMPUTE_SHADER_STORAGE_BLOCKS, &(rs->iMaxComputeShaderStorageBlocks));
-        glGetIntegerv(GL_TEXTURE_BUFFER_OFFSET_ALIGNMENT, &(rs->iTextureBufferOffsetAlignment));
-        mglGetIntegerStaticArray(GL_VERTEX_BINDING_DIVISOR, &(rs->iVertexBindingDivisor[0]), MGL_MAX_VERTEX_BUFFER_BINDINGS);
-        mglGetIntegerStaticArray(GL_VERTEX_BINDING_OFFSET, &(rs->iVertexBindingOffset[0]), MGL_MAX_VERTEX_BUFFER_BINDINGS);
-        mglGetIntegerStaticArray(GL_VERTEX_BINDING_STRIDE, &(rs->iVertexBindingStride[0]), MGL_MAX_VERTEX_BUFFER_BINDINGS);
-        glGetIntegerv(GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET, &(rs->iMaxVertexAttribRelativeOffset));
-        glGetIntegerv(GL_MAX_VERTEX_ATTRIB_BINDINGS, &(rs->iMaxVertexAttribBindings));
-        glGetIntegerv(GL_MAX_SHADER_STORAGE_BUFFER_BINDINGS, &(rs->iMaxShaderStorageBufferBindings));
-        mglGetIntegerStaticArray(GL_SHADER_STORAGE_BUFFER_BINDING, &(rs->iShaderStorageBufferBinding[0]), MGL_MAX_SHADER_STORAGE_BUFFER_BINDINGS);
-        glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &(rs->iShaderStorageBufferOffsetAlignment));
-        mglGetInteger64StaticArray(GL_SHADER_STORAGE_BUFFER_SIZE, &(rs->iShaderStorageBufferSize[0]), MGL_MAX_SHADER_STORAGE_BUFFER_BINDINGS);
-        mglGetInteger64StaticArray(GL_SHADER_STORAGE_BUFFER_START, &(rs->iShaderStorageBufferStart[0]), MGL_MAX_SHADER_STORAGE_BUFFER_BINDINGS);
+        const size_t num_moved = MGL_MIN(num_objects, max_objects - 1) - pos;
+        memmove(&(objects[pos + 1]), &(objects[pos]), sizeof(MGLObjectInfo) * num_moved);
+        objects[pos] = info;
     }
-    #endif // /GL_VERSION_4_3
+}
 
-    // *****************************************************************
-    //      GL_VERSION_4_5
-    // *****************************************************************
+void mglQueryBindingPointsWithContext(MGLContext context, MGLBindingPoints* bp)
+{
+    const MGLShadowState* shadow = mglGetContextShadowState(context);
 
-    #ifdef GL_VERSION_4_5
-    if (MGL_VERSION_MIN(4, 5))
+    if (shadow != NULL)
+        memcpy(bp, &(shadow->binding_points), sizeof(MGLBindingPoints));
+    else
     {
-        glGetIntegerv(GL_CLIP_DEPTH_MODE, &(rs->iClipDepthMode));
-        glGetIntegerv(GL_CLIP_ORIGIN, &(rs->iClipOrigin));
+        MGLBindingPointsQueryOptions options = { 0, 0, mglGetContextQueryStats(context) };
+        mglQueryBindingPointsEx(bp, &options);
     }
-    #endif // /GL_VERSION_4_5
-
-    #undef MGL_VERSION
-    #undef MGL_VERSION_MIN
 }
 
-void mglQueryBindingPoints(MGLBindingPoints* bp)
+size_t mglQueryObjects(const MGLRenderState* rs, const MGLBindingPoints* bp, GLuint probe_names, MGLObjectInfo* objects, size_t max_objects)
 {
-    memset(bp, 0, sizeof(MGLBindingPoints));
+    #define MGL_VERSION(MAJOR, MINOR)       (((MAJOR) << 16) | (MINOR))
 
-    GLint iMajorVersion = 0, iMinorVersion = 0;
-    glGetIntegerv(GL_MAJOR_VERSION, &iMajorVersion);
-    glGetIntegerv(GL_MINOR_VERSION, &iMinorVersion);
+    // Bound objects are tracked separately, since 'objects' only keeps the largest ones
+    MGLObjectInfo   bound[MGL_MAX_BOUND_OBJECTS];
+    size_t          num_bound   = 0;
+    size_t          num_objects = 0;
+    GLint           major       = 0;
+    GLint           minor       = 0;
+
+    if (objects == NULL)
+        max_objects = 0;
 
-    #define MGL_VERSION(MAJOR, MINOR)       (((MAJOR) << 16) | (MINOR))
-    #define MGL_VERSION_MIN(MAJOR, MINOR)   (MGL_VERSION(iMajorVersion, iMinorVersion) >= MGL_VERSION(MAJOR, MINOR))
+    glGetIntegerv(GL_MAJOR_VERSION, &major);
+    glGetIntegerv(GL_MINOR_VERSION, &minor);
 
-    #ifdef GL_VERSION_1_3
-    if (MGL_VERSION_MIN(1, 3))
-    {
-        // Store current active texture layer
-        GLint iPrevActiveTexture = 0;
-        glGetIntegerv(GL_ACTIVE_TEXTURE, &iPrevActiveTexture);
+    const unsigned  version = MGL_VERSION(major, minor);
+    const int       dsa     = MGL_IS_VERSION_SUPPORTED(version, MGL_VERSION(4, 5));
 
-        // Query texture types for all layers [GL_TEXTURE0 .. GL_TEXTURE31]
-        for (GLint layer = 0; layer < MGL_MAX_TEXTURE_LAYERS; ++layer)
+    // Collect all distinct bound textures, buffers, and renderbuffers
+    if (bp != NULL)
+    {
+        for (size_t i = 0; i < MGL_NUM_BINDING_POINTS_FIELDS; ++i)
         {
-            glActiveTexture(GL_TEXTURE0 + layer);
-
-            glGetIntegerv(GL_TEXTURE_BINDING_1D, &(bp->iTextureBinding1D[layer]));
-            glGetIntegerv(GL_TEXTURE_BINDING_2D, &(bp->iTextureBinding2D[layer]));
-            glGetIntegerv(GL_TEXTURE_BINDING_3D, &(bp->iTextureBinding3D[layer]));
-            glGetIntegerv(GL_TEXTURE_BINDING_CUBE_MAP, &(bp->iTextureBindingCubeMap[layer]));
+            const GLint* names = (const GLint*)((const char*)bp + g_MGLBindingPointsFields[i].offset);
 
-            #ifdef GL_VERSION_3_0
-            if (MGL_VERSION_MIN(3, 0))
+            for (size_t j = 0; j < MGL_MAX_TEXTURE_LAYERS; ++j)
             {
-                glGetIntegerv(GL_TEXTURE_BINDING_1D_ARRAY, &(bp->iTextureBinding1DArray[layer]));
-                glGetIntegerv(GL_TEXTURE_BINDING_2D_ARRAY, &(bp->iTextureBinding2DArray[layer]));
+                if (names[j] > 0 && !mglIsObjectFound(bound, num_bound, MGLObjectTypeTexture, (GLuint)names[j]))
+                {
+                    bound[num_bound].type   = MGLObjectTypeTexture;
+                    bound[num_bound].target = g_MGLObjectTextureTargets[i];
+                    bound[num_bound].name   = (GLuint)names[j];
+                    ++num_bound;
+                }
             }
-            #endif // /GL_VERSION_3_0
+        }
+    }
 
-            #ifdef GL_VERSION_3_1
-            if (MGL_VERSION_MIN(3, 1))
-            {
-                glGetIntegerv(GL_TEXTURE_BINDING_BUFFER, &(bp->iTextureBindingBuffer[layer]));
-                glGetIntegerv(GL_TEXTURE_BINDING_RECTANGLE, &(bp->iTextureBindingRectangle[layer]));
-            }
-            #endif // /GL_VERSION_3_1
+    if (rs != NULL)
+    {
+        for (size_t i = 0; i < sizeof(g_MGLObjectBindings)/sizeof(g_MGLObjectBindings[0]); ++i)
+        {
+            const MGLObjectBindingInternal* binding = &(g_MGLObjectBindings[i]);
+            const enum MGLObjectType        type    = (binding->target == GL_RENDERBUFFER ? MGLObjectTypeRenderbuffer : MGLObjectTypeBuffer);
+            const GLint*                    names   = (const GLint*)((const char*)rs + binding->offset);
 
-            #ifdef GL_VERSION_3_2
-            if (MGL_VERSION_MIN(3, 2))
+            for (size_t j = 0; j < binding->count; ++j)
             {
-                glGetIntegerv(GL_TEXTURE_BINDING_2D_MULTISAMPLE, &(bp->iTextureBinding2DMultisample[layer]));
-                glGetIntegerv(GL_TEXTURE_BINDING_2D_MULTISAMPLE_ARRAY, &(bp->iTextureBinding2DMultisampleArray[layer]));
+                if (names[j] > 0 && !mglIsObjectFound(bound, num_bound, type, (GLuint)names[j]))
+                {
+                    bound[num_bound].type   = type;
+                    bound[num_bound].target = binding->target;
+                    bound[num_bound].name   = (GLuint)names[j];
+                    ++num_bound;
+                }
             }
-            #endif // /GL_VERSION_3_2
         }
-
-        // Restore previous active texture layer
-        glActiveTexture(iPrevActiveTexture);
     }
-    else
-    #endif // /GL_VERSION_1_3
-    {
-        // Only query first layer for texture types supported up to GL 1.2
-        glGetIntegerv(GL_TEXTURE_BINDING_1D, &(bp->iTextureBinding1D[0]));
-        glGetIntegerv(GL_TEXTURE_BINDING_2D, &(bp->iTextureBinding2D[0]));
 
-        #ifdef GL_VERSION_1_2
-        if (MGL_VERSION_MIN(1, 2))
+    for (size_t i = 0; i < num_bound; ++i, ++num_objects)
+        mglInsertObject(objects, num_objects, max_objects, bound[i].type, bound[i].target, bound[i].name, version, dsa);
+
+    // Probe all object names for unbound objects
+    for (GLuint name = 1; name <= probe_names && name != 0; ++name)
+    {
+        #ifdef GL_VERSION_4_5
+        if (dsa && glIsTexture(name) && !mglIsObjectFound(bound, num_bound, MGLObjectTypeTexture, name))
         {
-            glGetIntegerv(GL_TEXTURE_BINDING_3D, &(bp->iTextureBinding3D[0]));
+            GLint target = 0;
+            glGetTextureParameteriv(name, GL_TEXTURE_TARGET, &target);
+            if (target != 0 && mglTextureBindingName((GLenum)target) != 0)
+                mglInsertObject(objects, num_objects++, max_objects, MGLObjectTypeTexture, (GLenum)target, name, version, dsa);
         }
-        #endif // /GL_VERSION_1_2
+        #endif // /GL_VERSION_4_5
+
+        #ifdef GL_VERSION_1_5
+        if (MGL_IS_VERSION_SUPPORTED(version, MGL_VERSION(1, 5)) && glIsBuffer(name) && !mglIsObjectFound(bound, num_bound, MGLObjectTypeBuffer, name))
+            mglInsertObject(objects, num_objects++, max_objects, MGLObjectTypeBuffer, GL_ARRAY_BUFFER, name, version, dsa);
+        #endif // /GL_VERSION_1_5
+
+        #ifdef GL_VERSION_3_0
+        if (MGL_IS_VERSION_SUPPORTED(version, MGL_VERSION(3, 0)) && glIsRenderbuffer(name) && !mglIsObjectFound(bound, num_bound, MGLObjectTypeRenderbuffer, name))
+            mglInsertObject(objects, num_objects++, max_objects, MGLObjectTypeRenderbuffer, GL_RENDERBUFFER, name, version, dsa);
+        #endif // /GL_VERSION_3_0
     }
 
     #undef MGL_VERSION
-    #undef MGL_VERSION_MIN
+
+    return num_objects;
 }
 
-static MGLString mglPrintStringPairs(MGLStringPairArray out, const MGLFormattingOptions* formatting)
+// Writes the dimensions of the specified object in the form "W x H x D" into 's' (incl. NUL char); 's' must provide space for 67 characters
+static void mglFormatObjectExtent(char* s, const MGLObjectInfo* info)
 {
-    // Determine longest parameter name
-    size_t max_par_len = 0;
+    s += mglFormatUInt64(s, (unsigned long long)MGL_MAX(info->width, 0));
+    memcpy(s, " x ", 3);
+    s += 3;
+    s += mglFormatUInt64(s, (unsigned long long)MGL_MAX(info->height, 0));
+    memcpy(s, " x ", 3);
+    s += 3;
+    mglFormatUInt64(s, (unsigned long long)MGL_MAX(info->depth, 0));
+}
 
-    for (size_t i = 0; i < out.index; ++i)
-    {
-        if (formatting->filter == NULL || strstr(out.first[i].buf, formatting->filter) != NULL)
-            max_par_len = MGL_MAX(max_par_len, out.first[i].len);
-    }
+MGLString mglPrintObjects(const MGLObjectInfo* objects, size_t num_objects, const MGLFormattingOptions* formatting)
+{
+    if (formatting == NULL)
+        formatting = (&g_MGLFormattingDefault);
+
+    // Provide array with all string parts
+    MGLOutputStringInternal* s = mglOutputStringAcquire(NULL, formatting->allocator);
+    if (s == NULL)
+        return NULL;
 
-    max_par_len += formatting->distance;
+    MGLStringPairArray out = mglOutputStringPairs(s, formatting);
 
-    // Determine output string capacity
-    size_t out_cap = 0;
+    unsigned long long  total = 0;
+    char                par[64];
+    char                val[256];
 
-    for (size_t i = 0; i < out.index; ++i)
+    // Print at most as many objects as there are string parts, but sum up the size of all objects
+    for (size_t i = 0; i < num_objects; ++i)
     {
-        if (formatting->filter == NULL || strstr(out.first[i].buf, formatting->filter) != NULL)
-        {
-            out_cap += out.first[i].len;
-            out_cap += (max_par_len - out.first[i].len);
-            out_cap += out.second[i].len;
-            out_cap += 1;
-        }
-    }
+        const MGLObjectInfo* info = &(objects[i]);
 
-    // Allocate output string
-    MGLStringInternal* s = MGL_MALLOC(MGLStringInternal);
-    mglStringInternalInit(s, out_cap);
+        total += info->bytes;
 
-    // Change order of strings
-    int out_permutations[MGL_MAX_NUM_RENDER_STATES];
+        if (i + 1 >= MGL_MAX_NUM_RENDER_STATES)
+            continue;
 
-    for (size_t i = 0; i < MGL_MAX_NUM_RENDER_STATES; ++i)
-        out_permutations[i] = i;
+        // Parameter is the target and the object name, e.g. "GL_TEXTURE_2D 4"
+        const char* target = mglEnumGroupName(info->target, MGLEnumGroupObjectTarget);
+        size_t      len    = 10;
 
-    if (formatting->order == MGLFormattingOrderSorted)
-    {
-        g_MGLOutputParamas = out.first;
-        qsort(out_permutations, MGL_MAX_NUM_RENDER_STATES, sizeof(int), mglCompareOutputPair);
-    }
+        if (target != NULL)
+        {
+            len = MGL_MIN(strlen(target), 40);
+            memcpy(par, target, len);
+        }
+        else
+            mglEnumToHex(par, (unsigned)info->target);
 
-    // Merge all strings parts to the output string
-    for (size_t i = 0; i < out.index; ++i)
-    {
-        int out_i = out_permutations[i];
+        par[len++] = ' ';
+        mglFormatUInt64(par + len, info->name);
 
-        if (formatting->filter == NULL || strstr(out.first[out_i].buf, formatting->filter) != NULL)
+        // Value is the estimated size, followed by dimensions, format, levels, and samples
+        char* v = val;
+        v += mglFormatUInt64(v, info->bytes);
+        memcpy(v, " bytes", 7);
+        v += 6;
+
+        if (info->type != MGLObjectTypeBuffer)
         {
-            // Append string parts to output string
-            const MGLStringInternal* cur_par = &(out.first[out_i]);
-            const MGLStringInternal* cur_val = &(out.second[out_i]);
-            const size_t cur_spaces_len = max_par_len - out.first[out_i].len;
+            const char* format = mglEnumGroupName((GLenum)info->internal_format, MGLEnumGroupInternalFormat | MGLEnumGroupCompressedTextureInternalFormat);
 
-            mglStringInternalAppend(s, cur_par);
-            mglStringInternalResize(s, s->len + cur_spaces_len, formatting->separator);
+            memcpy(v, ", ", 2);
+            v += 2;
+            mglFormatObjectExtent(v, info);
+            v += strlen(v);
 
-            if (cur_val->len > formatting->array_limit && cur_val->buf[cur_val->len - 1] == '}')
+            memcpy(v, ", ", 2);
+            v += 2;
+            if (format != NULL)
             {
-                // Append string in multiple lines, one for each element
-                size_t off = 0, next_off = 0;
-
-                while (off < cur_val->len)
-                {
-                    // Find end of current element
-                    next_off = mglStringInternalFindChar(cur_val, ',', off, MGL_STRING_NPOS);
-                    if (next_off != MGL_STRING_NPOS)
-                    {
-                        mglStringInternalAppendSub(s, cur_val, off, next_off - off + 1);
-                        mglStringInternalAppendCStr(s, "\n");
-                        mglStringInternalResize(s, s->len + cur_par->len + cur_spaces_len + 1, formatting->separator);
-                        off = next_off + 1;
-                    }
-                    else
-                    {
-                        mglStringInternalAppendSub(s, cur_val, off, MGL_STRING_NPOS);
-                        break;
-                    }
-                }
+                len = MGL_MIN(strlen(format), 96);
+                memcpy(v, format, len);
+                v += len;
             }
             else
-                mglStringInternalAppend(s, cur_val);
+            {
+                mglEnumToHex(v, (unsigned)info->internal_format);
+                v += 10;
+            }
 
-            mglStringInternalAppendCStr(s, "\n");
+            memcpy(v, ", ", 2);
+            v += 2;
+            v += mglFormatUInt64(v, (unsigned long long)MGL_MAX(info->num_levels, 0));
+            memcpy(v, " levels", 8);
+            v += 7;
+
+            if (info->samples > 0)
+            {
+                memcpy(v, ", ", 2);
+                v += 2;
+                v += mglFormatUInt64(v, (unsigned long long)info->samples);
+                memcpy(v, " samples", 9);
+                v += 8;
+            }
         }
 
-        // Free string parts
-        mglStringInternalFree(&(out.first[out_i]));
-        mglStringInternalFree(&(out.second[out_i]));
+        *v = '\0';
+        mglNextParamString(&out, MGLStateCategoryAll, par, val);
     }
 
+    memcpy(val + mglFormatUInt64(val, total), " bytes", 7);
+    mglNextParamString(&out, MGLStateCategoryAll, "total", val);
+
+    mglPrintStringPairs(out, formatting, &(s->str));
+    mglOutputStringReleaseParts(s);
+
     return (MGLString)s;
 }
 
-MGLString mglPrintRenderState(const MGLRenderState* rs, const MGLFormattingOptions* formatting)
+// Returns the render state field with the specified pname, or null if there is no such field
+static const MGLFieldDescriptor* mglFindRenderStateField(GLenum pname)
 {
-    // Internal constant parameters
-    static const MGLFormattingOptions   g_formattingDefault = { ' ', 1, 200, MGLFormattingOrderDefault, 1, NULL };
-    static const char*                  g_valNA             = "n/a";
-    //static const char*                  g_valNotYetImpl     = "< not yet implemented >";
+    for (size_t i = 0; i < MGL_NUM_RENDER_STATE_FIELDS; ++i)
+    {
+        if (g_MGLRenderStateFields[i].pname == pname)
+            return &(g_MGLRenderStateFields[i]);
+    }
+    return NULL;
+}
 
-    if (formatting == NULL)
-        formatting = (&g_formattingDefault);
+// Returns the glGet call kind of the specified field
+static unsigned mglWatchOpOfField(const MGLFieldDescriptor* field)
+{
+    if ((field->flags & MGLFieldFlagIndexed) != 0)
+        return (field->type == MGLFieldTypeInteger64Array ? MGLWatchOpInteger64Indexed : MGLWatchOpIntegerIndexed);
 
-    // Provide array with all string parts
-    MGLStringInternal out_par[MGL_MAX_NUM_RENDER_STATES], out_val[MGL_MAX_NUM_RENDER_STATES];
+    switch (field->type)
+    {
+        case MGLFieldTypeBoolean:
+        case MGLFieldTypeBooleanArray:
+            return MGLWatchOpBoolean;
+        case MGLFieldTypeFloat:
+        case MGLFieldTypeFloatArray:
+            return MGLWatchOpFloat;
+        case MGLFieldTypeDouble:
+        case MGLFieldTypeDoubleArray:
+            return MGLWatchOpDouble;
+        case MGLFieldTypeInteger64:
+        case MGLFieldTypeInteger64Array:
+            return MGLWatchOpInteger64;
+        default:
+            return MGLWatchOpInteger;
+    }
+}
 
-    memset(out_par, 0, sizeof(out_par));
-    memset(out_val, 0, sizeof(out_val));
+// Resolves the specified watch list entry for the specified GL version and returns the number of glGet calls it requires, or 0 if the entry is skipped.
+// Indexed fields are limited to the elements within their implementation limits (see mglIndexedFieldCount)
+static size_t mglResolveWatchEntry(MGLWatchEntryInternal* resolved, const MGLWatchEntry* entry, unsigned version, MGLIndexedLimitsCache* cache)
+{
+    const MGLFieldDescriptor* field = mglFindRenderStateField(entry->pname);
 
-    MGLStringPairArray out = { out_par, out_val, 0 };
+    if (field == NULL || field->count_offset != MGL_FIELD_NO_OFFSET || !mglIsFieldAvailable(field, version))
+        return 0;
 
-    #define MGL_VERSION(MAJOR, MINOR)       (((MAJOR) << 16) | (MINOR))
-    #define MGL_VERSION_MIN(MAJOR, MINOR)   (MGL_VERSION(rs->iMajorVersion, rs->iMinorVersion) >= MGL_VERSION(MAJOR, MINOR))
-    #define MGL_PARAM_UNAVAIL(NAME)         mglNextParamString(&out, #NAME, g_valNA)
-    //#define MGL_PARAM_NOT_YET_IMPL(NAME)    mglNextParamString(&out, #NAME, g_valNotYetImpl)
-
-    // *****************************************************************
-    //      GL_VERSION_1_0
-    // *****************************************************************
-
-    mglNextParamInteger(&out, "GL_MAJOR_VERSION", rs->iMajorVersion);
-    mglNextParamInteger(&out, "GL_MINOR_VERSION", rs->iMinorVersion);
-
-    mglNextParamBoolean(&out, "GL_BLEND", rs->bBlend);
-    mglNextParamFloatArray(&out, "GL_COLOR_CLEAR_VALUE", rs->fColorClearValue, 4);
-    mglNextParamBooleanArray(&out, "GL_COLOR_WRITEMASK", rs->bColorWriteMask, 4);
-    mglNextParamBoolean(&out, "GL_CULL_FACE", rs->bCullFace);
-    mglNextParamEnum(&out, "GL_CULL_FACE_MODE", rs->iCullFaceMode, mglCullFaceModeStr);
-    mglNextParamDouble(&out, "GL_DEPTH_CLEAR_VALUE", rs->dDepthClearValue);
-    mglNextParamEnum(&out, "GL_DEPTH_FUNC", rs->iDepthFunc, mglCompareFuncStr);
-    mglNextParamDoubleArray(&out, "GL_DEPTH_RANGE", rs->dDepthRange, 2);
-    mglNextParamBoolean(&out, "GL_DEPTH_TEST", rs->bDepthTest);
-    mglNextParamBoolean(&out, "GL_DEPTH_WRITEMASK", rs->bDepthWriteMask);
-    mglNextParamBoolean(&out, "GL_DITHER", rs->bDither);
-    mglNextParamBoolean(&out, "GL_DOUBLEBUFFER", rs->bDoubleBuffer);
-    mglNextParamInteger(&out, "GL_DRAW_BUFFER", rs->iDrawBuffer);
-    mglNextParamEnum(&out, "GL_FRONT_FACE", rs->iFrontFace, mglFrontFaceStr);
-    mglNextParamBoolean(&out, "GL_LINE_SMOOTH", rs->bLineSmooth);
-    mglNextParamEnum(&out, "GL_LINE_SMOOTH_HINT", rs->iLineSmoothHint, mglHintModeStr);
-    mglNextParamFloat(&out, "GL_LINE_WIDTH", rs->fLineWidth);
-    mglNextParamEnum(&out, "GL_LOGIC_OP_MODE", rs->iLogicOpMode, mglLogicOpModeStr);
-    mglNextParamInteger(&out, "GL_MAX_TEXTURE_SIZE", rs->iMaxTextureSize);
-    mglNextParamIntegerArray(&out, "GL_MAX_VIEWPORT_DIMS", rs->iMaxViewportDims, 2, 2, 0);
-    mglNextParamInteger(&out, "GL_PACK_ALIGNMENT", rs->iPackAlignment);
-    mglNextParamBoolean(&out, "GL_PACK_LSB_FIRST", rs->bPackLSBFirst);
-    mglNextParamInteger(&out, "GL_PACK_ROW_LENGTH", rs->iPackRowLength);
-    mglNextParamInteger(&out, "GL_PACK_SKIP_PIXELS", rs->iPackSkipPixels);
-    mglNextParamInteger(&out, "GL_PACK_SKIP_ROWS", rs->iPackSkipRows);
-    mglNextParamBoolean(&out, "GL_PACK_SWAP_BYTES", rs->bPackSwapBytes);
-    mglNextParamFloat(&out, "GL_POINT_SIZE", rs->fPointSize);
-    mglNextParamFloat(&out, "GL_POINT_SIZE_GRANULARITY", rs->fPointSizeGranularity);
-    mglNextParamFloatArray(&out, "GL_POINT_SIZE_RANGE", rs->fPointSizeRange, 2);
-    mglNextParamEnumArray(&out, "GL_POLYGON_MODE", rs->iPolygonMode, 2, 2, mglPolygonModeStr);
-    mglNextParamBoolean(&out, "GL_POLYGON_SMOOTH", rs->bPolygonSmooth);
-    mglNextParamEnum(&out, "GL_POLYGON_SMOOTH_HINT", rs->iPolygonSmoothHint, mglHintModeStr);
-    mglNextParamInteger(&out, "GL_READ_BUFFER", rs->iReadBuffer);
-    mglNextParamIntegerArray(&out, "GL_SCISSOR_BOX", rs->iScissorBox, 4, 4, 0);
-    mglNextParamBoolean(&out, "GL_SCISSOR_TEST", rs->bScissorTest);
-    mglNextParamInteger(&out, "GL_STENCIL_CLEAR_VALUE", rs->iStencilClearValue);
-    mglNextParamEnum(&out, "GL_STENCIL_FAIL", rs->iStencilFail, mglStencilOpStr);
-    mglNextParamEnum(&out, "GL_STENCIL_FUNC", rs->iStencilFunc, mglCompareFuncStr);
-    mglNextParamEnum(&out, "GL_STENCIL_PASS_DEPTH_FAIL", rs->iStencilPassDepthFail, mglStencilOpStr);
-    mglNextParamEnum(&out, "GL_STENCIL_PASS_DEPTH_PASS", rs->iStencilPassDepthPass, mglStencilOpStr);
-    mglNextParamInteger(&out, "GL_STENCIL_REF", rs->iStencilRef);
-    mglNextParamBoolean(&out, "GL_STENCIL_TEST", rs->bStencilTest);
-    mglNextParamIntegerHex(&out, "GL_STENCIL_VALUE_MASK", rs->iStencilValueMask);
-    mglNextParamIntegerHex(&out, "GL_STENCIL_WRITEMASK", rs->iStencilWriteMask);
-    mglNextParamBoolean(&out, "GL_STEREO", rs->bStereo);
-    mglNextParamInteger(&out, "GL_SUBPIXEL_BITS", rs->iSubPixelBits);
-    mglNextParamInteger(&out, "GL_TEXTURE_BINDING_1D", rs->iTextureBinding1D);
-    mglNextParamInteger(&out, "GL_TEXTURE_BINDING_2D", rs->iTextureBinding2D);
-    mglNextParamInteger(&out, "GL_UNPACK_ALIGNMENT", rs->iUnpackAlignment);
-    mglNextParamBoolean(&out, "GL_UNPACK_LSB_FIRST", rs->bUnpackLSBFirst);
-    mglNextParamInteger(&out, "GL_UNPACK_ROW_LENGTH", rs->iUnpackRowLength);
-    mglNextParamInteger(&out, "GL_UNPACK_SKIP_PIXELS", rs->iUnpackSkipPixels);
-    mglNextParamInteger(&out, "GL_UNPACK_SKIP_ROWS", rs->iUnpackSkipRows);
-    mglNextParamBoolean(&out, "GL_UNPACK_SWAP_BYTES", rs->bUnpackSwapBytes);
-    mglNextParamIntegerArray(&out, "GL_VIEWPORT", rs->iViewport, 4, 4, 0);
-
-    // *****************************************************************
-    //      GL_VERSION_1_1
-    // *****************************************************************
-
-    if (formatting->order == MGLFormattingOrderDefault)
-        mglNextHeadline(&out, "\nGL_VERSION_1_1");
+    // Scalar bitfields store their number of bits in 'count'
+    resolved->field = field;
+    resolved->count = (field->type >= MGLFieldTypeIntegerArray ? field->count : 1);
 
-    #ifdef GL_VERSION_1_1
-    if (MGL_VERSION_MIN(1, 1))
+    if ((field->flags & MGLFieldFlagIndexed) != 0)
     {
-        mglNextParamBoolean(&out, "GL_COLOR_LOGIC_OP", rs->bColorLogicOp);
-        mglNextParamFloat(&out, "GL_POLYGON_OFFSET_FACTOR", rs->fPolygonOffsetFactor);
-        mglNextParamFloat(&out, "GL_POLYGON_OFFSET_UNITS", rs->fPolygonOffsetUnits);
-        mglNextParamBoolean(&out, "GL_POLYGON_OFFSET_FILL", rs->bPolygonOffsetFill);
-        mglNextParamBoolean(&out, "GL_POLYGON_OFFSET_LINE", rs->bPolygonOffsetLine);
-        mglNextParamBoolean(&out, "GL_POLYGON_OFFSET_POINT", rs->bPolygonOffsetPoint);
-    }
-    else
-    #endif // /GL_VERSION_1_1
-    {
-        MGL_PARAM_UNAVAIL( GL_COLOR_LOGIC_OP );
-        MGL_PARAM_UNAVAIL( GL_POLYGON_OFFSET_FACTOR );
-        MGL_PARAM_UNAVAIL( GL_POLYGON_OFFSET_UNITS );
-        MGL_PARAM_UNAVAIL( GL_POLYGON_OFFSET_FILL );
-        MGL_PARAM_UNAVAIL( GL_POLYGON_OFFSET_LINE );
-        MGL_PARAM_UNAVAIL( GL_POLYGON_OFFSET_POINT );
+        GLuint num_get_calls = 0;
+        const GLuint count = mglIndexedFieldCount(field, NULL, version, cache, &num_get_calls);
+
+        if (count == 0 || (entry->index >= 0 && (unsigned)entry->index >= count))
+        {
+            resolved->field = NULL;
+            return 0;
+        }
+        if (entry->index < 0)
+        {
+            resolved->count = count;
+            return count;
+        }
+        resolved->count = 1;
     }
 
-    // *****************************************************************
-    //      GL_VERSION_1_2
-    // *****************************************************************
+    return 1;
+}
 
-    if (formatting->order == MGLFormattingOrderDefault)
-        mglNextHeadline(&out, "\nGL_VERSION_1_2");
+MGLWatchList mglCompileWatchList(const MGLWatchEntry* entries, size_t num_entries)
+{
+    #define MGL_VERSION(MAJOR, MINOR)       (((MAJOR) << 16) | (MINOR))
+    #define MGL_ALIGN8(SIZE)                (((SIZE) + 7) & ~(size_t)7)
 
-    #ifdef GL_VERSION_1_2
-    if (MGL_VERSION_MIN(1, 2))
-    {
-        mglNextParamFloatArray(&out, "GL_ALIASED_LINE_WIDTH_RANGE", rs->fAliasedLineWidthRange, 2);
-        mglNextParamFloatArray(&out, "GL_BLEND_COLOR", rs->fBlendColor, 4);
-        mglNextParamInteger(&out, "GL_MAX_3D_TEXTURE_SIZE", rs->iMax3DTextureSize);
-        mglNextParamInteger(&out, "GL_MAX_ELEMENTS_INDICES", rs->iMaxElementsIndices);
-        mglNextParamInteger(&out, "GL_MAX_ELEMENTS_VERTICES", rs->iMaxElementsVertices);
-        mglNextParamInteger(&out, "GL_PACK_IMAGE_HEIGHT", rs->iPackImageHeight);
-        mglNextParamInteger(&out, "GL_PACK_SKIP_IMAGES", rs->iPackSkipImages);
-        mglNextParamFloatArray(&out, "GL_SMOOTH_LINE_WIDTH_RANGE", rs->fSmoothLineWidthRange, 2);
-        mglNextParamFloat(&out, "GL_SMOOTH_LINE_WIDTH_GRANULARITY", rs->fSmoothLineWidthGranularity);
-        mglNextParamInteger(&out, "GL_TEXTURE_BINDING_3D", rs->iTextureBinding3D);
-        mglNextParamInteger(&out, "GL_UNPACK_IMAGE_HEIGHT", rs->iUnpackImageHeight);
-        mglNextParamInteger(&out, "GL_UNPACK_SKIP_IMAGES", rs->iUnpackSkipImages);
-    }
-    else
-    #endif // /GL_VERSION_1_2
-    {
-        MGL_PARAM_UNAVAIL( GL_ALIASED_LINE_WIDTH_RANGE );
-        MGL_PARAM_UNAVAIL( GL_BLEND_COLOR );
-        MGL_PARAM_UNAVAIL( GL_MAX_3D_TEXTURE_SIZE );
-        MGL_PARAM_UNAVAIL( GL_MAX_ELEMENTS_INDICES );
-        MGL_PARAM_UNAVAIL( GL_MAX_ELEMENTS_VERTICES );
-        MGL_PARAM_UNAVAIL( GL_PACK_IMAGE_HEIGHT );
-        MGL_PARAM_UNAVAIL( GL_PACK_SKIP_IMAGES );
-        MGL_PARAM_UNAVAIL( GL_SMOOTH_LINE_WIDTH_RANGE );
-        MGL_PARAM_UNAVAIL( GL_SMOOTH_LINE_WIDTH_GRANULARITY );
-        MGL_PARAM_UNAVAIL( GL_TEXTURE_BINDING_3D );
-        MGL_PARAM_UNAVAIL( GL_UNPACK_IMAGE_HEIGHT );
-        MGL_PARAM_UNAVAIL( GL_UNPACK_SKIP_IMAGES );
-    }
+    GLint major = 0, minor = 0;
+    glGetIntegerv(GL_MAJOR_VERSION, &major);
+    glGetIntegerv(GL_MINOR_VERSION, &minor);
 
-    // *****************************************************************
-    //      GL_VERSION_1_3
-    // *****************************************************************
+    const unsigned version = MGL_VERSION(major, minor);
 
-    if (formatting->order == MGLFormattingOrderDefault)
-        mglNextHeadline(&out, "\nGL_VERSION_1_3");
+    MGLIndexedLimitsCache cache;
+    cache.count = 0;
 
-    #ifdef GL_VERSION_1_3
-    if (MGL_VERSION_MIN(1, 3))
-    {
-        mglNextParamInteger(&out, "GL_NUM_COMPRESSED_TEXTURE_FORMATS", rs->iNumCompressedTextureFormats);
-        mglNextParamEnumArray(&out, "GL_COMPRESSED_TEXTURE_FORMATS", rs->iCompressedTextureFormats, (size_t)rs->iNumCompressedTextureFormats, MGL_MAX_COMPRESSED_TEXTURE_FORMATS, mglCompressedTextureInternalFormatStr);
-        mglNextParamInteger(&out, "GL_TEXTURE_BINDING_CUBE_MAP", rs->iTextureBindingCubeMap);
-        mglNextParamEnum(&out, "GL_TEXTURE_COMPRESSION_HINT", rs->iTextureCompressionHint, mglHintModeStr);
-        mglNextParamEnum(&out, "GL_ACTIVE_TEXTURE", rs->iActiveTexture, mglTextureStr);
-        mglNextParamInteger(&out, "GL_MAX_CUBE_MAP_TEXTURE_SIZE", rs->iMaxCubeMapTextureSize);
-        mglNextParamInteger(&out, "GL_SAMPLE_BUFFERS", rs->iSampleBuffers);
-        mglNextParamFloat(&out, "GL_SAMPLE_COVERAGE_VALUE", rs->fSampleCoverageValue);
-        mglNextParamBoolean(&out, "GL_SAMPLE_COVERAGE_INVERT", rs->bSampleCoverageInvert);
-        mglNextParamInteger(&out, "GL_SAMPLES", rs->iSamples);
-    }
-    else
-    #endif // /GL_VERSION_1_3
+    // Resolve all entries first to determine the number of glGet calls
+    size_t num_ops = 0;
+    for (size_t i = 0; i < num_entries; ++i)
     {
-        MGL_PARAM_UNAVAIL( GL_NUM_COMPRESSED_TEXTURE_FORMATS );
-        MGL_PARAM_UNAVAIL( GL_COMPRESSED_TEXTURE_FORMATS );
-        MGL_PARAM_UNAVAIL( GL_TEXTURE_BINDING_CUBE_MAP );
-        MGL_PARAM_UNAVAIL( GL_TEXTURE_COMPRESSION_HINT );
-        MGL_PARAM_UNAVAIL( GL_ACTIVE_TEXTURE );
-        MGL_PARAM_UNAVAIL( GL_MAX_CUBE_MAP_TEXTURE_SIZE );
-        MGL_PARAM_UNAVAIL( GL_SAMPLE_BUFFERS );
-        MGL_PARAM_UNAVAIL( GL_SAMPLE_COVERAGE_VALUE );
-        MGL_PARAM_UNAVAIL( GL_SAMPLE_COVERAGE_INVERT );
-        MGL_PARAM_UNAVAIL( GL_SAMPLES );
+        MGLWatchEntryInternal resolved = { NULL, 0, 0 };
+        num_ops += mglResolveWatchEntry(&resolved, &(entries[i]), version, &cache);
     }
 
-    // *****************************************************************
-    //      GL_VERSION_1_4
-    // *****************************************************************
+    // Allocate object, query plan, and resolved entries in a single memory block
+    const size_t ops_offset     = MGL_ALIGN8(sizeof(MGLWatchListInternal));
+    const size_t entries_offset = MGL_ALIGN8(ops_offset + sizeof(MGLWatchOpInternal) * num_ops);
+    const size_t memory_size    = entries_offset + sizeof(MGLWatchEntryInternal) * num_entries;
 
-    if (formatting->order == MGLFormattingOrderDefault)
-        mglNextHeadline(&out, "\nGL_VERSION_1_4");
+    char*                   memory      = (char*)mglAlloc(NULL, memory_size);
 
-    #ifdef GL_VERSION_1_4
-    if (MGL_VERSION_MIN(1, 4))
-    {
-        mglNextParamEnum(&out, "GL_BLEND_DST_ALPHA", rs->iBlendDstAlpha, mglBlendFuncStr);
-        mglNextParamEnum(&out, "GL_BLEND_DST_RGB", rs->iBlendDstRGB, mglBlendFuncStr);
-        mglNextParamEnum(&out, "GL_BLEND_SRC_ALPHA", rs->iBlendSrcAlpha, mglBlendFuncStr);
-        mglNextParamEnum(&out, "GL_BLEND_SRC_RGB", rs->iBlendSrcRGB, mglBlendFuncStr);
-        mglNextParamFloat(&out, "GL_MAX_TEXTURE_LOD_BIAS", rs->fMaxTextureLODBias);
-        mglNextParamFloat(&out, "GL_POINT_FADE_THRESHOLD_SIZE", rs->fPointFadeThresholdSize);
-    }
-    else
-    #endif // /GL_VERSION_1_4
-    {
-        MGL_PARAM_UNAVAIL( GL_BLEND_DST_ALPHA );
-        MGL_PARAM_UNAVAIL( GL_BLEND_DST_RGB );
-        MGL_PARAM_UNAVAIL( GL_BLEND_SRC_ALPHA );
-        MGL_PARAM_UNAVAIL( GL_BLEND_SRC_RGB );
-        MGL_PARAM_UNAVAIL( GL_MAX_TEXTURE_LOD_BIAS );
-        MGL_PARAM_UNAVAIL( GL_POINT_FADE_THRESHOLD_SIZE );
-    }
+    if (memory == NULL)
+        return NULL;
 
-    // *****************************************************************
-    //      GL_VERSION_1_5
-    // *****************************************************************
+    MGLWatchListInternal*   list        = (MGLWatchListInternal*)memory;
+    MGLWatchOpInternal*     ops         = (MGLWatchOpInternal*)(memory + ops_offset);
+    MGLWatchEntryInternal*  resolved    = (MGLWatchEntryInternal*)(memory + entries_offset);
 
-    if (formatting->order == MGLFormattingOrderDefault)
-        mglNextHeadline(&out, "\nGL_VERSION_1_5");
+    list->ops           = ops;
+    list->entries       = resolved;
+    list->num_entries   = num_entries;
+    list->memory_size   = memory_size;
 
-    #ifdef GL_VERSION_1_5
-    if (MGL_VERSION_MIN(1, 5))
-    {
-        mglNextParamInteger(&out, "GL_ARRAY_BUFFER_BINDING", rs->iArrayBufferBinding);
-        mglNextParamInteger(&out, "GL_ELEMENT_ARRAY_BUFFER_BINDING", rs->iElementArrayBufferBinding);
-    }
-    else
-    #endif // /GL_VERSION_1_5
+    // Emit one glGet call per field, or per element of indexed fields
+    for (size_t i = 0; i < num_entries; ++i)
     {
-        MGL_PARAM_UNAVAIL( GL_ARRAY_BUFFER_BINDING );
-        MGL_PARAM_UNAVAIL( GL_ELEMENT_ARRAY_BUFFER_BINDING );
-    }
+        const MGLWatchEntry*    entry   = &(entries[i]);
+        const size_t            num     = mglResolveWatchEntry(&(resolved[i]), entry, version, &cache);
 
-    // *****************************************************************
-    //      GL_VERSION_2_0
-    // *****************************************************************
+        if (num == 0)
+            continue;
 
-    if (formatting->order == MGLFormattingOrderDefault)
-        mglNextHeadline(&out, "\nGL_VERSION_2_0");
+        const MGLFieldDescriptor*   field       = resolved[i].field;
+        const unsigned              op          = mglWatchOpOfField(field);
+        const size_t                elem_size   = mglFieldElementSize(field->type);
 
-    #ifdef GL_VERSION_2_0
-    if (MGL_VERSION_MIN(2, 0))
-    {
-        mglNextParamEnum(&out, "GL_BLEND_EQUATION_ALPHA", rs->iBlendEquationAlpha, mglBlendEquationModeStr);
-        mglNextParamEnum(&out, "GL_BLEND_EQUATION_RGB", rs->iBlendEquationRGB, mglBlendEquationModeStr);
-        mglNextParamInteger(&out, "GL_CURRENT_PROGRAM", rs->iCurrentProgram);
-        mglNextParamEnum(&out, "GL_DRAW_BUFFER0", rs->iDrawBuffer_i[0], mglDrawBufferModeStr);
-        mglNextParamEnum(&out, "GL_DRAW_BUFFER1", rs->iDrawBuffer_i[1], mglDrawBufferModeStr);
-        mglNextParamEnum(&out, "GL_DRAW_BUFFER2", rs->iDrawBuffer_i[2], mglDrawBufferModeStr);
-        mglNextParamEnum(&out, "GL_DRAW_BUFFER3", rs->iDrawBuffer_i[3], mglDrawBufferModeStr);
-        mglNextParamEnum(&out, "GL_DRAW_BUFFER4", rs->iDrawBuffer_i[4], mglDrawBufferModeStr);
-        mglNextParamEnum(&out, "GL_DRAW_BUFFER5", rs->iDrawBuffer_i[5], mglDrawBufferModeStr);
-        mglNextParamEnum(&out, "GL_DRAW_BUFFER6", rs->iDrawBuffer_i[6], mglDrawBufferModeStr);
-        mglNextParamEnum(&out, "GL_DRAW_BUFFER7", rs->iDrawBuffer_i[7], mglDrawBufferModeStr);
-        mglNextParamEnum(&out, "GL_DRAW_BUFFER8", rs->iDrawBuffer_i[8], mglDrawBufferModeStr);
-        mglNextParamEnum(&out, "GL_DRAW_BUFFER9", rs->iDrawBuffer_i[9], mglDrawBufferModeStr);
-        mglNextParamEnum(&out, "GL_DRAW_BUFFER10", rs->iDrawBuffer_i[10], mglDrawBufferModeStr);
-        mglNextParamEnum(&out, "GL_DRAW_BUFFER11", rs->iDrawBuffer_i[11], mglDrawBufferModeStr);
-        mglNextParamEnum(&out, "GL_DRAW_BUFFER12", rs->iDrawBuffer_i[12], mglDrawBufferModeStr);
-        mglNextParamEnum(&out, "GL_DRAW_BUFFER13", rs->iDrawBuffer_i[13], mglDrawBufferModeStr);
-        mglNextParamEnum(&out, "GL_DRAW_BUFFER14", rs->iDrawBuffer_i[14], mglDrawBufferModeStr);
-        mglNextParamEnum(&out, "GL_DRAW_BUFFER15", rs->iDrawBuffer_i[15], mglDrawBufferModeStr);
-        mglNextParamEnum(&out, "GL_FRAGMENT_SHADER_DERIVATIVE_HINT", rs->iFragmentShaderDerivativeHint, mglHintModeStr);
-        mglNextParamInteger(&out, "GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS", rs->iMaxCombinedTextureImageUnits);
-        mglNextParamInteger(&out, "GL_MAX_DRAW_BUFFERS", rs->iMaxDrawBuffers);
-        mglNextParamInteger(&out, "GL_MAX_FRAGMENT_UNIFORM_COMPONENTS", rs->iMaxFragmentUniformComponents);
-        mglNextParamInteger(&out, "GL_MAX_TEXTURE_IMAGE_UNITS", rs->iMaxTextureImageUnits);
-        mglNextParamInteger(&out, "GL_MAX_VARYING_FLOATS", rs->iMaxVaryingFloats);
-        mglNextParamInteger(&out, "GL_MAX_VERTEX_ATTRIBS", rs->iMaxVertexAttribs);
-        mglNextParamInteger(&out, "GL_MAX_VERTEX_TEXTURE_IMAGE_UNITS", rs->iMaxVertexTextureImageUnits);
-        mglNextParamInteger(&out, "GL_MAX_VERTEX_UNIFORM_COMPONENTS", rs->iMaxVertexUniformComponents);
-        mglNextParamEnum(&out, "GL_STENCIL_BACK_FAIL", rs->iStencilBackFail, mglStencilOpStr);
-        mglNextParamEnum(&out, "GL_STENCIL_BACK_FUNC", rs->iStencilBackFunc, mglCompareFuncStr);
-        mglNextParamEnum(&out, "GL_STENCIL_BACK_PASS_DEPTH_FAIL", rs->iStencilBackPassDepthFail, mglStencilOpStr);
-        mglNextParamEnum(&out, "GL_STENCIL_BACK_PASS_DEPTH_PASS", rs->iStencilBackPassDepthPass, mglStencilOpStr);
-        mglNextParamInteger(&out, "GL_STENCIL_BACK_REF", rs->iStencilBackRef);
-        mglNextParamIntegerHex(&out, "GL_STENCIL_BACK_VALUE_MASK", rs->iStencilBackValueMask);
-        mglNextParamIntegerHex(&out, "GL_STENCIL_BACK_WRITEMASK", rs->iStencilBackWriteMask);
-    }
-    else
-    #endif // /GL_VERSION_2_0
-    {
-        MGL_PARAM_UNAVAIL( GL_BLEND_EQUATION_ALPHA );
-        MGL_PARAM_UNAVAIL( GL_BLEND_EQUATION_RGB );
-        MGL_PARAM_UNAVAIL( GL_CURRENT_PROGRAM );
-        MGL_PARAM_UNAVAIL( GL_DRAW_BUFFER0 );
-        MGL_PARAM_UNAVAIL( GL_DRAW_BUFFER1 );
-        MGL_PARAM_UNAVAIL( GL_DRAW_BUFFER2 );
-        MGL_PARAM_UNAVAIL( GL_DRAW_BUFFER3 );
-        MGL_PARAM_UNAVAIL( GL_DRAW_BUFFER4 );
-        MGL_PARAM_UNAVAIL( GL_DRAW_BUFFER5 );
-        MGL_PARAM_UNAVAIL( GL_DRAW_BUFFER6 );
-        MGL_PARAM_UNAVAIL( GL_DRAW_BUFFER7 );
-        MGL_PARAM_UNAVAIL( GL_DRAW_BUFFER8 );
-        MGL_PARAM_UNAVAIL( GL_DRAW_BUFFER9 );
-        MGL_PARAM_UNAVAIL( GL_DRAW_BUFFER10 );
-        MGL_PARAM_UNAVAIL( GL_DRAW_BUFFER11 );
-        MGL_PARAM_UNAVAIL( GL_DRAW_BUFFER12 );
-        MGL_PARAM_UNAVAIL( GL_DRAW_BUFFER13 );
-        MGL_PARAM_UNAVAIL( GL_DRAW_BUFFER14 );
-        MGL_PARAM_UNAVAIL( GL_DRAW_BUFFER15 );
-        MGL_PARAM_UNAVAIL( GL_FRAGMENT_SHADER_DERIVATIVE_HINT );
-        MGL_PARAM_UNAVAIL( GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS );
-        MGL_PARAM_UNAVAIL( GL_MAX_DRAW_BUFFERS );
-        MGL_PARAM_UNAVAIL( GL_MAX_FRAGMENT_UNIFORM_COMPONENTS );
-        MGL_PARAM_UNAVAIL( GL_MAX_TEXTURE_IMAGE_UNITS );
-        MGL_PARAM_UNAVAIL( GL_MAX_VARYING_FLOATS );
-        MGL_PARAM_UNAVAIL( GL_MAX_VERTEX_ATTRIBS );
-        MGL_PARAM_UNAVAIL( GL_MAX_VERTEX_TEXTURE_IMAGE_UNITS );
-        MGL_PARAM_UNAVAIL( GL_MAX_VERTEX_UNIFORM_COMPONENTS );
-        MGL_PARAM_UNAVAIL( GL_STENCIL_BACK_FAIL );
-        MGL_PARAM_UNAVAIL( GL_STENCIL_BACK_FUNC );
-        MGL_PARAM_UNAVAIL( GL_STENCIL_BACK_PASS_DEPTH_FAIL );
-        MGL_PARAM_UNAVAIL( GL_STENCIL_BACK_PASS_DEPTH_PASS );
-        MGL_PARAM_UNAVAIL( GL_STENCIL_BACK_REF );
-        MGL_PARAM_UNAVAIL( GL_STENCIL_BACK_VALUE_MASK );
-        MGL_PARAM_UNAVAIL( GL_STENCIL_BACK_WRITEMASK );
-    }
-
-    // *****************************************************************
-    //      GL_VERSION_2_1
-    // *****************************************************************
-
-    if (formatting->order == MGLFormattingOrderDefault)
-        mglNextHeadline(&out, "\nGL_VERSION_2_1");
-
-    #ifdef GL_VERSION_2_1
-    if (MGL_VERSION_MIN(2, 1))
-    {
-        mglNextParamInteger(&out, "GL_PIXEL_PACK_BUFFER_BINDING", rs->iPixelPackBufferBinding);
-        mglNextParamInteger(&out, "GL_PIXEL_UNPACK_BUFFER_BINDING", rs->iPixelUnpackBufferBinding);
-    }
-    else
-    #endif // /GL_VERSION_2_1
-    {
-        MGL_PARAM_UNAVAIL( GL_PIXEL_PACK_BUFFER_BINDING );
-        MGL_PARAM_UNAVAIL( GL_PIXEL_UNPACK_BUFFER_BINDING );
-    }
+        resolved[i].offset = list->size;
 
-    // *****************************************************************
-    //      GL_VERSION_3_0
-    // *****************************************************************
+        for (size_t j = 0; j < num; ++j)
+        {
+            MGLWatchOpInternal* next = &(ops[list->num_ops++]);
 
-    if (formatting->order == MGLFormattingOrderDefault)
-        mglNextHeadline(&out, "\nGL_VERSION_3_0");
+            next->pname     = field->pname;
+            next->index     = (GLuint)(entry->index >= 0 ? (size_t)entry->index : j);
+            next->op        = op;
+            next->offset    = (unsigned)(list->size + elem_size * j);
+        }
 
-    #ifdef GL_VERSION_3_0
-    if (MGL_VERSION_MIN(3, 0))
-    {
-        mglNextParamBitfield(&out, "GL_CONTEXT_FLAGS", rs->iContextFlags, 32, mglContextFlagBitStr);
-        mglNextParamInteger(&out, "GL_DRAW_FRAMEBUFFER_BINDING", rs->iDrawFramebufferBinding);
-        mglNextParamInteger(&out, "GL_MAX_ARRAY_TEXTURE_LAYERS", rs->iMaxArrayTextureLayers);
-        mglNextParamInteger(&out, "GL_MAX_CLIP_DISTANCES", rs->iMaxClipDistances);
-        mglNextParamInteger(&out, "GL_MAX_RENDERBUFFER_SIZE", rs->iMaxRenderbufferSize);
-        mglNextParamInteger(&out, "GL_MAX_VARYING_COMPONENTS", rs->iMaxVaryingComponents);
-        mglNextParamInteger(&out, "GL_NUM_EXTENSIONS", rs->iNumExtensions);
-        mglNextParamInteger(&out, "GL_MIN_PROGRAM_TEXEL_OFFSET", rs->iMinProgramTexelOffest);
-        mglNextParamInteger(&out, "GL_MAX_PROGRAM_TEXEL_OFFSET", rs->iMaxProgramTexelOffest);
-        mglNextParamInteger(&out, "GL_READ_FRAMEBUFFER_BINDING", rs->iReadFramebufferBinding);
-        mglNextParamInteger(&out, "GL_RENDERBUFFER_BINDING", rs->iRenderbufferBinding);
-        mglNextParamInteger(&out, "GL_TEXTURE_BINDING_1D_ARRAY", rs->iTextureBinding1DArray);
-        mglNextParamInteger(&out, "GL_TEXTURE_BINDING_2D_ARRAY", rs->iTextureBinding2DArray);
-        #ifdef MENTAL_GL_GETINTEGERI_V
-        mglNextParamIntegerArray(&out, "GL_TRANSFORM_FEEDBACK_BUFFER_BINDING", rs->iTransformFeedbackBufferBinding, MGL_MAX_TRANSFORM_FEEDBACK_BUFFER_BINDINGS, MGL_MAX_TRANSFORM_FEEDBACK_BUFFER_BINDINGS, 0);
-        #else
-        MGL_PARAM_UNAVAIL( GL_TRANSFORM_FEEDBACK_BUFFER_BINDING );
-        #endif
-        #ifdef MENTAL_GL_GETINTEGER64I_V
-        mglNextParamInteger64Array(&out, "GL_TRANSFORM_FEEDBACK_BUFFER_SIZE", rs->iTransformFeedbackBufferSize, MGL_MAX_TRANSFORM_FEEDBACK_BUFFER_BINDINGS, MGL_MAX_TRANSFORM_FEEDBACK_BUFFER_BINDINGS);
-        mglNextParamInteger64Array(&out, "GL_TRANSFORM_FEEDBACK_BUFFER_START", rs->iTransformFeedbackBufferStart, MGL_MAX_TRANSFORM_FEEDBACK_BUFFER_BINDINGS, MGL_MAX_TRANSFORM_FEEDBACK_BUFFER_BINDINGS);
-        #else
-        MGL_PARAM_UNAVAIL( GL_TRANSFORM_FEEDBACK_BUFFER_SIZE );
-        MGL_PARAM_UNAVAIL( GL_TRANSFORM_FEEDBACK_BUFFER_START );
-        #endif
-        mglNextParamInteger(&out, "GL_VERTEX_ARRAY_BINDING", rs->iVertexArrayBinding);
+        list->size = MGL_ALIGN8(list->size + elem_size * resolved[i].count);
     }
-    else
-    #endif // /GL_VERSION_3_0
-    {
-        MGL_PARAM_UNAVAIL( GL_CONTEXT_FLAGS );
-        MGL_PARAM_UNAVAIL( GL_DRAW_FRAMEBUFFER_BINDING );
-        MGL_PARAM_UNAVAIL( GL_MAX_ARRAY_TEXTURE_LAYERS );
-        MGL_PARAM_UNAVAIL( GL_MAX_CLIP_DISTANCES );
-        MGL_PARAM_UNAVAIL( GL_MAX_RENDERBUFFER_SIZE );
-        MGL_PARAM_UNAVAIL( GL_MAX_VARYING_COMPONENTS );
-        MGL_PARAM_UNAVAIL( GL_NUM_EXTENSIONS );
-        MGL_PARAM_UNAVAIL( GL_MIN_PROGRAM_TEXEL_OFFSET );
-        MGL_PARAM_UNAVAIL( GL_MAX_PROGRAM_TEXEL_OFFSET );
-        MGL_PARAM_UNAVAIL( GL_READ_FRAMEBUFFER_BINDING );
-        MGL_PARAM_UNAVAIL( GL_RENDERBUFFER_BINDING );
-        MGL_PARAM_UNAVAIL( GL_TEXTURE_BINDING_1D_ARRAY );
-        MGL_PARAM_UNAVAIL( GL_TEXTURE_BINDING_2D_ARRAY );
-        MGL_PARAM_UNAVAIL( GL_TRANSFORM_FEEDBACK_BUFFER_BINDING );
-        MGL_PARAM_UNAVAIL( GL_TRANSFORM_FEEDBACK_BUFFER_SIZE );
-        MGL_PARAM_UNAVAIL( GL_TRANSFORM_FEEDBACK_BUFFER_START );
-        MGL_PARAM_UNAVAIL( GL_VERTEX_ARRAY_BINDING );
-    }
-
-    // *****************************************************************
-    //      GL_VERSION_3_1
-    // *****************************************************************
-
-    if (formatting->order == MGLFormattingOrderDefault)
-        mglNextHeadline(&out, "\nGL_VERSION_3_1");
 
-    #ifdef GL_VERSION_3_1
-    if (MGL_VERSION_MIN(3, 1))
-    {
-        mglNextParamInteger(&out, "GL_MAX_COMBINED_FRAGMENT_UNIFORM_COMPONENTS", rs->iMaxCombinedFragmentUniformComponents);
-        mglNextParamInteger(&out, "GL_MAX_COMBINED_GEOMETRY_UNIFORM_COMPONENTS", rs->iMaxCombinedGeometryUniformComponents);
-        mglNextParamInteger(&out, "GL_MAX_COMBINED_VERTEX_UNIFORM_COMPONENTS", rs->iMaxCombinedVertexUniformComponents);
-        mglNextParamInteger(&out, "GL_MAX_COMBINED_UNIFORM_BLOCKS", rs->iMaxCombinedUniformBlocks);
-        mglNextParamInteger(&out, "GL_MAX_FRAGMENT_UNIFORM_BLOCKS", rs->iMaxFragmentUniformBlocks);
-        mglNextParamInteger(&out, "GL_MAX_GEOMETRY_UNIFORM_BLOCKS", rs->iMaxGeometryUniformBlocks);
-        mglNextParamInteger(&out, "GL_MAX_VERTEX_UNIFORM_BLOCKS", rs->iMaxVertexUniformBlocks);
-
-        mglNextParamInteger(&out, "GL_MAX_RECTANGLE_TEXTURE_SIZE", rs->iMaxRectangleTextureSize);
-        mglNextParamInteger(&out, "GL_MAX_TEXTURE_BUFFER_SIZE", rs->iMaxTextureBufferSize);
-        mglNextParamInteger(&out, "GL_MAX_UNIFORM_BUFFER_BINDINGS", rs->iMaxUniformBufferBindings);
-        mglNextParamInteger(&out, "GL_MAX_UNIFORM_BLOCK_SIZE", rs->iMaxUniformBlockSize);
-        mglNextParamInteger(&out, "GL_PRIMITIVE_RESTART_INDEX", rs->iPrimitiveRestartIndex);
-        mglNextParamInteger(&out, "GL_TEXTURE_BINDING_BUFFER", rs->iTextureBindingBuffer);
-        mglNextParamInteger(&out, "GL_TEXTURE_BINDING_RECTANGLE", rs->iTextureBindingRectangle);
-        #ifdef MENTAL_GL_GETINTEGERI_V
-        mglNextParamIntegerArray(&out, "GL_UNIFORM_BUFFER_BINDING", rs->iUniformBufferBinding, MGL_MAX_UNIFORM_BUFFER_BINDINGS, MGL_MAX_UNIFORM_BUFFER_BINDINGS, 0);
-        #else
-        MGL_PARAM_UNAVAIL( GL_UNIFORM_BUFFER_BINDING );
-        #endif
-        #ifdef MENTAL_GL_GETINTEGER64I_V
-        mglNextParamInteger64Array(&out, "GL_UNIFORM_BUFFER_SIZE", rs->iUniformBufferSize, MGL_MAX_UNIFORM_BUFFER_BINDINGS, MGL_MAX_UNIFORM_BUFFER_BINDINGS);
-        mglNextParamInteger64Array(&out, "GL_UNIFORM_BUFFER_START", rs->iUniformBufferStart, MGL_MAX_UNIFORM_BUFFER_BINDINGS, MGL_MAX_UNIFORM_BUFFER_BINDINGS);
-        #else
-        MGL_PARAM_UNAVAIL( GL_UNIFORM_BUFFER_SIZE );
-        MGL_PARAM_UNAVAIL( GL_UNIFORM_BUFFER_START );
-        #endif
-        mglNextParamInteger(&out, "GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT", rs->iUniformBufferOffsetAlignment);
-    }
-    else
-    #endif // /GL_VERSION_3_1
-    {
-        MGL_PARAM_UNAVAIL( GL_MAX_COMBINED_FRAGMENT_UNIFORM_COMPONENTS );
-        MGL_PARAM_UNAVAIL( GL_MAX_COMBINED_GEOMETRY_UNIFORM_COMPONENTS );
-        MGL_PARAM_UNAVAIL( GL_MAX_COMBINED_VERTEX_UNIFORM_COMPONENTS );
-        MGL_PARAM_UNAVAIL( GL_MAX_COMBINED_UNIFORM_BLOCKS );
-        MGL_PARAM_UNAVAIL( GL_MAX_FRAGMENT_UNIFORM_BLOCKS );
-        MGL_PARAM_UNAVAIL( GL_MAX_GEOMETRY_UNIFORM_BLOCKS );
-        MGL_PARAM_UNAVAIL( GL_MAX_VERTEX_UNIFORM_BLOCKS );
-        MGL_PARAM_UNAVAIL( GL_MAX_RECTANGLE_TEXTURE_SIZE );
-        MGL_PARAM_UNAVAIL( GL_MAX_TEXTURE_BUFFER_SIZE );
-        MGL_PARAM_UNAVAIL( GL_MAX_UNIFORM_BUFFER_BINDINGS );
-        MGL_PARAM_UNAVAIL( GL_MAX_UNIFORM_BLOCK_SIZE );
-        MGL_PARAM_UNAVAIL( GL_PRIMITIVE_RESTART_INDEX );
-        MGL_PARAM_UNAVAIL( GL_TEXTURE_BINDING_BUFFER );
-        MGL_PARAM_UNAVAIL( GL_TEXTURE_BINDING_RECTANGLE );
-        MGL_PARAM_UNAVAIL( GL_UNIFORM_BUFFER_BINDING );
-        MGL_PARAM_UNAVAIL( GL_UNIFORM_BUFFER_SIZE );
-        MGL_PARAM_UNAVAIL( GL_UNIFORM_BUFFER_START );
-        MGL_PARAM_UNAVAIL( GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT );
-    }
-
-    // *****************************************************************
-    //      GL_VERSION_3_2
-    // *****************************************************************
-
-    if (formatting->order == MGLFormattingOrderDefault)
-        mglNextHeadline(&out, "\nGL_VERSION_3_2");
+    #undef MGL_VERSION
+    #undef MGL_ALIGN8
 
-    #ifdef GL_VERSION_3_2
-    if (MGL_VERSION_MIN(3, 2))
-    {
-        mglNextParamInteger(&out, "GL_MAX_COLOR_TEXTURE_SAMPLES", rs->iMaxColorTextureSamples);
-        mglNextParamInteger(&out, "GL_MAX_DEPTH_TEXTURE_SAMPLES", rs->iMaxDepthTextureSamples);
-        mglNextParamInteger(&out, "GL_MAX_INTEGER_SAMPLES", rs->iMaxIntegerSamples);
-        mglNextParamInteger(&out, "GL_MAX_GEOMETRY_INPUT_COMPONENTS", rs->iMaxGeometryInputComponents);
-        mglNextParamInteger(&out, "GL_MAX_GEOMETRY_OUTPUT_COMPONENTS", rs->iMaxGeometryOutputComponents);
-        mglNextParamInteger(&out, "GL_MAX_GEOMETRY_TEXTURE_IMAGE_UNITS", rs->iMaxGeometryTextureImageUnits);
-        mglNextParamInteger(&out, "GL_MAX_GEOMETRY_UNIFORM_COMPONENTS", rs->iMaxGeometryUniformComponents);
-        mglNextParamInteger(&out, "GL_MAX_FRAGMENT_INPUT_COMPONENTS", rs->iMaxFragmentInputComponents);
-        mglNextParamInteger(&out, "GL_MAX_VERTEX_OUTPUT_COMPONENTS", rs->iMaxVertexOutputComponents);
-        mglNextParamInteger(&out, "GL_MAX_SAMPLE_MASK_WORDS", rs->iMaxSampleMaskWords);
-        mglNextParamInteger(&out, "GL_MAX_SERVER_WAIT_TIMEOUT", rs->iMaxServerWaitTimeout);
-        mglNextParamBoolean(&out, "GL_PROGRAM_POINT_SIZE", rs->bProgramPointSize);
-        mglNextParamEnum(&out, "GL_PROVOKING_VERTEX", rs->iProvokingVertex, mglProvokingVertexModeStr);
-        mglNextParamInteger(&out, "GL_TEXTURE_BINDING_2D_MULTISAMPLE", rs->iTextureBinding2DMultisample);
-        mglNextParamInteger(&out, "GL_TEXTURE_BINDING_2D_MULTISAMPLE_ARRAY", rs->iTextureBinding2DMultisampleArray);
-    }
-    else
-    #endif
-    {
-        MGL_PARAM_UNAVAIL( GL_MAX_COLOR_TEXTURE_SAMPLES );
-        MGL_PARAM_UNAVAIL( GL_MAX_DEPTH_TEXTURE_SAMPLES );
-        MGL_PARAM_UNAVAIL( GL_MAX_INTEGER_SAMPLES );
-        MGL_PARAM_UNAVAIL( GL_MAX_GEOMETRY_INPUT_COMPONENTS );
-        MGL_PARAM_UNAVAIL( GL_MAX_GEOMETRY_OUTPUT_COMPONENTS );
-        MGL_PARAM_UNAVAIL( GL_MAX_GEOMETRY_TEXTURE_IMAGE_UNITS );
-        MGL_PARAM_UNAVAIL( GL_MAX_GEOMETRY_UNIFORM_COMPONENTS );
-        MGL_PARAM_UNAVAIL( GL_MAX_FRAGMENT_INPUT_COMPONENTS );
-        MGL_PARAM_UNAVAIL( GL_MAX_VERTEX_OUTPUT_COMPONENTS );
-        MGL_PARAM_UNAVAIL( GL_MAX_SAMPLE_MASK_WORDS );
-        MGL_PARAM_UNAVAIL( GL_MAX_SERVER_WAIT_TIMEOUT );
-        MGL_PARAM_UNAVAIL( GL_PROGRAM_POINT_SIZE );
-        MGL_PARAM_UNAVAIL( GL_PROVOKING_VERTEX );
-        MGL_PARAM_UNAVAIL( GL_TEXTURE_BINDING_2D_MULTISAMPLE );
-        MGL_PARAM_UNAVAIL( GL_TEXTURE_BINDING_2D_MULTISAMPLE_ARRAY );
-    }
-
-    // *****************************************************************
-    //      GL_VERSION_3_3
-    // *****************************************************************
-
-    if (formatting->order == MGLFormattingOrderDefault)
-        mglNextHeadline(&out, "\nGL_VERSION_3_3");
+    return (MGLWatchList)list;
+}
 
-    #ifdef GL_VERSION_3_3
-    if (MGL_VERSION_MIN(3, 3))
-    {
-        mglNextParamInteger(&out, "GL_SAMPLER_BINDING", rs->iSamplerBinding);
-        mglNextParamInteger64(&out, "GL_TIMESTAMP", rs->iTimestamp);
-    }
-    else
-    #endif
-    {
-        MGL_PARAM_UNAVAIL( GL_SAMPLER_BINDING );
-        MGL_PARAM_UNAVAIL( GL_TIMESTAMP );
-    }
+void mglFreeWatchList(MGLWatchList list)
+{
+    if (list)
+        mglFree(NULL, list, ((MGLWatchListInternal*)list)->memory_size);
+}
+
+size_t mglGetWatchListSize(MGLWatchList list)
+{
+    return ((const MGLWatchListInternal*)list)->size;
+}
 
-    // *****************************************************************
-    //      GL_VERSION_4_0
-    // *****************************************************************
+const MGLFieldDescriptor* mglGetWatchListEntry(MGLWatchList list, size_t entry, size_t* offset, size_t* count)
+{
+    const MGLWatchListInternal* watch_list = (const MGLWatchListInternal*)list;
 
-    if (formatting->order == MGLFormattingOrderDefault)
-        mglNextHeadline(&out, "\nGL_VERSION_4_0");
+    if (entry >= watch_list->num_entries || watch_list->entries[entry].field == NULL)
+        return NULL;
 
-    #ifdef GL_VERSION_4_0
-    if (MGL_VERSION_MIN(4, 0))
-    {
-        mglNextParamInteger(&out, "GL_MAX_TRANSFORM_FEEDBACK_BUFFERS", rs->iMaxTransformFeedbackBuffers);
-        mglNextParamInteger(&out, "GL_PATCH_DEFAULT_INNER_LEVEL", rs->iPatchDefaultInnerLevel);
-        mglNextParamInteger(&out, "GL_PATCH_DEFAULT_OUTER_LEVEL", rs->iPatchDefaultOuterLevel);
-        mglNextParamInteger(&out, "GL_PATCH_VERTICES", rs->iPatchVertices);
-    }
-    else
-    #endif
-    {
-        MGL_PARAM_UNAVAIL( GL_MAX_TRANSFORM_FEEDBACK_BUFFERS );
-    }
+    if (offset != NULL)
+        *offset = watch_list->entries[entry].offset;
+    if (count != NULL)
+        *count = watch_list->entries[entry].count;
 
-    // *****************************************************************
-    //      GL_VERSION_4_1
-    // *****************************************************************
+    return watch_list->entries[entry].field;
+}
 
-    if (formatting->order == MGLFormattingOrderDefault)
-        mglNextHeadline(&out, "\nGL_VERSION_4_1");
+void mglQueryWatchList(MGLWatchList list, void* data)
+{
+    const MGLWatchListInternal* watch_list = (const MGLWatchListInternal*)list;
 
-    #ifdef GL_VERSION_4_1
-    if (MGL_VERSION_MIN(4, 1))
+    for (size_t i = 0; i < watch_list->num_ops; ++i)
     {
-        mglNextParamEnum(&out, "GL_IMPLEMENTATION_COLOR_READ_FORMAT", rs->iImplementationColorReadFormat, mglImplementationColorReadFormatStr);
-        mglNextParamEnum(&out, "GL_IMPLEMENTATION_COLOR_READ_TYPE", rs->iImplementationColorReadType, mglImplementationColorReadTypeStr);
-        mglNextParamEnum(&out, "GL_LAYER_PROVOKING_VERTEX", rs->iLayerProvokingVertex, mglProvokingVertexModeStr);
-        mglNextParamInteger(&out, "GL_MAX_VARYING_VECTORS", rs->iMaxVaryingVectors);
-        mglNextParamInteger(&out, "GL_MAX_VIEWPORTS", rs->iMaxViewports);
-        mglNextParamIntegerArray(&out, "GL_VIEWPORT_BOUNDS_RANGE", rs->iViewportBoundsRange, 2, 2, 0);
-        mglNextParamEnum(&out, "GL_VIEWPORT_INDEX_PROVOKING_VERTEX", rs->iViewportIndexProvokingVertex, mglProvokingVertexModeStr);
-        mglNextParamInteger(&out, "GL_VIEWPORT_SUBPIXEL_BITS", rs->iViewportSubPixelBits);
-        mglNextParamInteger(&out, "GL_MAX_FRAGMENT_UNIFORM_VECTORS", rs->iMaxFragmentUniformVectors);
-        mglNextParamInteger(&out, "GL_MAX_VERTEX_UNIFORM_VECTORS", rs->iMaxVertexUniformVectors);
-        mglNextParamInteger(&out, "GL_NUM_SHADER_BINARY_FORMATS", rs->iNumShaderBinaryFormats);
-        mglNextParamIntegerArray(&out, "GL_SHADER_BINARY_FORMATS", rs->iShaderBinaryFormats, rs->iNumShaderBinaryFormats, MGL_MAX_SHADER_BINARY_FORMATS, formatting->enable_hex);
-        mglNextParamInteger(&out, "GL_NUM_PROGRAM_BINARY_FORMATS", rs->iNumProgramBinaryFormats);
-        mglNextParamIntegerArray(&out, "GL_PROGRAM_BINARY_FORMATS", rs->iProgramBinaryFormats, rs->iNumProgramBinaryFormats, MGL_MAX_PROGRAM_BINARY_FORMATS, formatting->enable_hex);
-        mglNextParamInteger(&out, "GL_PROGRAM_PIPELINE_BINDING", rs->iProgramPipelineBinding);
-        mglNextParamBoolean(&out, "GL_SHADER_COMPILER", rs->bShaderCompiler);
+        const MGLWatchOpInternal*   op  = &(watch_list->ops[i]);
+        char*                       val = (char*)data + op->offset;
+
+        switch (op->op)
+        {
+            case MGLWatchOpBoolean:
+                glGetBooleanv(op->pname, (GLboolean*)val);
+                break;
+            case MGLWatchOpInteger:
+                glGetIntegerv(op->pname, (GLint*)val);
+                break;
+            #ifdef GL_VERSION_3_2
+            case MGLWatchOpInteger64:
+                glGetInteger64v(op->pname, (GLint64*)val);
+                break;
+            #endif // /GL_VERSION_3_2
+            case MGLWatchOpFloat:
+                glGetFloatv(op->pname, (GLfloat*)val);
+                break;
+            case MGLWatchOpDouble:
+                glGetDoublev(op->pname, (GLdouble*)val);
+                break;
+            #ifdef GL_VERSION_3_0
+            case MGLWatchOpIntegerIndexed:
+                glGetIntegeri_v(op->pname, op->index, (GLint*)val);
+                break;
+            #endif // /GL_VERSION_3_0
+            #ifdef GL_VERSION_3_2
+            case MGLWatchOpInteger64Indexed:
+                glGetInteger64i_v(op->pname, op->index, (GLint64*)val);
+                break;
+            #endif // /GL_VERSION_3_2
+            default:
+                break;
+        }
     }
-    else
-    #endif // /GL_VERSION_4_1
+}
+
+#ifdef MENTAL_GL_PRINT_QUEUE
+
+MGLPrintQueue mglCreatePrintQueue(size_t capacity, const MGLFormattingOptions* formatting, MGLWriteProc proc, void* user)
+{
+    MGLPrintQueueInternal* queue = (MGLPrintQueueInternal*)mglAlloc(NULL, sizeof(MGLPrintQueueInternal));
+    if (queue == NULL)
+        return NULL;
+
+    queue->capacity     = MGL_MAX(capacity, 1);
+    queue->slots        = (MGLPrintQueueSlot*)mglAlloc(NULL, sizeof(MGLPrintQueueSlot) * queue->capacity);
+    if (queue->slots == NULL)
     {
-        MGL_PARAM_UNAVAIL( GL_IMPLEMENTATION_COLOR_READ_FORMAT );
-        MGL_PARAM_UNAVAIL( GL_IMPLEMENTATION_COLOR_READ_TYPE );
-        MGL_PARAM_UNAVAIL( GL_LAYER_PROVOKING_VERTEX );
-        MGL_PARAM_UNAVAIL( GL_MAX_VARYING_VECTORS );
-        MGL_PARAM_UNAVAIL( GL_MAX_VIEWPORTS );
-        MGL_PARAM_UNAVAIL( GL_VIEWPORT_BOUNDS_RANGE );
-        MGL_PARAM_UNAVAIL( GL_VIEWPORT_INDEX_PROVOKING_VERTEX );
-        MGL_PARAM_UNAVAIL( GL_VIEWPORT_SUBPIXEL_BITS );
-        MGL_PARAM_UNAVAIL( GL_MAX_FRAGMENT_UNIFORM_VECTORS );
-        MGL_PARAM_UNAVAIL( GL_MAX_VERTEX_UNIFORM_VECTORS );
-        MGL_PARAM_UNAVAIL( GL_NUM_SHADER_BINARY_FORMATS );
-        MGL_PARAM_UNAVAIL( GL_SHADER_BINARY_FORMATS );
-        MGL_PARAM_UNAVAIL( GL_NUM_PROGRAM_BINARY_FORMATS );
-        MGL_PARAM_UNAVAIL( GL_PROGRAM_BINARY_FORMATS );
-        MGL_PARAM_UNAVAIL( GL_PROGRAM_PIPELINE_BINDING );
-        MGL_PARAM_UNAVAIL( GL_SHADER_COMPILER );
-    }
-
-    // *****************************************************************
-    //      GL_VERSION_4_2
-    // *****************************************************************
-
-    if (formatting->order == MGLFormattingOrderDefault)
-        mglNextHeadline(&out, "\nGL_VERSION_4_2");
-
-    #ifdef GL_VERSION_4_2
-    if (MGL_VERSION_MIN(4, 2))
-    {
-        mglNextParamInteger(&out, "GL_MAX_COMBINED_ATOMIC_COUNTERS", rs->iMaxCombinedAtomicCounters);
-        mglNextParamInteger(&out, "GL_MAX_VERTEX_ATOMIC_COUNTERS", rs->iMaxVertexAtomicCounters);
-        mglNextParamInteger(&out, "GL_MAX_TESS_CONTROL_ATOMIC_COUNTERS", rs->iMaxTessControlAtomicCounters);
-        mglNextParamInteger(&out, "GL_MAX_TESS_EVALUATION_ATOMIC_COUNTERS", rs->iMaxTessEvaluationAtomicCounters);
-        mglNextParamInteger(&out, "GL_MAX_GEOMETRY_ATOMIC_COUNTERS", rs->iMaxGeometryAtomicCounters);
-        mglNextParamInteger(&out, "GL_MAX_FRAGMENT_ATOMIC_COUNTERS", rs->iMaxFragmentAtomicCounters);
-        mglNextParamInteger(&out, "GL_MIN_MAP_BUFFER_ALIGNMENT", rs->iMinMapBufferAlignment);
+        mglFree(NULL, queue, sizeof(MGLPrintQueueInternal));
+        return NULL;
     }
-    else
-    #endif // /GL_VERSION_4_2
+
+    queue->formatting   = (formatting != NULL ? *formatting : g_MGLFormattingDefault);
+    queue->proc         = proc;
+    queue->user         = user;
+
+    mglMutexInit(&(queue->mutex));
+    mglConditionInit(&(queue->queued));
+    mglConditionInit(&(queue->printed));
+
+    #ifdef _WIN32
+    queue->thread = CreateThread(NULL, 0, mglPrintQueueThreadProc, queue, 0, NULL);
+    if (queue->thread == NULL)
+    #else
+    if (pthread_create(&(queue->thread), NULL, mglPrintQueueThreadProc, queue) != 0)
+    #endif
     {
-        MGL_PARAM_UNAVAIL( GL_MAX_COMBINED_ATOMIC_COUNTERS );
-        MGL_PARAM_UNAVAIL( GL_MAX_VERTEX_ATOMIC_COUNTERS );
-        MGL_PARAM_UNAVAIL( GL_MAX_TESS_CONTROL_ATOMIC_COUNTERS );
-        MGL_PARAM_UNAVAIL( GL_MAX_TESS_EVALUATION_ATOMIC_COUNTERS );
-        MGL_PARAM_UNAVAIL( GL_MAX_GEOMETRY_ATOMIC_COUNTERS );
-        MGL_PARAM_UNAVAIL( GL_MAX_FRAGMENT_ATOMIC_COUNTERS );
-        MGL_PARAM_UNAVAIL( GL_MIN_MAP_BUFFER_ALIGNMENT );
+        // Release synchronization objects, since no thread will ever wait on them
+        mglConditionFree(&(queue->printed));
+        mglConditionFree(&(queue->queued));
+        mglMutexFree(&(queue->mutex));
+        mglFree(NULL, queue->slots, sizeof(MGLPrintQueueSlot) * queue->capacity);
+        mglFree(NULL, queue, sizeof(MGLPrintQueueInternal));
+        return NULL;
     }
 
-    // *****************************************************************
-    //      GL_VERSION_4_3
-    // *****************************************************************
+    return (MGLPrintQueue)queue;
+}
 
-    if (formatting->order == MGLFormattingOrderDefault)
-        mglNextHeadline(&out, "\nGL_VERSION_4_3");
+void mglFreePrintQueue(MGLPrintQueue queue)
+{
+    MGLPrintQueueInternal* q = (MGLPrintQueueInternal*)queue;
 
-    #ifdef GL_VERSION_4_3
-    if (MGL_VERSION_MIN(4, 3))
+    if (q)
     {
-        mglNextParamUInteger(&out, "GL_MAX_ELEMENT_INDEX", (GLuint)(rs->iMaxElementIndex));
-        mglNextParamInteger(&out, "GL_MAX_COMBINED_COMPUTE_UNIFORM_COMPONENTS", rs->iMaxCombinedComputeUniformComponents);
-        mglNextParamInteger(&out, "GL_MAX_COMBINED_SHADER_STORAGE_BLOCKS", rs->iMaxCombinedShaderStorageBlocks);
-        mglNextParamInteger(&out, "GL_MAX_COMPUTE_UNIFORM_BLOCKS", rs->iMaxComputeUniformBlocks);
-        mglNextParamInteger(&out, "GL_MAX_COMPUTE_TEXTURE_IMAGE_UNITS", rs->iMaxComputeTextureImageUnits);
-        mglNextParamInteger(&out, "GL_MAX_COMPUTE_UNIFORM_COMPONENTS", rs->iMaxComputeUniformComponents);
-        mglNextParamInteger(&out, "GL_MAX_COMPUTE_ATOMIC_COUNTERS", rs->iMaxComputeAtomicCounters);
-        mglNextParamInteger(&out, "GL_MAX_COMPUTE_ATOMIC_COUNTER_BUFFERS", rs->iMaxComputeAtomicCounterBuffers);
-        #ifdef MENTAL_GL_GETINTEGERI_V
-        mglNextParamIntegerArray(&out, "GL_MAX_COMPUTE_WORK_GROUP_COUNT", rs->iMaxComputeWorkGroupCount, 3, 3, 0);
-        #else
-        MGL_PARAM_UNAVAIL( GL_MAX_COMPUTE_WORK_GROUP_COUNT );
-        #endif
-        mglNextParamInteger(&out, "GL_MAX_COMPUTE_WORK_GROUP_INVOCATIONS", rs->iMaxComputeWorkGroup);
-        #ifdef MENTAL_GL_GETINTEGERI_V
-        mglNextParamIntegerArray(&out, "GL_MAX_COMPUTE_WORK_GROUP_SIZE", rs->iMaxComputeWorkGroupSize, 3, 3, 0);
-        #else
-        MGL_PARAM_UNAVAIL( GL_MAX_COMPUTE_WORK_GROUP_SIZE );
-        #endif
-        mglNextParamInteger(&out, "GL_DISPATCH_INDIRECT_BUFFER_BINDING", rs->iDispatchIndirectBufferBinding);
-        mglNextParamInteger(&out, "GL_MAX_DEBUG_GROUP_STACK_DEPTH", rs->iMaxDebugGroupStackDepth);
-        mglNextParamInteger(&out, "GL_DEBUG_GROUP_STACK_DEPTH", rs->iDebugGroupStackDepth);
-        mglNextParamInteger(&out, "GL_MAX_LABEL_LENGTH", rs->iMaxLabelLength);
-        mglNextParamInteger(&out, "GL_MAX_UNIFORM_LOCATIONS", rs->iMaxUniformLocations);
-        mglNextParamInteger(&out, "GL_MAX_FRAMEBUFFER_WIDTH", rs->iMaxFramebufferWidth);
-        mglNextParamInteger(&out, "GL_MAX_FRAMEBUFFER_HEIGHT", rs->iMaxFramebufferHeight);
-        mglNextParamInteger(&out, "GL_MAX_FRAMEBUFFER_LAYERS", rs->iMaxFramebufferLayers);
-        mglNextParamInteger(&out, "GL_MAX_FRAMEBUFFER_SAMPLES", rs->iMaxFramebufferSamples);
-        mglNextParamInteger(&out, "GL_MAX_VERTEX_SHADER_STORAGE_BLOCKS", rs->iMaxVertexShaderStorageBlocks);
-        mglNextParamInteger(&out, "GL_MAX_TESS_CONTROL_SHADER_STORAGE_BLOCKS", rs->iMaxTessControlShaderStorageBlocks);
-        mglNextParamInteger(&out, "GL_MAX_TESS_EVALUATION_SHADER_STORAGE_BLOCKS", rs->iMaxTessEvaluationShaderStorageBlocks);
-        mglNextParamInteger(&out, "GL_MAX_GEOMETRY_SHADER_STORAGE_BLOCKS", rs->iMaxGeometryShaderStorageBlocks);
-        mglNextParamInteger(&out, "GL_MAX_FRAGMENT_SHADER_STORAGE_BLOCKS", rs->iMaxFragmentShaderStorageBlocks);
-        mglNextParamInteger(&out, "GL_MAX_COMPUTE_SHADER_STORAGE_BLOCKS", rs->iMaxComputeShaderStorageBlocks);
-        mglNextParamInteger(&out, "GL_TEXTURE_BUFFER_OFFSET_ALIGNMENT", rs->iTextureBufferOffsetAlignment);
-        #ifdef MENTAL_GL_GETINTEGERI_V
-        mglNextParamIntegerArray(&out, "GL_VERTEX_BINDING_DIVISOR", rs->iVertexBindingDivisor, MGL_MAX_VERTEX_BUFFER_BINDINGS, MGL_MAX_VERTEX_BUFFER_BINDINGS, 0);
-        mglNextParamIntegerArray(&out, "GL_VERTEX_BINDING_OFFSET", rs->iVertexBindingOffset, MGL_MAX_VERTEX_BUFFER_BINDINGS, MGL_MAX_VERTEX_BUFFER_BINDINGS, 0);
-        mglNextParamIntegerArray(&out, "GL_VERTEX_BINDING_STRIDE", rs->iVertexBindingStride, MGL_MAX_VERTEX_BUFFER_BINDINGS, MGL_MAX_VERTEX_BUFFER_BINDINGS, 0);
-        #else
-        MGL_PARAM_UNAVAIL( GL_VERTEX_BINDING_DIVISOR );
-        MGL_PARAM_UNAVAIL( GL_VERTEX_BINDING_OFFSET );
-        MGL_PARAM_UNAVAIL( GL_VERTEX_BINDING_STRIDE );
-        #endif
-        mglNextParamInteger(&out, "GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET", rs->iMaxVertexAttribRelativeOffset);
-        mglNextParamInteger(&out, "GL_MAX_VERTEX_ATTRIB_BINDINGS", rs->iMaxVertexAttribBindings);
-        mglNextParamInteger(&out, "GL_MAX_SHADER_STORAGE_BUFFER_BINDINGS", rs->iMaxShaderStorageBufferBindings);
-        #ifdef MENTAL_GL_GETINTEGERI_V
-        mglNextParamIntegerArray(&out, "GL_SHADER_STORAGE_BUFFER_BINDING", rs->iShaderStorageBufferBinding, MGL_MAX_SHADER_STORAGE_BUFFER_BINDINGS, MGL_MAX_SHADER_STORAGE_BUFFER_BINDINGS, 0);
-        #else
-        MGL_PARAM_UNAVAIL( GL_SHADER_STORAGE_BUFFER_BINDING );
-        #endif
-        mglNextParamInteger(&out, "GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT", rs->iShaderStorageBufferOffsetAlignment);
-        #ifdef MENTAL_GL_GETINTEGER64I_V
-        mglNextParamInteger64Array(&out, "GL_SHADER_STORAGE_BUFFER_SIZE", rs->iShaderStorageBufferSize, MGL_MAX_SHADER_STORAGE_BUFFER_BINDINGS, MGL_MAX_SHADER_STORAGE_BUFFER_BINDINGS);
-        mglNextParamInteger64Array(&out, "GL_SHADER_STORAGE_BUFFER_START", rs->iShaderStorageBufferStart, MGL_MAX_SHADER_STORAGE_BUFFER_BINDINGS, MGL_MAX_SHADER_STORAGE_BUFFER_BINDINGS);
+        // Stop background thread once all queued states are printed
+        mglMutexLock(&(q->mutex));
+        q->quit = 1;
+        mglConditionSignal(&(q->queued));
+        mglMutexUnlock(&(q->mutex));
+
+        #ifdef _WIN32
+        WaitForSingleObject(q->thread, INFINITE);
+        CloseHandle(q->thread);
         #else
-        MGL_PARAM_UNAVAIL( GL_SHADER_STORAGE_BUFFER_SIZE );
-        MGL_PARAM_UNAVAIL( GL_SHADER_STORAGE_BUFFER_START );
+        pthread_join(q->thread, NULL);
         #endif
-    }
-    else
-    #endif // /GL_VERSION_4_3
-    {
-        MGL_PARAM_UNAVAIL( GL_MAX_ELEMENT_INDEX );
-        MGL_PARAM_UNAVAIL( GL_MAX_COMPUTE_UNIFORM_BLOCKS );
-        MGL_PARAM_UNAVAIL( GL_MAX_COMPUTE_TEXTURE_IMAGE_UNITS );
-        MGL_PARAM_UNAVAIL( GL_MAX_COMPUTE_UNIFORM_COMPONENTS );
-        MGL_PARAM_UNAVAIL( GL_MAX_COMPUTE_ATOMIC_COUNTERS );
-        MGL_PARAM_UNAVAIL( GL_MAX_COMPUTE_ATOMIC_COUNTER_BUFFERS );
-        MGL_PARAM_UNAVAIL( GL_MAX_COMBINED_COMPUTE_UNIFORM_COMPONENTS );
-        MGL_PARAM_UNAVAIL( GL_MAX_COMPUTE_WORK_GROUP_COUNT );
-        MGL_PARAM_UNAVAIL( GL_MAX_COMPUTE_WORK_GROUP_INVOCATIONS );
-        MGL_PARAM_UNAVAIL( GL_MAX_COMPUTE_WORK_GROUP_SIZE );
-        MGL_PARAM_UNAVAIL( GL_DISPATCH_INDIRECT_BUFFER_BINDING );
-        MGL_PARAM_UNAVAIL( GL_MAX_DEBUG_GROUP_STACK_DEPTH );
-        MGL_PARAM_UNAVAIL( GL_DEBUG_GROUP_STACK_DEPTH );
-        MGL_PARAM_UNAVAIL( GL_MAX_LABEL_LENGTH );
-        MGL_PARAM_UNAVAIL( GL_MAX_UNIFORM_LOCATIONS );
-        MGL_PARAM_UNAVAIL( GL_MAX_FRAMEBUFFER_WIDTH );
-        MGL_PARAM_UNAVAIL( GL_MAX_FRAMEBUFFER_HEIGHT );
-        MGL_PARAM_UNAVAIL( GL_MAX_FRAMEBUFFER_LAYERS );
-        MGL_PARAM_UNAVAIL( GL_MAX_FRAMEBUFFER_SAMPLES );
-        MGL_PARAM_UNAVAIL( GL_MAX_VERTEX_SHADER_STORAGE_BLOCKS );
-        MGL_PARAM_UNAVAIL( GL_MAX_TESS_CONTROL_SHADER_STORAGE_BLOCKS );
-        MGL_PARAM_UNAVAIL( GL_MAX_TESS_EVALUATION_SHADER_STORAGE_BLOCKS );
-        MGL_PARAM_UNAVAIL( GL_MAX_GEOMETRY_SHADER_STORAGE_BLOCKS );
-        MGL_PARAM_UNAVAIL( GL_MAX_FRAGMENT_SHADER_STORAGE_BLOCKS );
-        MGL_PARAM_UNAVAIL( GL_MAX_COMPUTE_SHADER_STORAGE_BLOCKS );
-        MGL_PARAM_UNAVAIL( GL_TEXTURE_BUFFER_OFFSET_ALIGNMENT );
-        MGL_PARAM_UNAVAIL( GL_VERTEX_BINDING_DIVISOR );
-        MGL_PARAM_UNAVAIL( GL_VERTEX_BINDING_OFFSET );
-        MGL_PARAM_UNAVAIL( GL_VERTEX_BINDING_STRIDE );
-        MGL_PARAM_UNAVAIL( GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET );
-        MGL_PARAM_UNAVAIL( GL_MAX_VERTEX_ATTRIB_BINDINGS );
-        MGL_PARAM_UNAVAIL( GL_MAX_SHADER_STORAGE_BUFFER_BINDINGS );
-        MGL_PARAM_UNAVAIL( GL_SHADER_STORAGE_BUFFER_BINDING );
-        MGL_PARAM_UNAVAIL( GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT );
-        MGL_PARAM_UNAVAIL( GL_SHADER_STORAGE_BUFFER_SIZE );
-        MGL_PARAM_UNAVAIL( GL_SHADER_STORAGE_BUFFER_START );
-    }
-
-    // *****************************************************************
-    //      GL_VERSION_4_5
-    // *****************************************************************
-
-    if (formatting->order == MGLFormattingOrderDefault)
-        mglNextHeadline(&out, "\nGL_VERSION_4_5");
 
-    #ifdef GL_VERSION_4_5
-    if (MGL_VERSION_MIN(4, 5))
-    {
-        mglNextParamEnum(&out, "GL_CLIP_DEPTH_MODE", rs->iClipDepthMode, mglClipDepthModeStr);
-        mglNextParamEnum(&out, "GL_CLIP_ORIGIN", rs->iClipOrigin, mglClipOriginStr);
-    }
-    else
-    #endif // /GL_VERSION_4_5
-    {
-        MGL_PARAM_UNAVAIL( GL_CLIP_DEPTH_MODE );
-        MGL_PARAM_UNAVAIL( GL_CLIP_ORIGIN );
+        mglConditionFree(&(q->printed));
+        mglConditionFree(&(q->queued));
+        mglMutexFree(&(q->mutex));
+        mglFree(NULL, q->slots, sizeof(MGLPrintQueueSlot) * q->capacity);
+        mglFree(NULL, q, sizeof(MGLPrintQueueInternal));
     }
-
-    return mglPrintStringPairs(out, formatting);
-
-    #undef MGL_VERSION
-    #undef MGL_VERSION_MIN
-    #undef MGL_PARAM_UNAVAIL
 }
 
-MGLString mglPrintBindingPoints(const MGLBindingPoints* bp, const MGLFormattingOptions* formatting)
+int mglEnqueueRenderState(MGLPrintQueue queue, const MGLRenderState* rs)
 {
-    // Internal constant parameters
-    static const MGLFormattingOptions   g_formattingDefault = { ' ', 1, 200, MGLFormattingOrderDefault, 1, NULL };
+    MGLPrintQueueSlot* slot = mglAcquirePrintQueueSlot((MGLPrintQueueInternal*)queue);
 
-    if (formatting == NULL)
-        formatting = (&g_formattingDefault);
+    if (slot == NULL)
+        return 0;
 
-    // Provide array with all string parts
-    MGLStringInternal out_par[MGL_MAX_NUM_RENDER_STATES], out_val[MGL_MAX_NUM_RENDER_STATES];
+    slot->is_render_state   = 1;
+    slot->data.render_state = *rs;
+    mglSubmitPrintQueueSlot((MGLPrintQueueInternal*)queue);
 
-    memset(out_par, 0, sizeof(out_par));
-    memset(out_val, 0, sizeof(out_val));
+    return 1;
+}
 
-    MGLStringPairArray out = { out_par, out_val, 0 };
+int mglEnqueueBindingPoints(MGLPrintQueue queue, const MGLBindingPoints* bp)
+{
+    MGLPrintQueueSlot* slot = mglAcquirePrintQueueSlot((MGLPrintQueueInternal*)queue);
 
-    mglNextParamIntegerArray(&out, "GL_TEXTURE_BINDING_1D", bp->iTextureBinding1D, MGL_MAX_TEXTURE_LAYERS, MGL_MAX_TEXTURE_LAYERS, 0);
-    mglNextParamIntegerArray(&out, "GL_TEXTURE_BINDING_1D_ARRAY", bp->iTextureBinding1DArray, MGL_MAX_TEXTURE_LAYERS, MGL_MAX_TEXTURE_LAYERS, 0);
-    mglNextParamIntegerArray(&out, "GL_TEXTURE_BINDING_2D", bp->iTextureBinding2D, MGL_MAX_TEXTURE_LAYERS, MGL_MAX_TEXTURE_LAYERS, 0);
-    mglNextParamIntegerArray(&out, "GL_TEXTURE_BINDING_2D_ARRAY", bp->iTextureBinding2DArray, MGL_MAX_TEXTURE_LAYERS, MGL_MAX_TEXTURE_LAYERS, 0);
-    mglNextParamIntegerArray(&out, "GL_TEXTURE_BINDING_2D_MULTISAMPLE", bp->iTextureBinding2DMultisample, MGL_MAX_TEXTURE_LAYERS, MGL_MAX_TEXTURE_LAYERS, 0);
-    mglNextParamIntegerArray(&out, "GL_TEXTURE_BINDING_2D_MULTISAMPLE_ARRAY", bp->iTextureBinding2DMultisampleArray, MGL_MAX_TEXTURE_LAYERS, MGL_MAX_TEXTURE_LAYERS, 0);
-    mglNextParamIntegerArray(&out, "GL_TEXTURE_BINDING_3D", bp->iTextureBinding3D, MGL_MAX_TEXTURE_LAYERS, MGL_MAX_TEXTURE_LAYERS, 0);
-    mglNextParamIntegerArray(&out, "GL_TEXTURE_BINDING_BUFFER", bp->iTextureBindingBuffer, MGL_MAX_TEXTURE_LAYERS, MGL_MAX_TEXTURE_LAYERS, 0);
-    mglNextParamIntegerArray(&out, "GL_TEXTURE_BINDING_CUBE_MAP", bp->iTextureBindingCubeMap, MGL_MAX_TEXTURE_LAYERS, MGL_MAX_TEXTURE_LAYERS, 0);
-    mglNextParamIntegerArray(&out, "GL_TEXTURE_BINDING_RECTANGLE", bp->iTextureBindingRectangle, MGL_MAX_TEXTURE_LAYERS, MGL_MAX_TEXTURE_LAYERS, 0);
+    if (slot == NULL)
+        return 0;
 
-    return mglPrintStringPairs(out, formatting);
-}
+    slot->is_render_state       = 0;
+    slot->data.binding_points   = *bp;
+    mglSubmitPrintQueueSlot((MGLPrintQueueInternal*)queue);
 
-const char* mglGetUTF8String(MGLString s)
-{
-    return ((MGLStringInternal*)s)->buf;
+    return 1;
 }
 
-void mglFreeString(MGLString s)
+void mglFlushPrintQueue(MGLPrintQueue queue)
 {
-    if (s)
-    {
-        mglStringInternalFree((MGLStringInternal*)s);
-        free(s);
-    }
+    MGLPrintQueueInternal* q = (MGLPrintQueueInternal*)queue;
+
+    mglMutexLock(&(q->mutex));
+
+    while (q->count > 0)
+        mglConditionWait(&(q->printed), &(q->mutex));
+
+    mglMutexUnlock(&(q->mutex));
 }
 
+#endif // /MENTAL_GL_PRINT_QUEUE
+
 #ifdef __cplusplus
 } // /extern "C"
 #endif
@@ -2927,13 +8221,52 @@ void mglFreeString(MGLString s)
 //      UNDEF INTERNAL MACROS
 // *****************************************************************
 
-#undef PGL_CASE2STR
 #undef MGL_MIN
 #undef MGL_MAX
-#undef MGL_MALLOC
+#undef MGL_REALLOC
 #undef MGL_CALLOC
 #undef MGL_FREE
 #undef MGL_STRING_MIN_CAPACITY
+#undef MGL_NUM_RENDER_STATE_FIELDS
+#undef MGL_NUM_BINDING_POINTS_FIELDS
+#undef MGL_NUM_ENUM_NAMES
+#undef MGL_NUM_PACKED_BOOLEAN_FIELDS
+#undef MGL_NUM_PACKED_HOT_FIELDS
+#undef MGL_NUM_PACKED_FIELDS
+#undef MGL_PACKED_TIMESTAMP_WORDS
+#undef MGL_SNAPSHOT_FORMAT_VERSION
+#undef MGL_SNAPSHOT_HEADER_SIZE
+#undef MGL_SNAPSHOT_RECORD_SIZE
+#undef MGL_CAPTURE_ENTRY_SIZE
+#undef MGL_CAPTURE_RECORD_SIZE
+#undef MGL_HASH_LANES
+#undef MGL_MAX_SHADOW_CALL_FIELDS
+#undef MGL_REDUNDANCY_NO_FIELD
+#undef MGL_CACHE_LINE_SIZE
+#undef MGL_MAX_OBJECT_LEVELS
+#undef MGL_MIN_VERSION
+#undef MGL_MAX_VERSION
+#undef MGL_IS_VERSION_SUPPORTED
+#undef MGL_SORT_KEY_TEXTURE_UNITS
+#undef MGL_MAX_INDEXED_LIMITS
+#undef MGL_MAX_BOUND_OBJECTS
+#undef MGL_GL_VERSION_1_0
+#undef MGL_GL_VERSION_1_1
+#undef MGL_GL_VERSION_1_2
+#undef MGL_GL_VERSION_1_3
+#undef MGL_GL_VERSION_1_4
+#undef MGL_GL_VERSION_1_5
+#undef MGL_GL_VERSION_2_0
+#undef MGL_GL_VERSION_2_1
+#undef MGL_GL_VERSION_3_0
+#undef MGL_GL_VERSION_3_1
+#undef MGL_GL_VERSION_3_2
+#undef MGL_GL_VERSION_3_3
+#undef MGL_GL_VERSION_4_0
+#undef MGL_GL_VERSION_4_1
+#undef MGL_GL_VERSION_4_2
+#undef MGL_GL_VERSION_4_3
+#undef MGL_GL_VERSION_4_5
 #undef MGL_MAX_COMPRESSED_TEXTURE_FORMATS
 #undef MGL_MAX_PROGRAM_BINARY_FORMATS
 #undef MGL_MAX_SHADER_BINARY_FORMATS
@@ -2942,6 +8275,11 @@ void mglFreeString(MGLString s)
 #undef MGL_MAX_UNIFORM_BUFFER_BINDINGS
 #undef MGL_MAX_VERTEX_BUFFER_BINDINGS
 #undef MGL_MAX_TEXTURE_LAYERS
+#undef MGL_PACKED_RENDER_STATE_FLAG_WORDS
+#undef MGL_PACKED_RENDER_STATE_HOT_WORDS
+#undef MGL_PACKED_RENDER_STATE_COLD_WORDS
+#undef MGL_QUERY_STATS_VERSIONS
+#undef MGL_TRANSITION_TIERS
 
 #ifdef _MSC_VER
 #pragma warning(pop)
@@ -0,0 +1,724 @@
+/**
+ * MentalGL C++ wrapper (typed render state snapshots)
+ * Published 2018 under the public domain
+ *
+ * Authors:
+ *  - Lukas Hermanns (Creator)
+ *
+ * REQUIREMENTS:
+ *  C++17 and the GL header or loader that is also used for mental_gl.h. Only the public part of mental_gl.h is used, so it is still
+ *  implemented in a single source file as usual (see mental_gl.h).
+ *
+ * USAGE EXAMPLE:
+ *  #include "mental_gl.hpp"
+ *
+ *  // Select the fields to check at compile time
+ *  using DrawState = mgl::Snapshot<mgl::field::Blend, mgl::field::DepthTest, mgl::field::CurrentProgram, mgl::field::Viewport>;
+ *
+ *  // Query only the selected fields with one glGet call each
+ *  DrawState expected;
+ *  expected.Query();
+ *
+ *  // Do OpenGL stuff ...
+ *
+ *  // Compare against the current state and print only the fields that changed
+ *  DrawState actual;
+ *  actual.Query();
+ *  if (unsigned long long changed = actual.Diff(expected))
+ *      puts(actual.Print(nullptr, changed).c_str());
+ *
+ *  // Access a single field with its member type (e.g. GLint[4] for mgl::field::Viewport)
+ *  const GLint* viewport = actual.Get<mgl::field::Viewport>();
+ *
+ *  // Declare additional field tags with MGL_DECLARE_FIELD, e.g. for the 14th draw buffer
+ *  MGL_DECLARE_FIELD(DrawBuffer13, 2, 0, Framebuffer, GL_DRAW_BUFFER13, Enum, iDrawBuffer_i[13], mglEnumName);
+ */
+
+#ifndef MENTAL_GL_HPP
+#define MENTAL_GL_HPP
+
+
+#include "mental_gl.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+
+// *****************************************************************
+//      PUBLIC MACROS
+// *****************************************************************
+
+// Declares the field tag 'TAG' for the MGLRenderState member 'MEMBER', which is queried with 'PNAME' for GL MAJOR.MINOR and later.
+// 'TYPE' and 'CATEGORY' are the suffixes of MGLFieldType and MGLStateCategory, and 'PROC' converts enum values into names (or nullptr).
+#define MGL_DECLARE_FIELD(TAG, MAJOR, MINOR, CATEGORY, PNAME, TYPE, MEMBER, PROC)                                        \
+    struct TAG : ::mgl::Field<                                                                                           \
+        std::remove_reference_t<decltype(std::declval<MGLRenderState&>().MEMBER)>, offsetof(MGLRenderState, MEMBER),     \
+        PNAME, MGLFieldType##TYPE, ::mgl::Version(MAJOR, MINOR), MGLStateCategory##CATEGORY, PROC                        \
+    >                                                                                                                    \
+    {                                                                                                                    \
+        static constexpr const char* name = #PNAME;                                                                      \
+    }
+
+// Same as MGL_DECLARE_FIELD for fields that are queried per element with glGetIntegeri_v or glGetInteger64i_v up to their implementation limit (see MGLFieldFlagIndexed).
+#define MGL_DECLARE_INDEXED_FIELD(TAG, MAJOR, MINOR, CATEGORY, PNAME, TYPE, MEMBER, PROC)                                \
+    struct TAG : ::mgl::Field<                                                                                           \
+        std::remove_reference_t<decltype(std::declval<MGLRenderState&>().MEMBER)>, offsetof(MGLRenderState, MEMBER),     \
+        PNAME, MGLFieldType##TYPE, ::mgl::Version(MAJOR, MINOR), MGLStateCategory##CATEGORY, PROC, MGLFieldFlagIndexed   \
+    >                                                                                                                    \
+    {                                                                                                                    \
+        static constexpr const char* name = #PNAME;                                                                      \
+    }
+
+
+namespace mgl
+{
+
+
+// *****************************************************************
+//      PUBLIC FUNCTIONS
+// *****************************************************************
+
+// Returns the GL version encoded as ((MAJOR << 16) | MINOR), the same way as MGLFieldDescriptor::version.
+constexpr unsigned Version(unsigned major, unsigned minor)
+{
+    return ((major << 16) | minor);
+}
+
+// Maximum GL version as specified by MENTAL_GL_MAX_VERSION. Fields above this version are rejected at compile time.
+#ifdef MENTAL_GL_MAX_VERSION
+constexpr unsigned max_version = Version((MENTAL_GL_MAX_VERSION) / 10, (MENTAL_GL_MAX_VERSION) % 10);
+#else
+constexpr unsigned max_version = ~0u;
+#endif
+
+
+// *****************************************************************
+//      INTERNAL HELPERS
+// *****************************************************************
+
+namespace detail
+{
+
+// GL storage type of each field type, i.e. the element type of the MGLRenderState member
+template <MGLFieldType Type> struct FieldStorage                                { using type = GLint; };
+template <> struct FieldStorage<MGLFieldTypeBoolean>                            { using type = GLboolean; };
+template <> struct FieldStorage<MGLFieldTypeBooleanArray>                       { using type = GLboolean; };
+template <> struct FieldStorage<MGLFieldTypeInteger64>                          { using type = GLint64; };
+template <> struct FieldStorage<MGLFieldTypeInteger64Array>                     { using type = GLint64; };
+template <> struct FieldStorage<MGLFieldTypeFloat>                              { using type = GLfloat; };
+template <> struct FieldStorage<MGLFieldTypeFloatArray>                         { using type = GLfloat; };
+template <> struct FieldStorage<MGLFieldTypeDouble>                             { using type = GLdouble; };
+template <> struct FieldStorage<MGLFieldTypeDoubleArray>                        { using type = GLdouble; };
+
+// Returns a pointer to the first element of a scalar or array value
+template <typename T>
+std::remove_all_extents_t<T>* DataOf(T& value)
+{
+    if constexpr (std::is_array_v<T>)
+        return value;
+    else
+        return &value;
+}
+
+// Enum names of blend functions and stencil operations, where 0 is GL_ZERO rather than the preferred GL_NONE
+inline const char* ZeroEnumName(GLenum value)
+{
+    return (value == GL_ZERO ? "GL_ZERO" : mglEnumName(value));
+}
+
+// Implementation limits of indexed fields, each queried at most once per snapshot query
+struct IndexedLimitsCache
+{
+    GLenum      limits[8]   = {};
+    GLint       values[8]   = {};
+    std::size_t count       = 0;
+    unsigned    version     = 0;
+};
+
+// Returns the GL version of the current context, queried at most once per cache
+inline unsigned ContextVersion(IndexedLimitsCache& cache)
+{
+    if (cache.version == 0)
+    {
+        GLint major = 0, minor = 0;
+        #ifdef GL_VERSION_3_0
+        glGetIntegerv(GL_MAJOR_VERSION, &major);
+        glGetIntegerv(GL_MINOR_VERSION, &minor);
+        #endif
+        cache.version = ((static_cast<unsigned>(major) << 16) | static_cast<unsigned>(minor));
+    }
+    return cache.version;
+}
+
+// Returns the implementation limit of the number of elements of an indexed field for the current context, or 0 if the field has no such limit
+inline GLenum IndexedFieldLimit(GLenum pname, IndexedLimitsCache& cache)
+{
+    return mglGetIndexedFieldLimit(pname, ContextVersion(cache));
+}
+
+// Returns the number of elements of an indexed field that can be queried, i.e. 'count' clamped to its implementation limit
+inline GLuint IndexedFieldCount(GLenum pname, GLuint count, IndexedLimitsCache& cache)
+{
+    const GLenum limit = IndexedFieldLimit(pname, cache);
+    if (limit == 0)
+        return count;
+
+    GLint value = 0;
+    std::size_t i = 0;
+    while (i < cache.count && cache.limits[i] != limit)
+        ++i;
+
+    if (i < cache.count)
+        value = cache.values[i];
+    else
+    {
+        glGetIntegerv(limit, &value);
+        if (cache.count < sizeof(cache.limits)/sizeof(cache.limits[0]))
+        {
+            cache.limits[cache.count] = limit;
+            cache.values[cache.count] = value;
+            ++cache.count;
+        }
+    }
+
+    return (value <= 0 ? 0 : (static_cast<GLuint>(value) < count ? static_cast<GLuint>(value) : count));
+}
+
+// Returns the descriptor of the MGLRenderState field at the byte offset 'offset', or nullptr if no field starts there
+inline const MGLFieldDescriptor* FindFieldDescriptor(std::size_t offset)
+{
+    std::size_t num_fields = 0;
+    const MGLFieldDescriptor* fields = mglGetRenderStateFields(&num_fields);
+
+    for (std::size_t i = 0; i < num_fields; ++i)
+    {
+        if (fields[i].offset == offset)
+            return &(fields[i]);
+    }
+
+    return nullptr;
+}
+
+// Storage of a single field within a snapshot; all values are zero-initialized
+template <class F>
+struct Slot
+{
+    typename F::value_type value{};
+};
+
+// Returns true if all types are distinct
+template <class... Ts>
+struct AreDistinct : std::true_type {};
+
+template <class T, class... Ts>
+struct AreDistinct<T, Ts...> : std::bool_constant<(!std::is_same_v<T, Ts> && ...) && AreDistinct<Ts...>::value> {};
+
+template <class... Fields>
+constexpr std::size_t MaxNameLength()
+{
+    std::size_t len = 0;
+    ((len = (std::char_traits<char>::length(Fields::name) > len ? std::char_traits<char>::length(Fields::name) : len)), ...);
+    return len;
+}
+
+template <class... Fields>
+constexpr unsigned MaxVersion()
+{
+    unsigned version = 0;
+    ((version = (Fields::version > version ? Fields::version : version)), ...);
+    return version;
+}
+
+inline void AppendHex(std::string& s, unsigned value)
+{
+    char s_hex[11];
+    std::snprintf(s_hex, sizeof(s_hex), "0x%08X", value);
+    s += s_hex;
+}
+
+inline void AppendEnum(std::string& s, GLenum value, MGLEnumToStringProc proc)
+{
+    if (const char* s_val = (proc != nullptr ? proc(value) : nullptr))
+        s += s_val;
+    else
+        AppendHex(s, value);
+}
+
+// Appends a single element of the field 'F' in the same format as mglPrintRenderState
+template <class F>
+void AppendElement(std::string& s, const typename F::element_type& value, const MGLFormattingOptions& formatting)
+{
+    constexpr MGLFieldType type = F::type;
+
+    if constexpr (type == MGLFieldTypeBoolean || type == MGLFieldTypeBooleanArray)
+        s += (value ? "GL_TRUE" : "GL_FALSE");
+    else if constexpr (type == MGLFieldTypeFloat || type == MGLFieldTypeFloatArray || type == MGLFieldTypeDouble || type == MGLFieldTypeDoubleArray)
+    {
+        char s_val[64];
+        std::snprintf(s_val, sizeof(s_val), "%f", (double)value);
+        s += s_val;
+    }
+    else if constexpr (type == MGLFieldTypeInteger64 || type == MGLFieldTypeInteger64Array)
+        s += std::to_string((long long)value);
+    else if constexpr (type == MGLFieldTypeUInteger)
+        s += std::to_string((GLuint)value);
+    else if constexpr (type == MGLFieldTypeIntegerHex)
+        AppendHex(s, (unsigned)value);
+    else if constexpr (type == MGLFieldTypeIntegerArrayHex)
+    {
+        if (formatting.enable_hex)
+            AppendHex(s, (unsigned)value);
+        else
+            s += std::to_string(value);
+    }
+    else if constexpr (type == MGLFieldTypeEnum || type == MGLFieldTypeEnumArray)
+        AppendEnum(s, (GLenum)value, F::proc);
+    else if constexpr (type == MGLFieldTypeBitfield)
+    {
+        const GLbitfield bits = (GLbitfield)value;
+        if (bits == 0)
+            s += '0';
+        for (unsigned i = 0, num_flags = 0; i < 32; ++i)
+        {
+            const GLenum flag = (1u << i);
+            if ((bits & flag) != 0)
+            {
+                if (num_flags++ > 0)
+                    s += " | ";
+                AppendEnum(s, flag, F::proc);
+            }
+        }
+    }
+    else
+        s += std::to_string(value);
+}
+
+// Appends the value of the field 'F' in the same format as mglPrintRenderState; arrays are enclosed in braces
+template <class F>
+void AppendValue(std::string& s, const typename F::value_type& value, const MGLFormattingOptions& formatting)
+{
+    const typename F::element_type* data = DataOf(value);
+
+    if constexpr (std::is_array_v<typename F::value_type>)
+    {
+        s += "{ ";
+        for (std::size_t i = 0; i < F::count; ++i)
+        {
+            if (i > 0)
+                s += ", ";
+            AppendElement<F>(s, data[i], formatting);
+        }
+        s += " }";
+    }
+    else
+        AppendElement<F>(s, *data, formatting);
+}
+
+// Appends a line with the parameter name and its value; arrays above the array limit are split into one line per element
+inline void AppendLine(std::string& s, const char* par, const std::string& val, std::size_t max_par_len, const MGLFormattingOptions& formatting)
+{
+    const std::size_t par_len = std::char_traits<char>::length(par);
+
+    s += par;
+    s.append(max_par_len - par_len, formatting.separator);
+
+    if (val.size() > formatting.array_limit && !val.empty() && val.back() == '}')
+    {
+        for (std::size_t off = 0; off < val.size();)
+        {
+            const std::size_t next_off = val.find(',', off);
+            if (next_off == std::string::npos)
+            {
+                s.append(val, off, std::string::npos);
+                break;
+            }
+            s.append(val, off, next_off - off + 1);
+            s += '\n';
+            s.append(max_par_len + 1, formatting.separator);
+            off = next_off + 1;
+        }
+    }
+    else
+        s += val;
+
+    s += '\n';
+}
+
+} // /namespace detail
+
+
+// *****************************************************************
+//      PUBLIC TEMPLATES
+// *****************************************************************
+
+// Base of all field tags (see MGL_DECLARE_FIELD). Maps the MGLRenderState member of type 'T' at byte offset 'Offset' to its pname,
+// field type, minimum GL version, state category, and the function to convert enum values into names.
+template <typename T, std::size_t Offset, GLenum PName, MGLFieldType Type, unsigned FieldVersion, unsigned Category, MGLEnumToStringProc Proc = nullptr, unsigned Flags = 0>
+struct Field
+{
+    using value_type    = T;
+    using element_type  = std::remove_all_extents_t<T>;
+
+    static constexpr std::size_t            offset      = Offset;
+    static constexpr std::size_t            count       = sizeof(T) / sizeof(element_type);
+    static constexpr GLenum                 pname       = PName;
+    static constexpr MGLFieldType           type        = Type;
+    static constexpr unsigned               version     = FieldVersion;
+    static constexpr unsigned               category    = Category;
+    static constexpr unsigned               flags       = Flags;
+    static constexpr MGLEnumToStringProc    proc        = Proc;
+
+    static_assert(std::is_same_v<element_type, typename detail::FieldStorage<Type>::type>, "field type does not match the type of the MGLRenderState member");
+    static_assert(std::is_array_v<T> == (Type >= MGLFieldTypeIntegerArray), "array field types require an array member and vice versa");
+    static_assert((Flags & MGLFieldFlagIndexed) == 0 || std::is_same_v<element_type, GLint> || std::is_same_v<element_type, GLint64>, "indexed fields must be integer arrays");
+
+    // Queries the value of this field with a single glGet call, or one call per element for indexed fields.
+    static void Query(value_type& value)
+    {
+        detail::IndexedLimitsCache cache;
+        Query(value, cache);
+    }
+
+    // Queries the value of this field; indexed fields are clamped to their implementation limit, which is taken from or stored in 'cache', and the remaining elements are zeroed.
+    static void Query(value_type& value, detail::IndexedLimitsCache& cache)
+    {
+        element_type* data = detail::DataOf(value);
+
+        if constexpr ((Flags & MGLFieldFlagIndexed) != 0)
+        {
+            const GLuint num = detail::IndexedFieldCount(PName, count, cache);
+            std::fill(data + num, data + count, element_type(0));
+
+            for (GLuint i = 0; i < num; ++i)
+            {
+                if constexpr (std::is_same_v<element_type, GLint64>)
+                {
+                    #ifdef GL_VERSION_3_2
+                    glGetInteger64i_v(PName, i, &(data[i]));
+                    #else
+                    static_assert(sizeof(T) == 0, "glGetInteger64i_v requires GL 3.2");
+                    #endif
+                }
+                else
+                {
+                    #ifdef GL_VERSION_3_0
+                    glGetIntegeri_v(PName, i, &(data[i]));
+                    #else
+                    static_assert(sizeof(T) == 0, "glGetIntegeri_v requires GL 3.0");
+                    #endif
+                }
+            }
+        }
+        else if constexpr (std::is_same_v<element_type, GLboolean>)
+            glGetBooleanv(PName, data);
+        else if constexpr (std::is_same_v<element_type, GLint64>)
+        {
+            #ifdef GL_VERSION_3_2
+            glGetInteger64v(PName, data);
+            #else
+            static_assert(sizeof(T) == 0, "glGetInteger64v requires GL 3.2");
+            #endif
+        }
+        else if constexpr (std::is_same_v<element_type, GLfloat>)
+            glGetFloatv(PName, data);
+        else if constexpr (std::is_same_v<element_type, GLdouble>)
+            glGetDoublev(PName, data);
+        else
+            glGetIntegerv(PName, data);
+    }
+};
+
+// Returns true if the field tag 'F' matches its descriptor in mglGetRenderStateFields, i.e. it has the same offset, pname, field type, GL version, category, flags, and
+// number of elements. Field tags repeat this metadata for compile-time dispatch, so this detects tags that diverge from mental_gl.h. Enum name functions are not compared.
+template <class F>
+bool IsFieldConsistent()
+{
+    const MGLFieldDescriptor* desc = detail::FindFieldDescriptor(F::offset);
+    return
+    (
+        desc != nullptr                 &&
+        desc->pname     == F::pname     &&
+        desc->type      == F::type      &&
+        desc->version   == F::version   &&
+        desc->category  == F::category  &&
+        desc->flags     == F::flags     &&
+        (F::type == MGLFieldTypeBitfield || desc->count == F::count)
+    );
+}
+
+// Returns true if all specified field tags match their descriptors in mglGetRenderStateFields (see IsFieldConsistent).
+template <class... Fields>
+bool AreFieldsConsistent()
+{
+    return (IsFieldConsistent<Fields>() && ...);
+}
+
+// Render state snapshot of the fields selected at compile time. Only these fields are queried, compared, hashed, and printed, in the specified order.
+// The caller must ensure that the GL context provides at least 'min_version'; no version or extension checks are made at runtime.
+template <class... Fields>
+class Snapshot : private detail::Slot<Fields>...
+{
+
+    public:
+
+        static constexpr std::size_t    num_fields  = sizeof...(Fields);                        // Number of selected fields.
+        static constexpr unsigned       min_version = detail::MaxVersion<Fields...>();          // Minimum GL version to query all fields, encoded as ((MAJOR << 16) | MINOR).
+        static constexpr unsigned       categories  = (0u | ... | Fields::category);            // Bitwise OR of the MGLStateCategory flags of all fields.
+
+        static_assert(num_fields <= 64, "snapshots are limited to 64 fields, one bit per field for Diff");
+        static_assert(detail::AreDistinct<Fields...>::value, "snapshot fields must be distinct");
+        static_assert(min_version <= max_version, "snapshot field requires a GL version above MENTAL_GL_MAX_VERSION");
+
+    public:
+
+        // Queries all selected fields from the current GL context. In debug builds, the field tags are checked once against mglGetRenderStateFields.
+        void Query()
+        {
+            #ifndef NDEBUG
+            static const bool consistent = AreFieldsConsistent<Fields...>();
+            assert(consistent && "field tags do not match mglGetRenderStateFields");
+            #endif
+
+            detail::IndexedLimitsCache cache;
+            (Fields::Query(ValueOf<Fields>(), cache), ...);
+        }
+
+        // Copies all selected fields from the specified render state, e.g. as queried by mglQueryRenderState.
+        void Load(const MGLRenderState& render_state)
+        {
+            (std::memcpy(&(ValueOf<Fields>()), reinterpret_cast<const char*>(&render_state) + Fields::offset, sizeof(typename Fields::value_type)), ...);
+        }
+
+        // Copies all selected fields into the specified render state and leaves all other fields untouched.
+        void Store(MGLRenderState& render_state) const
+        {
+            (std::memcpy(reinterpret_cast<char*>(&render_state) + Fields::offset, &(ValueOf<Fields>()), sizeof(typename Fields::value_type)), ...);
+        }
+
+        // Returns the value of the field 'F' with the type of its MGLRenderState member.
+        template <class F>
+        typename F::value_type& Get()
+        {
+            return ValueOf<F>();
+        }
+
+        // Returns the value of the field 'F' with the type of its MGLRenderState member.
+        template <class F>
+        const typename F::value_type& Get() const
+        {
+            return ValueOf<F>();
+        }
+
+        // Returns a bitmask with the i-th bit set if the i-th field differs from 'rhs'. Fields are compared bitwise like in mglDiffRenderState.
+        unsigned long long Diff(const Snapshot& rhs) const
+        {
+            unsigned long long changed = 0, bit = 1;
+            ((changed |= (std::memcmp(&(ValueOf<Fields>()), &(rhs.ValueOf<Fields>()), sizeof(typename Fields::value_type)) != 0 ? bit : 0), bit <<= 1), ...);
+            return changed;
+        }
+
+        // Returns a 64-bit hash (FNV-1a) of all selected fields. Only comparable with hashes of the same snapshot type, and not with mglHashRenderState.
+        unsigned long long Hash() const
+        {
+            unsigned long long h = 0xCBF29CE484222325ull;
+            (HashBytes(h, &(ValueOf<Fields>()), sizeof(typename Fields::value_type)), ...);
+            return h;
+        }
+
+        // Prints the fields that are selected in 'mask' (see Diff) as text output of mglPrintRenderState, except for the GL version headlines.
+        // Only 'separator', 'distance', 'array_limit', and 'enable_hex' of the formatting options are used.
+        std::string Print(const MGLFormattingOptions* formatting = nullptr, unsigned long long mask = ~0ull) const
+        {
+            static const MGLFormattingOptions formatting_default = { ' ', 1, 200, MGLFormattingOrderDefault, 1, nullptr, 0, nullptr, nullptr, MGLFormattingOutputText };
+            if (formatting == nullptr)
+                formatting = &formatting_default;
+
+            const std::size_t max_par_len = detail::MaxNameLength<Fields...>() + formatting->distance;
+
+            std::string s, val;
+            unsigned long long bit = 1;
+
+            (PrintField<Fields>(s, val, max_par_len, *formatting, mask, bit), ...);
+
+            return s;
+        }
+
+        friend bool operator == (const Snapshot& lhs, const Snapshot& rhs)
+        {
+            return (lhs.Diff(rhs) == 0);
+        }
+
+        friend bool operator != (const Snapshot& lhs, const Snapshot& rhs)
+        {
+            return (lhs.Diff(rhs) != 0);
+        }
+
+    private:
+
+        template <class F>
+        typename F::value_type& ValueOf()
+        {
+            return static_cast<detail::Slot<F>&>(*this).value;
+        }
+
+        template <class F>
+        const typename F::value_type& ValueOf() const
+        {
+            return static_cast<const detail::Slot<F>&>(*this).value;
+        }
+
+        static void HashBytes(unsigned long long& h, const void* data, std::size_t size)
+        {
+            const unsigned char* bytes = static_cast<const unsigned char*>(data);
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                h ^= bytes[i];
+                h *= 0x100000001B3ull;
+            }
+        }
+
+        template <class F>
+        void PrintField(std::string& s, std::string& val, std::size_t max_par_len, const MGLFormattingOptions& formatting, unsigned long long mask, unsigned long long& bit) const
+        {
+            if ((mask & bit) != 0)
+            {
+                val.clear();
+                detail::AppendValue<F>(val, ValueOf<F>(), formatting);
+                detail::AppendLine(s, F::name, val, max_par_len, formatting);
+            }
+            bit <<= 1;
+        }
+
+};
+
+
+// *****************************************************************
+//      FIELD TAGS
+// *****************************************************************
+
+// Tags of frequently checked render states. Tags are named after their MGLRenderState member without type prefix.
+namespace field
+{
+
+// GL_VERSION_1_0
+MGL_DECLARE_FIELD( Blend,                   1, 0, Blend,            GL_BLEND,                           Boolean,        bBlend,                     nullptr             );
+MGL_DECLARE_FIELD( ColorWriteMask,          1, 0, Blend,            GL_COLOR_WRITEMASK,                 BooleanArray,   bColorWriteMask,            nullptr             );
+MGL_DECLARE_FIELD( LogicOpMode,             1, 0, Blend,            GL_LOGIC_OP_MODE,                   Enum,           iLogicOpMode,               mglEnumName         );
+MGL_DECLARE_FIELD( Dither,                  1, 0, Blend,            GL_DITHER,                          Boolean,        bDither,                    nullptr             );
+MGL_DECLARE_FIELD( DepthTest,               1, 0, DepthStencil,     GL_DEPTH_TEST,                      Boolean,        bDepthTest,                 nullptr             );
+MGL_DECLARE_FIELD( DepthFunc,               1, 0, DepthStencil,     GL_DEPTH_FUNC,                      Enum,           iDepthFunc,                 mglEnumName         );
+MGL_DECLARE_FIELD( DepthWriteMask,          1, 0, DepthStencil,     GL_DEPTH_WRITEMASK,                 Boolean,        bDepthWriteMask,            nullptr             );
+MGL_DECLARE_FIELD( DepthRange,              1, 0, DepthStencil,     GL_DEPTH_RANGE,                     DoubleArray,    dDepthRange,                nullptr             );
+MGL_DECLARE_FIELD( StencilTest,             1, 0, DepthStencil,     GL_STENCIL_TEST,                    Boolean,        bStencilTest,               nullptr             );
+MGL_DECLARE_FIELD( StencilFunc,             1, 0, DepthStencil,     GL_STENCIL_FUNC,                    Enum,           iStencilFunc,               mglEnumName         );
+MGL_DECLARE_FIELD( StencilRef,              1, 0, DepthStencil,     GL_STENCIL_REF,                     Integer,        iStencilRef,                nullptr             );
+MGL_DECLARE_FIELD( StencilValueMask,        1, 0, DepthStencil,     GL_STENCIL_VALUE_MASK,              IntegerHex,     iStencilValueMask,          nullptr             );
+MGL_DECLARE_FIELD( StencilWriteMask,        1, 0, DepthStencil,     GL_STENCIL_WRITEMASK,               IntegerHex,     iStencilWriteMask,          nullptr             );
+MGL_DECLARE_FIELD( StencilFail,             1, 0, DepthStencil,     GL_STENCIL_FAIL,                    Enum,           iStencilFail,               detail::ZeroEnumName);
+MGL_DECLARE_FIELD( StencilPassDepthFail,    1, 0, DepthStencil,     GL_STENCIL_PASS_DEPTH_FAIL,         Enum,           iStencilPassDepthFail,      detail::ZeroEnumName);
+MGL_DECLARE_FIELD( StencilPassDepthPass,    1, 0, DepthStencil,     GL_STENCIL_PASS_DEPTH_PASS,         Enum,           iStencilPassDepthPass,      detail::ZeroEnumName);
+MGL_DECLARE_FIELD( DepthClearValue,         1, 0, DepthStencil,     GL_DEPTH_CLEAR_VALUE,               Double,         dDepthClearValue,           nullptr             );
+MGL_DECLARE_FIELD( StencilClearValue,       1, 0, DepthStencil,     GL_STENCIL_CLEAR_VALUE,             Integer,        iStencilClearValue,         nullptr             );
+MGL_DECLARE_FIELD( CullFace,                1, 0, Rasterizer,       GL_CULL_FACE,                       Boolean,        bCullFace,                  nullptr             );
+MGL_DECLARE_FIELD( CullFaceMode,            1, 0, Rasterizer,       GL_CULL_FACE_MODE,                  Enum,           iCullFaceMode,              mglEnumName         );
+MGL_DECLARE_FIELD( FrontFace,               1, 0, Rasterizer,       GL_FRONT_FACE,                      Enum,           iFrontFace,                 mglEnumName         );
+MGL_DECLARE_FIELD( PolygonMode,             1, 0, Rasterizer,       GL_POLYGON_MODE,                    EnumArray,      iPolygonMode,               mglEnumName         );
+MGL_DECLARE_FIELD( ScissorTest,             1, 0, Rasterizer,       GL_SCISSOR_TEST,                    Boolean,        bScissorTest,               nullptr             );
+MGL_DECLARE_FIELD( ScissorBox,              1, 0, Rasterizer,       GL_SCISSOR_BOX,                     IntegerArray,   iScissorBox,                nullptr             );
+MGL_DECLARE_FIELD( Viewport,                1, 0, Rasterizer,       GL_VIEWPORT,                        IntegerArray,   iViewport,                  nullptr             );
+MGL_DECLARE_FIELD( LineWidth,               1, 0, Rasterizer,       GL_LINE_WIDTH,                      Float,          fLineWidth,                 nullptr             );
+MGL_DECLARE_FIELD( PointSize,               1, 0, Rasterizer,       GL_POINT_SIZE,                      Float,          fPointSize,                 nullptr             );
+MGL_DECLARE_FIELD( UnpackAlignment,         1, 0, PixelStore,       GL_UNPACK_ALIGNMENT,                Integer,        iUnpackAlignment,           nullptr             );
+MGL_DECLARE_FIELD( PackAlignment,           1, 0, PixelStore,       GL_PACK_ALIGNMENT,                  Integer,        iPackAlignment,             nullptr             );
+MGL_DECLARE_FIELD( ColorClearValue,         1, 0, Framebuffer,      GL_COLOR_CLEAR_VALUE,               FloatArray,     fColorClearValue,           nullptr             );
+MGL_DECLARE_FIELD( TextureBinding2D,        1, 0, Textures,         GL_TEXTURE_BINDING_2D,              Integer,        iTextureBinding2D,          nullptr             );
+
+// GL_VERSION_1_1
+MGL_DECLARE_FIELD( ColorLogicOp,            1, 1, Blend,            GL_COLOR_LOGIC_OP,                  Boolean,        bColorLogicOp,              nullptr             );
+MGL_DECLARE_FIELD( PolygonOffsetFill,       1, 1, Rasterizer,       GL_POLYGON_OFFSET_FILL,             Boolean,        bPolygonOffsetFill,         nullptr             );
+MGL_DECLARE_FIELD( PolygonOffsetFactor,     1, 1, Rasterizer,       GL_POLYGON_OFFSET_FACTOR,           Float,          fPolygonOffsetFactor,       nullptr             );
+MGL_DECLARE_FIELD( PolygonOffsetUnits,      1, 1, Rasterizer,       GL_POLYGON_OFFSET_UNITS,            Float,          fPolygonOffsetUnits,        nullptr             );
+
+#ifdef GL_VERSION_1_2
+MGL_DECLARE_FIELD( BlendColor,              1, 2, Blend,            GL_BLEND_COLOR,                     FloatArray,     fBlendColor,                nullptr             );
+#endif
+
+#ifdef GL_VERSION_1_3
+MGL_DECLARE_FIELD( ActiveTexture,           1, 3, Textures,         GL_ACTIVE_TEXTURE,                  Enum,           iActiveTexture,             mglEnumName         );
+#endif
+
+#ifdef GL_VERSION_1_4
+MGL_DECLARE_FIELD( BlendDstAlpha,           1, 4, Blend,            GL_BLEND_DST_ALPHA,                 Enum,           iBlendDstAlpha,             detail::ZeroEnumName);
+MGL_DECLARE_FIELD( BlendDstRGB,             1, 4, Blend,            GL_BLEND_DST_RGB,                   Enum,           iBlendDstRGB,               detail::ZeroEnumName);
+MGL_DECLARE_FIELD( BlendSrcAlpha,           1, 4, Blend,            GL_BLEND_SRC_ALPHA,                 Enum,           iBlendSrcAlpha,             detail::ZeroEnumName);
+MGL_DECLARE_FIELD( BlendSrcRGB,             1, 4, Blend,            GL_BLEND_SRC_RGB,                   Enum,           iBlendSrcRGB,               detail::ZeroEnumName);
+#endif
+
+#ifdef GL_VERSION_1_5
+MGL_DECLARE_FIELD( ArrayBufferBinding,      1, 5, BufferBindings,   GL_ARRAY_BUFFER_BINDING,            Integer,        iArrayBufferBinding,        nullptr             );
+MGL_DECLARE_FIELD( ElementArrayBufferBinding, 1, 5, VertexBindings, GL_ELEMENT_ARRAY_BUFFER_BINDING,    Integer,        iElementArrayBufferBinding, nullptr             );
+#endif
+
+#ifdef GL_VERSION_2_0
+MGL_DECLARE_FIELD( BlendEquationAlpha,      2, 0, Blend,            GL_BLEND_EQUATION_ALPHA,            Enum,           iBlendEquationAlpha,        mglEnumName         );
+MGL_DECLARE_FIELD( BlendEquationRGB,        2, 0, Blend,            GL_BLEND_EQUATION_RGB,              Enum,           iBlendEquationRGB,          mglEnumName         );
+MGL_DECLARE_FIELD( StencilBackFunc,         2, 0, DepthStencil,     GL_STENCIL_BACK_FUNC,               Enum,           iStencilBackFunc,           mglEnumName         );
+MGL_DECLARE_FIELD( StencilBackRef,          2, 0, DepthStencil,     GL_STENCIL_BACK_REF,                Integer,        iStencilBackRef,            nullptr             );
+MGL_DECLARE_FIELD( StencilBackValueMask,    2, 0, DepthStencil,     GL_STENCIL_BACK_VALUE_MASK,         IntegerHex,     iStencilBackValueMask,      nullptr             );
+MGL_DECLARE_FIELD( StencilBackWriteMask,    2, 0, DepthStencil,     GL_STENCIL_BACK_WRITEMASK,          IntegerHex,     iStencilBackWriteMask,      nullptr             );
+MGL_DECLARE_FIELD( StencilBackFail,         2, 0, DepthStencil,     GL_STENCIL_BACK_FAIL,               Enum,           iStencilBackFail,           detail::ZeroEnumName);
+MGL_DECLARE_FIELD( StencilBackPassDepthFail, 2, 0, DepthStencil,    GL_STENCIL_BACK_PASS_DEPTH_FAIL,    Enum,           iStencilBackPassDepthFail,  detail::ZeroEnumName);
+MGL_DECLARE_FIELD( StencilBackPassDepthPass, 2, 0, DepthStencil,    GL_STENCIL_BACK_PASS_DEPTH_PASS,    Enum,           iStencilBackPassDepthPass,  detail::ZeroEnumName);
+MGL_DECLARE_FIELD( CurrentProgram,          2, 0, Program,          GL_CURRENT_PROGRAM,                 Integer,        iCurrentProgram,            nullptr             );
+#endif
+
+#ifdef GL_VERSION_3_0
+MGL_DECLARE_FIELD( VertexArrayBinding,      3, 0, VertexBindings,   GL_VERTEX_ARRAY_BINDING,            Integer,        iVertexArrayBinding,        nullptr             );
+MGL_DECLARE_FIELD( DrawFramebufferBinding,  3, 0, Framebuffer,      GL_DRAW_FRAMEBUFFER_BINDING,        Integer,        iDrawFramebufferBinding,    nullptr             );
+MGL_DECLARE_FIELD( ReadFramebufferBinding,  3, 0, Framebuffer,      GL_READ_FRAMEBUFFER_BINDING,        Integer,        iReadFramebufferBinding,    nullptr             );
+MGL_DECLARE_FIELD( RenderbufferBinding,     3, 0, Framebuffer,      GL_RENDERBUFFER_BINDING,            Integer,        iRenderbufferBinding,       nullptr             );
+#endif
+
+#ifdef GL_VERSION_3_1
+MGL_DECLARE_FIELD( PrimitiveRestartIndex,   3, 1, VertexBindings,   GL_PRIMITIVE_RESTART_INDEX,         Integer,        iPrimitiveRestartIndex,     nullptr             );
+#endif
+
+#ifdef GL_VERSION_3_2
+MGL_DECLARE_FIELD( ProgramPointSize,        3, 2, Rasterizer,       GL_PROGRAM_POINT_SIZE,              Boolean,        bProgramPointSize,          nullptr             );
+MGL_DECLARE_FIELD( ProvokingVertex,         3, 2, Rasterizer,       GL_PROVOKING_VERTEX,                Enum,           iProvokingVertex,           mglEnumName         );
+#endif
+
+#ifdef GL_VERSION_3_3
+MGL_DECLARE_FIELD( SamplerBinding,          3, 3, Textures,         GL_SAMPLER_BINDING,                 Integer,        iSamplerBinding,            nullptr             );
+#endif
+
+#ifdef GL_VERSION_4_0
+MGL_DECLARE_FIELD( PatchVertices,           4, 0, VertexBindings,   GL_PATCH_VERTICES,                  Integer,        iPatchVertices,             nullptr             );
+#endif
+
+#ifdef GL_VERSION_4_1
+MGL_DECLARE_FIELD( ProgramPipelineBinding,  4, 1, Program,          GL_PROGRAM_PIPELINE_BINDING,        Integer,        iProgramPipelineBinding,    nullptr             );
+#endif
+
+#ifdef GL_VERSION_4_3
+MGL_DECLARE_FIELD( DispatchIndirectBufferBinding, 4, 3, BufferBindings, GL_DISPATCH_INDIRECT_BUFFER_BINDING, Integer, iDispatchIndirectBufferBinding, nullptr          );
+#endif
+
+#ifdef GL_VERSION_4_5
+MGL_DECLARE_FIELD( ClipOrigin,              4, 5, Rasterizer,       GL_CLIP_ORIGIN,                     Enum,           iClipOrigin,                mglEnumName         );
+MGL_DECLARE_FIELD( ClipDepthMode,           4, 5, Rasterizer,       GL_CLIP_DEPTH_MODE,                 Enum,           iClipDepthMode,             mglEnumName         );
+#endif
+
+} // /namespace field
+
+
+} // /namespace mgl
+
+
+#endif // /MENTAL_GL_HPP
@@ -10,9 +10,6 @@
 #   include <GL/glut.h>
 #endif
 
-#define MENTAL_GL_GETINTEGERI_V
-#define MENTAL_GL_GETINTEGER64I_V
-
 #ifndef MENTAL_GL_IMPLEMENTATION
 #define MENTAL_GL_IMPLEMENTATION
 #endif
@@ -41,7 +38,7 @@ void drawScene(void)
     {
         renderStateShowen = 1;
 
-        MGLFormattingOptions fmt = { ' ', 3, 200, MGLFormattingOrderDefault, 1, NULL };
+        MGLFormattingOptions fmt = { ' ', 3, 200, MGLFormattingOrderDefault, 1, NULL, 0, NULL, NULL, MGLFormattingOutputText };
         
         // Query and print render state
         MGLRenderState rs;
@@ -0,0 +1,315 @@
+// CPU-only tests for MentalGL that do not require a GL context
+
+#include <stdio.h>
+#include <string.h>
+#include <glad/glad.h>
+
+#ifndef MENTAL_GL_IMPLEMENTATION
+#define MENTAL_GL_IMPLEMENTATION
+#endif
+
+#include "mental_gl.h"
+
+static int numFailures = 0;
+
+#define CHECK(EXPR)                                                             \
+    do                                                                          \
+    {                                                                           \
+        if (!(EXPR))                                                            \
+        {                                                                       \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #EXPR); \
+            ++numFailures;                                                      \
+        }                                                                       \
+    }                                                                           \
+    while (0)
+
+static size_t fieldElementCount(const MGLFieldDescriptor* field)
+{
+    return (field->type >= MGLFieldTypeIntegerArray ? field->count : 1);
+}
+
+// Fills all fields of the specified state structure with a pattern that depends on 'seed'
+static void fillFields(void* base, const MGLFieldDescriptor* fields, size_t num_fields, unsigned seed)
+{
+    for (size_t i = 0; i < num_fields; ++i)
+    {
+        const MGLFieldDescriptor* field = &(fields[i]);
+        char* val = (char*)base + field->offset;
+
+        for (size_t j = 0, n = fieldElementCount(field); j < n; ++j)
+        {
+            const unsigned pattern = seed * 31u + (unsigned)(i * 7 + j) + 1u;
+
+            switch (field->type)
+            {
+                case MGLFieldTypeBoolean:
+                case MGLFieldTypeBooleanArray:
+                    ((GLboolean*)val)[j] = (GLboolean)(pattern & 1u);
+                    break;
+                case MGLFieldTypeInteger64:
+                case MGLFieldTypeInteger64Array:
+                    ((GLint64*)val)[j] = (GLint64)pattern << 33;
+                    break;
+                case MGLFieldTypeFloat:
+                case MGLFieldTypeFloatArray:
+                    ((GLfloat*)val)[j] = (GLfloat)pattern * 0.25f;
+                    break;
+                case MGLFieldTypeDouble:
+                case MGLFieldTypeDoubleArray:
+                    ((GLdouble*)val)[j] = (GLdouble)pattern * 0.125;
+                    break;
+                default:
+                    ((GLint*)val)[j] = (GLint)pattern;
+                    break;
+            }
+        }
+    }
+
+    // Keep the numbers of elements of dynamic arrays consistent with their size
+    for (size_t i = 0; i < num_fields; ++i)
+    {
+        if (fields[i].count_offset != MGL_FIELD_NO_OFFSET)
+            *(GLint*)((char*)base + fields[i].count_offset) = (GLint)fields[i].count;
+    }
+}
+
+static void makeRenderState(MGLRenderState* rs, unsigned seed)
+{
+    size_t num_fields = 0;
+    const MGLFieldDescriptor* fields = mglGetRenderStateFields(&num_fields);
+
+    memset(rs, 0, sizeof(MGLRenderState));
+    fillFields(rs, fields, num_fields, seed);
+
+    rs->iMajorVersion = 4;
+    rs->iMinorVersion = 6;
+}
+
+static void testSnapshots(void)
+{
+    static unsigned char data[1 << 16], ref[1 << 16];
+    static MGLRenderState rs, rsCopy, rsUnchanged;
+    static MGLBindingPoints bp, bpCopy;
+
+    size_t num_fields = 0;
+    const MGLFieldDescriptor* fields = mglGetBindingPointsFields(&num_fields);
+
+    // Round-trip render states
+    makeRenderState(&rs, 1);
+
+    const size_t size = mglSerializeRenderState(&rs, NULL, 0);
+    CHECK(size > 20 && size <= sizeof(data));
+    CHECK(mglSerializeRenderState(&rs, data, sizeof(data)) == size);
+    CHECK(memcmp(data, "MGLS", 4) == 0);
+
+    memset(&rsCopy, 0xCD, sizeof(rsCopy));
+    CHECK(mglDeserializeRenderState(&rsCopy, data, sizeof(data)) == size);
+    CHECK(memcmp(&rs, &rsCopy, sizeof(rs)) == 0);
+
+    // Too small output buffers must not be written
+    memset(data, 0, sizeof(data));
+    CHECK(mglSerializeRenderState(&rs, data, size - 1) == size);
+    CHECK(data[0] == 0);
+    CHECK(mglSerializeRenderState(&rs, data, size) == size);
+
+    // Truncated snapshots must be rejected and leave the output unchanged
+    memset(&rsCopy, 0xCD, sizeof(rsCopy));
+    memcpy(&rsUnchanged, &rsCopy, sizeof(rsCopy));
+    CHECK(mglDeserializeRenderState(&rsCopy, data, size - 1) == 0);
+    CHECK(mglDeserializeRenderState(&rsCopy, data, 19) == 0);
+    CHECK(mglDeserializeRenderState(&rsCopy, NULL, size) == 0);
+
+    // Corrupt snapshots must be rejected: wrong magic, format version, kind, snapshot size, and a record that overruns the snapshot
+    static const size_t corruptBytes[] = { 0, 4, 6, 16, 17, 20 + 6, 20 + 7 };
+
+    memcpy(ref, data, size);
+
+    for (size_t i = 0; i < sizeof(corruptBytes)/sizeof(corruptBytes[0]); ++i)
+    {
+        data[corruptBytes[i]] ^= 0xFF;
+        CHECK(mglDeserializeRenderState(&rsCopy, data, size) == 0);
+        memcpy(data, ref, size);
+    }
+
+    CHECK(memcmp(&rsCopy, &rsUnchanged, sizeof(rsCopy)) == 0);
+    CHECK(mglDeserializeBindingPoints(&bp, data, size) == 0);
+
+    // Round-trip binding points
+    memset(&bp, 0, sizeof(bp));
+    fillFields(&bp, fields, num_fields, 2);
+
+    const size_t bpSize = mglSerializeBindingPoints(&bp, data, sizeof(data));
+    CHECK(bpSize > 20 && bpSize <= sizeof(data));
+    CHECK(mglDeserializeBindingPoints(&bpCopy, data, bpSize) == bpSize);
+    CHECK(memcmp(&bp, &bpCopy, sizeof(bp)) == 0);
+    CHECK(mglDeserializeRenderState(&rsCopy, data, bpSize) == 0);
+}
+
+static void testCapture(void)
+{
+    enum { numDraws = 200 };
+    static MGLRenderState states[numDraws], rs;
+
+    MGLCapture capture = mglCreateCapture(1024);
+    CHECK(capture != NULL);
+    if (capture == NULL)
+        return;
+
+    // Capturing outside of a frame is ignored
+    makeRenderState(&(states[0]), 1);
+    CHECK(mglCaptureRenderState(capture, &(states[0])) == 0);
+    CHECK(mglGetCaptureRange(capture, NULL) == 0);
+
+    // Mostly small changes between draw calls, so the ring buffer holds many deltas before it evicts the oldest draw calls
+    mglBeginCaptureFrame(capture);
+
+    for (size_t i = 0; i < numDraws; ++i)
+    {
+        if (i > 0)
+            states[i] = states[i - 1];
+        states[i].iViewport[2] = (GLint)i;
+        states[i].bBlend = (GLboolean)(i % 2);
+        if (i % 50 == 25)
+            states[i].fLineWidth += 1.0f;
+        CHECK(mglCaptureRenderState(capture, &(states[i])) != 0);
+    }
+
+    mglEndCaptureFrame(capture);
+    CHECK(mglCaptureRenderState(capture, &(states[0])) == 0);
+
+    size_t first = 0;
+    const size_t count = mglGetCaptureRange(capture, &first);
+    CHECK(count > 1 && count < numDraws);
+    CHECK(first + count == numDraws);
+
+    // Reconstruct all available draw calls in ascending and descending order
+    for (size_t i = first; i < first + count; ++i)
+        CHECK(mglGetCapturedRenderState(capture, i, &rs) && memcmp(&rs, &(states[i]), sizeof(rs)) == 0);
+
+    for (size_t i = first + count; i-- > first;)
+        CHECK(mglGetCapturedRenderState(capture, i, &rs) && memcmp(&rs, &(states[i]), sizeof(rs)) == 0);
+
+    // Evicted and future draw calls are unavailable
+    CHECK(first == 0 || mglGetCapturedRenderState(capture, first - 1, &rs) == 0);
+    CHECK(mglGetCapturedRenderState(capture, first + count, &rs) == 0);
+
+    // A change that exceeds the entire budget discards all previous draw calls
+    mglBeginCaptureFrame(capture);
+    CHECK(mglCaptureRenderState(capture, &(states[0])) != 0);
+    CHECK(mglCaptureRenderState(capture, &(states[1])) != 0);
+    makeRenderState(&(states[2]), 2);
+    CHECK(mglCaptureRenderState(capture, &(states[2])) != 0);
+    CHECK(mglGetCaptureRange(capture, &first) == 1 && first == 2);
+    CHECK(mglGetCapturedRenderState(capture, 2, &rs) && memcmp(&rs, &(states[2]), sizeof(rs)) == 0);
+    CHECK(mglGetCapturedRenderState(capture, 1, &rs) == 0);
+
+    mglFreeCapture(capture);
+}
+
+// Returns non-zero if the interned render state with the specified ID equals 'rs' without its implementation dependent limits
+static int isInternedRenderState(MGLStateStore store, GLuint id, const MGLRenderState* rs)
+{
+    static MGLRenderState expected, actual;
+    MGLPackedRenderState packed;
+
+    mglPackRenderState(&packed, rs);
+    mglUnpackRenderState(&expected, &packed, NULL);
+
+    return (mglGetInternedRenderState(store, id, &actual, NULL) && memcmp(&expected, &actual, sizeof(actual)) == 0);
+}
+
+static void testStateStore(void)
+{
+    enum { numStates = 100 };
+    static MGLRenderState states[numStates], rs;
+    static GLuint ids[numStates];
+
+    MGLStateStore store = mglCreateStateStore(2);
+    CHECK(store != NULL);
+    if (store == NULL)
+        return;
+
+    for (size_t i = 0; i < numStates; ++i)
+        makeRenderState(&(states[i]), (unsigned)i + 1);
+
+    // Identical render states share one ID, regardless of GL_TIMESTAMP
+    const GLuint id0 = mglInternRenderState(store, &(states[0]));
+    CHECK(id0 != 0);
+    rs = states[0];
+    rs.iTimestamp += 1000;
+    CHECK(mglInternRenderState(store, &rs) == id0);
+    CHECK(mglGetNumInternedRenderStates(store) == 1);
+    CHECK(isInternedRenderState(store, id0, &(states[0])));
+
+    // Distinct render states get distinct IDs, also beyond the initial capacity
+    for (size_t i = 1; i < numStates; ++i)
+    {
+        ids[i] = mglInternRenderState(store, &(states[i]));
+        CHECK(ids[i] != 0 && ids[i] != id0);
+        CHECK(i == 1 || ids[i] != ids[i - 1]);
+    }
+
+    CHECK(mglGetNumInternedRenderStates(store) == numStates);
+
+    for (size_t i = 1; i < numStates; ++i)
+        CHECK(isInternedRenderState(store, ids[i], &(states[i])));
+
+    // Render states are only removed once all references are released
+    mglRetainRenderState(store, ids[1]);
+    mglReleaseRenderState(store, ids[1]);
+    CHECK(isInternedRenderState(store, ids[1], &(states[1])));
+    mglReleaseRenderState(store, ids[1]);
+    CHECK(mglGetInternedPackedRenderState(store, ids[1]) == NULL);
+    CHECK(mglGetInternedRenderState(store, ids[1], &rs, NULL) == 0);
+    CHECK(mglGetNumInternedRenderStates(store) == numStates - 1);
+
+    mglReleaseRenderState(store, id0);
+    CHECK(isInternedRenderState(store, id0, &(states[0])));
+    mglReleaseRenderState(store, id0);
+    CHECK(mglGetNumInternedRenderStates(store) == numStates - 2);
+
+    // IDs of removed render states are reused, and their previous render states can be interned again
+    makeRenderState(&rs, numStates + 1);
+    const GLuint reused = mglInternRenderState(store, &rs);
+    CHECK(reused == id0 || reused == ids[1]);
+    CHECK(isInternedRenderState(store, reused, &rs));
+
+    const GLuint id1 = mglInternRenderState(store, &(states[1]));
+    CHECK((id1 == id0 || id1 == ids[1]) && id1 != reused);
+    CHECK(isInternedRenderState(store, id1, &(states[1])));
+    CHECK(mglGetNumInternedRenderStates(store) == numStates);
+
+    for (size_t i = 2; i < numStates; ++i)
+        CHECK(isInternedRenderState(store, ids[i], &(states[i])));
+
+    // Invalid IDs are ignored
+    const GLuint invalidIds[] = { 0, numStates + 1, 0xFFFFFFFFu };
+
+    for (size_t i = 0; i < sizeof(invalidIds)/sizeof(invalidIds[0]); ++i)
+    {
+        mglRetainRenderState(store, invalidIds[i]);
+        mglReleaseRenderState(store, invalidIds[i]);
+        CHECK(mglGetInternedPackedRenderState(store, invalidIds[i]) == NULL);
+        CHECK(mglGetInternedRenderState(store, invalidIds[i], &rs, NULL) == 0);
+    }
+
+    CHECK(mglGetNumInternedRenderStates(store) == numStates);
+
+    mglFreeStateStore(store);
+}
+
+int main(void)
+{
+    testSnapshots();
+    testCapture();
+    testStateStore();
+
+    if (numFailures > 0)
+    {
+        fprintf(stderr, "%d check(s) failed\n", numFailures);
+        return 1;
+    }
+
+    printf("all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,138 @@
+// CPU-only tests for the MentalGL C++ wrapper that do not require a GL context
+
+#include <cstdio>
+#include <glad/glad.h>
+
+#ifndef MENTAL_GL_IMPLEMENTATION
+#define MENTAL_GL_IMPLEMENTATION
+#endif
+
+#include "mental_gl.hpp"
+
+static int numFailures = 0;
+
+#define CHECK(EXPR)                                                             \
+    do                                                                          \
+    {                                                                           \
+        if (!(EXPR))                                                            \
+        {                                                                       \
+            std::fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #EXPR); \
+            ++numFailures;                                                      \
+        }                                                                       \
+    }                                                                           \
+    while (0)
+
+// Additional tags like in the usage example of mental_gl.hpp
+MGL_DECLARE_FIELD( DrawBuffer13, 2, 0, Framebuffer, GL_DRAW_BUFFER13, Enum, iDrawBuffer_i[13], mglEnumName );
+MGL_DECLARE_INDEXED_FIELD( UniformBufferBinding, 3, 1, BufferBindings, GL_UNIFORM_BUFFER_BINDING, IntegerArray, iUniformBufferBinding, nullptr );
+MGL_DECLARE_INDEXED_FIELD( TransformFeedbackBufferSize, 3, 0, BufferBindings, GL_TRANSFORM_FEEDBACK_BUFFER_SIZE, Integer64Array, iTransformFeedbackBufferSize, nullptr );
+
+// Tags that diverge from mental_gl.h in their version, category, pname, and flags respectively
+MGL_DECLARE_FIELD( WrongVersion, 1, 1, Blend, GL_BLEND, Boolean, bBlend, nullptr );
+MGL_DECLARE_FIELD( WrongCategory, 1, 0, Rasterizer, GL_BLEND, Boolean, bBlend, nullptr );
+MGL_DECLARE_FIELD( WrongPName, 1, 0, Blend, GL_DITHER, Boolean, bBlend, nullptr );
+MGL_DECLARE_FIELD( WrongFlags, 3, 1, BufferBindings, GL_UNIFORM_BUFFER_BINDING, IntegerArray, iUniformBufferBinding, nullptr );
+
+static void testFieldTags()
+{
+    // All field tags of mental_gl.hpp must match the descriptor table of mental_gl.h
+    CHECK((mgl::AreFieldsConsistent<
+        mgl::field::Blend,
+        mgl::field::ColorWriteMask,
+        mgl::field::LogicOpMode,
+        mgl::field::Dither,
+        mgl::field::DepthTest,
+        mgl::field::DepthFunc,
+        mgl::field::DepthWriteMask,
+        mgl::field::DepthRange,
+        mgl::field::StencilTest,
+        mgl::field::StencilFunc,
+        mgl::field::StencilRef,
+        mgl::field::StencilValueMask,
+        mgl::field::StencilWriteMask,
+        mgl::field::StencilFail,
+        mgl::field::StencilPassDepthFail,
+        mgl::field::StencilPassDepthPass,
+        mgl::field::DepthClearValue,
+        mgl::field::StencilClearValue,
+        mgl::field::CullFace,
+        mgl::field::CullFaceMode,
+        mgl::field::FrontFace,
+        mgl::field::PolygonMode,
+        mgl::field::ScissorTest,
+        mgl::field::ScissorBox,
+        mgl::field::Viewport,
+        mgl::field::LineWidth,
+        mgl::field::PointSize,
+        mgl::field::UnpackAlignment,
+        mgl::field::PackAlignment,
+        mgl::field::ColorClearValue,
+        mgl::field::TextureBinding2D,
+        mgl::field::ColorLogicOp,
+        mgl::field::PolygonOffsetFill,
+        mgl::field::PolygonOffsetFactor,
+        mgl::field::PolygonOffsetUnits,
+        mgl::field::BlendColor,
+        mgl::field::ActiveTexture,
+        mgl::field::BlendDstAlpha,
+        mgl::field::BlendDstRGB,
+        mgl::field::BlendSrcAlpha,
+        mgl::field::BlendSrcRGB,
+        mgl::field::ArrayBufferBinding,
+        mgl::field::ElementArrayBufferBinding,
+        mgl::field::BlendEquationAlpha,
+        mgl::field::BlendEquationRGB,
+        mgl::field::StencilBackFunc,
+        mgl::field::StencilBackRef,
+        mgl::field::StencilBackValueMask,
+        mgl::field::StencilBackWriteMask,
+        mgl::field::StencilBackFail,
+        mgl::field::StencilBackPassDepthFail,
+        mgl::field::StencilBackPassDepthPass,
+        mgl::field::CurrentProgram,
+        mgl::field::VertexArrayBinding,
+        mgl::field::DrawFramebufferBinding,
+        mgl::field::ReadFramebufferBinding,
+        mgl::field::RenderbufferBinding,
+        mgl::field::PrimitiveRestartIndex,
+        mgl::field::ProgramPointSize,
+        mgl::field::ProvokingVertex,
+        mgl::field::SamplerBinding,
+        mgl::field::PatchVertices,
+        mgl::field::ProgramPipelineBinding,
+        mgl::field::DispatchIndirectBufferBinding,
+        mgl::field::ClipOrigin,
+        mgl::field::ClipDepthMode
+    >()));
+
+    CHECK((mgl::AreFieldsConsistent<DrawBuffer13, UniformBufferBinding, TransformFeedbackBufferSize>()));
+
+    CHECK(!mgl::IsFieldConsistent<WrongVersion>());
+    CHECK(!mgl::IsFieldConsistent<WrongCategory>());
+    CHECK(!mgl::IsFieldConsistent<WrongPName>());
+    CHECK(!mgl::IsFieldConsistent<WrongFlags>());
+}
+
+static void testIndexedFieldLimits()
+{
+    CHECK(mglGetIndexedFieldLimit(GL_UNIFORM_BUFFER_BINDING, mgl::Version(4, 6)) == GL_MAX_UNIFORM_BUFFER_BINDINGS);
+    CHECK(mglGetIndexedFieldLimit(GL_VERTEX_BINDING_STRIDE, mgl::Version(4, 6)) == GL_MAX_VERTEX_ATTRIB_BINDINGS);
+    CHECK(mglGetIndexedFieldLimit(GL_TRANSFORM_FEEDBACK_BUFFER_BINDING, mgl::Version(3, 3)) == GL_MAX_TRANSFORM_FEEDBACK_SEPARATE_ATTRIBS);
+    CHECK(mglGetIndexedFieldLimit(GL_TRANSFORM_FEEDBACK_BUFFER_BINDING, mgl::Version(4, 0)) == GL_MAX_TRANSFORM_FEEDBACK_BUFFERS);
+    CHECK(mglGetIndexedFieldLimit(GL_BLEND, mgl::Version(4, 6)) == 0);
+}
+
+int main()
+{
+    testFieldTags();
+    testIndexedFieldLimits();
+
+    if (numFailures > 0)
+    {
+        std::fprintf(stderr, "%d check(s) failed\n", numFailures);
+        return 1;
+    }
+
+    std::printf("all checks passed\n");
+    return 0;
+}